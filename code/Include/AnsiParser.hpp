@@ -0,0 +1,133 @@
+// AnsiParser.hpp
+// Streaming parser for ANSI escape sequences (SGR colors).
+//
+// Turns a byte stream that may contain escape sequences - from termcolor
+// manipulators (tc::green, tc::reset, ...) or raw child-process output - into
+// runs of printable text and foreground color changes. The parser is a small
+// state machine, so a sequence split across Feed() calls (pipe reads, partial
+// lines) is handled, and the current color carries over from one call to the
+// next just as it does on a terminal.
+//
+// Recognized SGR parameters: 0 (reset), 1 / 22 (bold on / off, brightens the 8
+// basic colors), 30-37, 90-97, 39, 38;5;n and 38;2;r;g;b. Background colors
+// and every other CSI / OSC sequence are consumed and dropped.
+
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+
+class AnsiParser {
+public:
+	AnsiParser();
+
+	/**
+	 * @brief Parses the next chunk of the stream
+	 * @param input Bytes to parse (UTF-8 text passes through untouched)
+	 * @param onText Called as onText(std::string_view) for each printable run
+	 * @param onColor Called as onColor(ImU32) whenever the foreground color
+	 *        changes; 0 means the default text color
+	 */
+	template <typename OnText, typename OnColor>
+	void Feed(std::string_view input, OnText&& onText, OnColor&& onColor) {
+		size_t runStart = 0;
+		for (size_t i = 0; i < input.size(); i++) {
+			const char c = input[i];
+			switch (m_state) {
+			case State::Text:
+				if (c == '\x1b') {
+					if (i > runStart) onText(input.substr(runStart, i - runStart));
+					m_state = State::Escape;
+				}
+				break;
+
+			case State::Escape:
+				if (c == '[') {
+					m_state		 = State::Csi;
+					m_paramCount = 0;
+					m_params[0]	 = 0;
+				} else if (c == ']') {
+					m_state = State::Osc;
+				} else {
+					// Two-byte sequence (ESC 7, ESC c, ...): nothing to keep
+					m_state	 = State::Text;
+					runStart = i + 1;
+				}
+				break;
+
+			case State::Csi:
+				if (c >= '0' && c <= '9') {
+					if (m_paramCount == 0) m_paramCount = 1;
+					int& param = m_params[m_paramCount - 1];
+					param	   = std::min(param * 10 + (c - '0'), 0xFFFF);
+				} else if (c == ';' || c == ':') {
+					if (m_paramCount == 0) m_paramCount = 1;
+					if (m_paramCount < kMaxParams) m_params[m_paramCount++] = 0;
+				} else if (c >= 0x40 && c <= 0x7E) {
+					if (c == 'm' && ApplySgr()) onColor(m_color);
+					m_state	 = State::Text;
+					runStart = i + 1;
+				}
+				// Private markers and intermediates ('?', ' ', ...) are skipped
+				break;
+
+			case State::Osc:
+				// Window title and friends: ends with BEL or ESC '\'
+				if (c == '\x07') {
+					m_state	 = State::Text;
+					runStart = i + 1;
+				} else if (c == '\x1b') {
+					m_state = State::OscEscape;
+				}
+				break;
+
+			case State::OscEscape:
+				m_state	 = State::Text;
+				runStart = i + 1;
+				break;
+			}
+		}
+
+		if (m_state == State::Text && runStart < input.size()) onText(input.substr(runStart));
+	}
+
+	/** @brief Current foreground color, 0 for the default text color */
+	ImU32 GetColor() const { return m_color; }
+
+	/** @brief Drops any partial sequence and returns to the default color */
+	void Reset();
+
+	/**
+	 * @brief xterm 256-color palette
+	 *
+	 * Entries 0-15 use the same colors as the console's [tag] convention
+	 * (ImGuiTermcolor), so tc::red and "[red]" look the same.
+	 */
+	static ImU32 PaletteColor(int index);
+
+	/**
+	 * @brief Copies line into out with every escape sequence removed
+	 * @return View of line itself when it has no escapes, otherwise of out
+	 */
+	static std::string_view Strip(std::string_view line, std::string& out);
+
+private:
+	enum class State : uint8_t { Text, Escape, Csi, Osc, OscEscape };
+
+	static constexpr int kMaxParams = 16;
+
+	// Applies the collected SGR parameters; returns true if the color changed
+	bool ApplySgr();
+
+	State m_state;
+	int	  m_params[kMaxParams];
+	int	  m_paramCount;
+
+	ImU32 m_color;	  // Resolved foreground, 0 = default
+	ImU32 m_extended; // Set by 38;5;n / 38;2;r;g;b, 0 if none
+	int	  m_basic;	  // 0-15 when set by 30-37 / 90-97, -1 otherwise
+	bool  m_bold;
+};
+
+} // namespace app
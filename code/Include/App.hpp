@@ -1,6 +1,9 @@
 #pragma once
 
 #include "PCH.hpp"
+#include "TickScheduler.hpp"
+#include "LazyPanel.hpp"
+#include "EventBus.hpp"
 
 // Forward declarations
 namespace app {
@@ -8,11 +11,15 @@ namespace app {
     class OutputConsole;
     class CommandLineArguments;
     class ConsoleWindow;
+    class ConsoleInputHandler;
+    class ControlServer;
     class WindowManager;
     class FontManager;
     class FontManagerWindow;
     class DebugWindow;
     class ConfigManager;
+    class StyleManager;
+    class FrameArena;
     class WindowClass;
     class ExampleDescriptorHeapAllocator;
     class DX12Renderer;
@@ -68,25 +75,46 @@ public:
      */
     static App* GetInstance() { return s_instance; }
 
+    /**
+     * @brief Ask the main loop to finish the current frame and shut down
+     *
+     * Safe to call from any thread and from inside rendering; the actual
+     * teardown runs in Shutdown() once the loop has exited.
+     */
+    static void RequestExit() { s_exitRequested.store(true, std::memory_order_relaxed); }
+
     /**
      * @brief Get the DirectX 12 renderer instance
      * @return Pointer to the DX12Renderer
      */
     DX12Renderer* GetRenderer() const { return m_renderer; }
 
+    const TickScheduler& GetScheduler() const { return m_scheduler; }
+
 private:
     /**
      * @brief Initialize all application subsystems
+     *
+     * Adds the Open steps to the startup graph (after the allocations run by
+     * MemoryManagement::AllocAll()), runs them and prints the critical path.
+     * Config, style and font files are read on worker threads while the
+     * window, the device and ImGui are set up on this one.
+     *
      * @param hInstance Application instance handle
      */
     void Initialize(_In_ HINSTANCE hInstance);
 
     /**
-     * @brief Create and display the application window
+     * @brief Create the application window
      * @param hInstance Application instance handle
      */
     void OpenWindow(_In_ HINSTANCE hInstance);
 
+    /**
+     * @brief Create the Direct3D device and swap chain, then show the window
+     */
+    void CreateDevice();
+
     /**
      * @brief Setup ImGui context and styling
      */
@@ -100,47 +128,84 @@ private:
     /**
      * @brief Main rendering loop
      * 
-     * Loads fonts, initializes configuration, and runs the main message loop.
+     * Runs the main message loop once Initialize() has loaded fonts and configuration.
      * Handles window messages, renders ImGui windows, and manages frame presentation.
      */
     void MainLoop();
 
     /**
-     * @brief Render a single frame
-     * @param clear_color Background clear color
+     * @brief Render a single frame, cleared with m_clearColor
      * @return true if should continue, false if application should exit
      */
-    bool RenderFrame(ImVec4& clear_color, bool& colorModified);
+    bool RenderFrame();
 
     /**
      * @brief Render ImGui UI elements
-     * @param clear_color Background clear color (input/output)
-     * @param colorModified Set to true if color was modified this frame
      */
-    void RenderUI(ImVec4& clear_color, bool& colorModified);
+    void RenderUI();
+
+    /**
+     * @brief Takes the clear color and the font size from the config
+     * @param event Which cvar changed, or nullptr for all of it
+     */
+    void OnConfigChanged(const ConfigChanged& event);
+
+    /**
+     * @brief Scales a style loaded from file to the monitor, as startup does
+     */
+    void OnStyleChanged(const StyleChanged& event);
 
     /**
      * @brief Cleanup all application resources
      */
     void Cleanup();
 
+    /**
+     * @brief Bounded shutdown pipeline run after the main loop exits
+     *
+     * 1. Stops the threads that produce work (control endpoints, stdin reader)
+     * 2. Saves the config files on worker threads while the log file and the
+     *    native console are flushed, all within kShutdownFlushTimeout
+     * 3. Releases the GPU and ImGui once (Cleanup())
+     *
+     * Heap memory is not freed here; see wWinMain. Debug builds print how
+     * long each phase took.
+     */
+    void Shutdown();
+
     HRESULT Alloc();
 
 private:
     // Singleton instance
     static App* s_instance;
 
+    // Set by RequestExit(); checked once per frame by MainLoop()
+    static std::atomic<bool> s_exitRequested;
+
     // Application objects
     MemoryManagement* m_memory;
     OutputConsole* m_console;
     CommandLineArguments* m_cmdArgs;
     ConsoleWindow* m_consoleWindow;
+    ConsoleInputHandler* m_inputHandler;
+    ControlServer* m_controlServer;
     WindowManager* m_window;
     FontManager* m_font_manager;
-    FontManagerWindow* m_font_manager_window;
-    DebugWindow* m_debug_window;
     ConfigManager* m_configManager;
-    WindowClass* m_window_obj;
+    StyleManager* m_styleManager;
+    FrameArena* m_frameArena;
+
+    // Tool windows, created when first shown and freed after a while closed
+#if APP_FEATURE_FILE_BROWSER
+    LazyPanel<WindowClass> m_fileBrowser;
+#endif
+    LazyPanel<DebugWindow> m_debugPanel;
+#if APP_FEATURE_FONT_MANAGER_UI
+    LazyPanel<FontManagerWindow> m_fontManagerPanel;
+#endif
+
+    // Per-frame and periodic work of the services, filled once startup has opened them
+    TickScheduler m_scheduler;
 
     // DirectX 12 Renderer and related objects
     DX12Renderer* m_renderer;
@@ -149,6 +214,9 @@ private:
     // ImGui context
     ImGuiIO* m_io;
     ImGuiStyle* m_style;
+
+    // Background color of the frame; kept in step with ConfigManager by OnConfigChanged()
+    ImVec4 m_clearColor;
 };
 
 } // namespace app
@@ -0,0 +1,122 @@
+// AsyncConsoleWriter.hpp
+// Background writer for the native console (stdout).
+//
+// The Windows console host is slow: a single WriteConsole call can take
+// hundreds of microseconds, and a redirected pipe can block indefinitely when
+// the reader stalls. Callers only append to an in-memory batch; a dedicated
+// thread swaps the batch out and hands it to the device in one call
+// (WriteConsoleW for a console, WriteFile / write() for files and pipes), so
+// everything logged while a write is in progress goes out in the next one.
+//
+// When the device falls behind and the batch reaches its capacity the
+// overflow policy decides what happens to new lines:
+//   Drop  - the line is discarded
+//   Merge - a repeat of the previous line is counted instead of queued,
+//           anything else is discarded
+//   Block - the caller waits for room (lossless, but a stalled reader stalls
+//           the caller)
+// Discarded and merged lines are reported with a notice line once the writer
+// catches up.
+//
+// Code that writes to std::cout directly bypasses the batch, so its text is
+// not ordered with respect to lines queued here.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "Benchmark.hpp"
+
+namespace app {
+
+class AsyncConsoleWriter {
+public:
+	/** @brief Values match the order of the 'console_overflow' cvar options */
+	enum class Overflow : int32_t { Drop, Merge, Block };
+
+	/** @brief Writes one batch of UTF-8 bytes to the device; errors are ignored */
+	using WriteFn = std::function<void(std::string_view bytes)>;
+
+	/**
+	 * @param write Device to write to; the process's stdout when empty
+	 */
+	explicit AsyncConsoleWriter(WriteFn write = WriteFn());
+
+	/**
+	 * @brief Gives the writer up to kStopTimeout to drain, then stops it
+	 *
+	 * A writer stuck in a blocking write (stalled pipe reader) is detached;
+	 * it owns its state, so it can finish or die with the process safely.
+	 */
+	~AsyncConsoleWriter();
+
+	AsyncConsoleWriter(const AsyncConsoleWriter&)			 = delete;
+	AsyncConsoleWriter& operator=(const AsyncConsoleWriter&) = delete;
+
+	/** @brief Queues line plus '\n'; only blocks under the Block policy */
+	void Write(std::string_view line);
+
+	/**
+	 * @brief Waits until everything queued so far has reached the device
+	 * @return false on timeout
+	 */
+	bool WaitIdle(std::chrono::milliseconds timeout);
+
+	void SetCapacity(size_t bytes);
+	void SetOverflow(Overflow overflow);
+
+	uint64_t GetDroppedLines() const;
+	uint64_t GetWriteCalls() const;
+	uint64_t GetBytesWritten() const;
+
+	/**
+	 * @brief Per-line cost for the caller when writing to a slow device
+	 *
+	 * The device is a stand-in for conhost / a throttled pipe: every write
+	 * call costs kThrottleCallUs plus kThrottleByteNs per byte. With async ==
+	 * false each line is written synchronously, as Out used to do.
+	 */
+	static BenchResult MeasureThrottled(uint32_t iterations, bool async);
+
+	static constexpr auto kStopTimeout = std::chrono::milliseconds(500);
+
+	static constexpr uint32_t kThrottleCallUs = 50;
+	static constexpr uint32_t kThrottleByteNs = 20;
+
+private:
+	// Everything the writer thread touches; shared so the thread can outlive us
+	struct State {
+		std::mutex				mutex;
+		std::condition_variable wake;  // Writer: work or stop
+		std::condition_variable space; // Callers: batch taken (Block policy)
+		std::condition_variable idle;  // WaitIdle(): nothing queued or in flight
+
+		std::string pending;	   // Batch being filled
+		size_t		lastLineStart; // Start of the last line in pending, npos if none
+		bool		writing;	   // A batch is being written
+		bool		shouldStop;
+
+		size_t	 capacity;
+		Overflow overflow;
+
+		uint64_t droppedLines;	 // Total, for statistics
+		uint64_t pendingDropped; // Not yet reported with a notice
+		uint64_t pendingRepeats; // Merged repeats not yet reported
+		uint64_t writeCalls;
+		uint64_t bytesWritten;
+
+		WriteFn write;
+	};
+
+	static void ThreadFunction(std::shared_ptr<State> state);
+
+	// state.mutex must be held
+	static void AppendNoticesLocked(State& state);
+
+	// Default device: console (UTF-16) or redirected handle / fd (raw bytes)
+	static void WriteStdout(std::string_view bytes);
+
+	std::shared_ptr<State> m_state;
+	std::thread			   m_thread;
+};
+
+} // namespace app
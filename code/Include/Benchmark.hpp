@@ -0,0 +1,128 @@
+// Benchmark.hpp
+// In-process micro-benchmark runner used by the console 'bench' command.
+//
+// Each target is a callable run for a number of warmup iterations followed by
+// timed iterations. Results report min / median / p99 latency after upper
+// outlier rejection, plus heap allocations per iteration (operator new and
+// ImGui::MemAlloc on the calling thread).
+
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+
+/**
+ * @brief Statistics for one benchmark run (serialized as-is to JSON)
+ */
+struct BenchResult {
+	std::string target;
+	uint32_t	iterations;		 // Timed iterations kept after outlier rejection
+	uint32_t	warmup;			 // Untimed iterations run first
+	uint32_t	outliers;		 // Samples rejected above Q3 + 3 * IQR
+	double		min_us;
+	double		median_us;
+	double		p99_us;
+	double		mean_us;
+	double		max_us;
+	double		allocs_per_iter; // operator new + ImGui::MemAlloc calls
+	double		bytes_per_iter;
+	double		throughput_gbps; // Processed bytes / median time; 0 unless set by SetThroughput()
+};
+
+/**
+ * @brief Export format written by Benchmark::ExportJson()
+ */
+struct BenchReport {
+	std::string				 machine;
+	uint32_t				 hardware_threads;
+	std::string				 timestamp;
+	std::vector<BenchResult> results;
+};
+
+class Benchmark {
+public:
+	/** @brief Body of a benchmark; receives the iteration index */
+	using Body = std::function<void(uint32_t iteration)>;
+
+	/** @brief Target that does its own timing (e.g. cross-thread latency) */
+	using Runner = std::function<BenchResult(uint32_t iterations)>;
+
+	struct Target {
+		std::string description;
+		uint32_t	defaultIterations;
+		Body		body;
+		Runner		runner;			 // Used instead of body when set
+		uint64_t	throughputBytes; // Input bytes processed per iteration, 0 if not applicable
+	};
+
+	Benchmark();
+	~Benchmark();
+
+	/**
+	 * @brief Registers (or replaces) a named target
+	 * @param name Name typed after 'bench'
+	 * @param description One-line description shown by 'bench list'
+	 * @param defaultIterations Iterations used when none are given
+	 * @param body Work measured once per iteration
+	 */
+	void AddTarget(const std::string& name, const std::string& description,
+				   uint32_t defaultIterations, Body body);
+
+	void AddCustomTarget(const std::string& name, const std::string& description,
+						 uint32_t defaultIterations, Runner runner);
+
+	/**
+	 * @brief Reports the target's throughput (GB/s at the median) with its results
+	 * @param bytesPerIteration Input bytes one iteration processes
+	 */
+	void SetThroughput(const std::string& name, uint64_t bytesPerIteration);
+
+	const Target*						 FindTarget(const std::string& name) const;
+	const std::map<std::string, Target>& GetTargets() const { return m_targets; }
+
+	/**
+	 * @brief Runs a registered target and records the result
+	 * @param iterations Timed iterations, 0 to use the target's default
+	 */
+	BenchResult Run(const std::string& name, uint32_t iterations = 0);
+
+	/**
+	 * @brief Runs a body that is not registered and records the result
+	 *
+	 * For one-off targets such as a console command benchmarked by name; they
+	 * do not show up in 'bench list' or 'bench all' afterwards.
+	 */
+	BenchResult RunOnce(const std::string& name, uint32_t iterations, const Body& body);
+
+	/**
+	 * @brief Measures an arbitrary body without registering it
+	 */
+	static BenchResult Measure(const std::string& name, uint32_t iterations, const Body& body);
+
+	/**
+	 * @brief Computes the statistics from raw samples (microseconds)
+	 * @param samples Timed samples; sorted in place
+	 */
+	static BenchResult FromSamples(const std::string& name, std::vector<double>& samples,
+								   uint32_t warmup, uint64_t allocs, uint64_t bytes);
+
+	const std::vector<BenchResult>& GetResults() const { return m_results; }
+	void							ClearResults() { m_results.clear(); }
+
+	/**
+	 * @brief Writes every recorded result plus machine info as JSON
+	 * @return true on success
+	 */
+	bool ExportJson(const std::wstring& path) const;
+
+	/** @brief Allocation counters of the calling thread (monotonic) */
+	static uint64_t GetThreadAllocCount();
+	static uint64_t GetThreadAllocBytes();
+
+private:
+	std::map<std::string, Target> m_targets;
+	std::vector<BenchResult>	  m_results;
+};
+
+} // namespace app
@@ -7,12 +7,24 @@
 #include "PCH.hpp"
 
 #include "Master.hpp"
+#include "Component.hpp"
+#include "TickScheduler.hpp"
+#include "LazyPanel.hpp"
 #include "CommandLineArgumments.hpp"
 #include "ConsoleWindow.hpp"
 #include "ConsoleInputHandler.hpp"
+#include "ControlServer.hpp"
 #include "ConfigManager.hpp"
+#include "ConsoleVariables.hpp"
+#include "SpscRing.hpp"
+#include "MpscRing.hpp"
+#include "EventBus.hpp"
+#include "JobSystem.hpp"
+#include "Benchmark.hpp"
 #include "StyleManager.hpp"
 #include "Conv.hpp"
+#include "Utf.hpp"
+#include "StringPool.hpp"
 #include "DX12Renderer.hpp"
 #include "DX12Demos.hpp"
 #include "DebugWindow.hpp"
@@ -24,7 +36,15 @@
 #include "Globals.hpp"
 #include "render.hpp"
 #include "StyleConfiguration.hpp"
+#include "StartupGraph.hpp"
+#include "ServiceRegistry.hpp"
+#include "MemoryTags.hpp"
+#include "FrameArena.hpp"
+#include "PoolAllocator.hpp"
 #include "MemoryManagement.hpp"
 #include "WindowManager.hpp"
+#include "AnsiParser.hpp"
+#include "AsyncConsoleWriter.hpp"
+#include "OutputSinks.hpp"
 #include "OutputConsole.hpp"
 #include "App.hpp"
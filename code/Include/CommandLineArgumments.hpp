@@ -9,6 +9,7 @@
 
 // Include base class definition
 #include "Master.hpp"
+#include "Utf.hpp"
 namespace app {
 /**
  * @brief Class that handles command line argument parsing
@@ -19,9 +20,10 @@ namespace app {
  * - Window position (-x, -y)
  * - Window state (-maximized, -fullscreen, -windowed)
  * - Console mode (-cmd)
+ * - Single-instance mode (-single) and startup commands (-exec "<command>")
  */
 
-class CommandLineArguments : public Master {
+class CommandLineArguments final : public Master {
 public:
 	// Constructor - Initializes all member variables
 	CommandLineArguments();
@@ -32,7 +34,7 @@ public:
 	// Opens and initializes the command line parser
 	virtual void Open() override;
 
-	// Tick function (currently unused but required by Master interface)
+	// Runs -exec commands and commands forwarded by later instances (main thread, once per frame)
 	virtual void Tick() override;
 
 	// Closes and cleans up resources
@@ -42,7 +44,7 @@ public:
      * @brief Gets the map of parsed command line arguments
      * @return Reference to the map containing argument name -> index pairs
      */
-	std::map<std::wstring, uint64_t>& GetMap() { return Args; }
+	std::map<std::wstring, uint64_t, utf::NoCaseLess>& GetMap() { return Args; }
 
 	// ===== NEW: Window Configuration Methods =====
 
@@ -77,6 +79,35 @@ public:
 
 	void ShowCmd();
 
+	// ===== Single-instance mode =====
+
+	/** @brief Endpoint (see ControlServer::ResolveEndpoint) the first -single instance listens on */
+	static constexpr const char* kInstanceEndpoint = "imgui_couse_instance";
+
+	/**
+	 * @brief Hands this launch over to an instance that is already running
+	 *
+	 * Called from wWinMain before anything is allocated. Only acts when -single
+	 * is on the command line: the first such process takes a named mutex and
+	 * later opens kInstanceEndpoint; every later one connects to it, sends an
+	 * 'activate' line with its arguments followed by its -exec commands, and
+	 * returns true without waiting for them to run.
+	 *
+	 * @return true if the running instance took over and this process should exit
+	 */
+	static bool ForwardToRunningInstance();
+
+	/**
+	 * @brief Applies window arguments sent by a later launch ('activate' command)
+	 *
+	 * Restores and focuses the window, then honours -width/-height/-x/-y,
+	 * -maximized, -fullscreen, -windowed and -cmd as a fresh start would.
+	 */
+	void ApplyForwardedArguments(const std::wstring& commandLine);
+
+	/** @brief True when this process owns the single-instance mutex */
+	bool IsSingleInstance() const { return m_instanceServer != nullptr; }
+
 private:
 	/**
      * @brief Parses the command line arguments into the Args map
@@ -84,9 +115,18 @@ private:
      */
 	int GetInitArgs();
 
+	// Parses commandLine (program name first) into szArgList / Args
+	int ParseArgs(LPCWSTR commandLine);
+
+	// Values of every -exec / --exec, in order, as UTF-8
+	std::vector<std::string> CollectExecCommands() const;
+
+	// Arguments after the program name minus -single and -exec pairs, requoted
+	std::wstring JoinForwardedArguments() const;
 
-	// Map storing argument name (lowercase) -> index in szArgList
-	std::map<std::wstring, uint64_t> Args;
+
+	// Map storing argument name (as typed, compared case-insensitively) -> index in szArgList
+	std::map<std::wstring, uint64_t, utf::NoCaseLess> Args;
 
 	// Pointer to array of argument strings (allocated by CommandLineToArgvW)
 	LPWSTR* szArgList;
@@ -101,6 +141,12 @@ private:
 
     class MemoryManagement* m_memory;
 
+	// Listens on kInstanceEndpoint while this process owns the single-instance mutex
+	UPtr<class ControlServer> m_instanceServer;
+
+	// -exec commands of this launch, run by the first Tick()
+	std::vector<std::string> m_pendingExec;
+
 public:
 	// Getter for m_console launched flag
 	inline bool GetbConsoleLaunched() const { return bConsoleLaunched; }
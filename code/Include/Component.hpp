@@ -0,0 +1,23 @@
+// Component.hpp
+// UI panels and other services as small components.
+//
+// A component is a final Master. App opens it during startup, has the
+// TickScheduler call its Tick() and closes it at shutdown. In Open() it
+// resolves pointers to the few services it uses and to the MemoryManagement
+// flag that shows it; it holds no MemoryManagement of its own.
+//
+// Being final lets the scheduler call Tick() through a function made for the
+// concrete type, with no vtable to load first.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "Master.hpp"
+
+namespace app {
+
+/** @brief What TickScheduler accepts: a Master whose Tick() cannot be overridden further */
+template <typename T>
+concept Component = std::is_base_of_v<Master, T> && std::is_final_v<T>;
+
+} // namespace app
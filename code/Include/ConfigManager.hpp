@@ -14,6 +14,9 @@ struct AppConfiguration {
 	float clearColorG;
 	float clearColorB;
 	float clearColorA;
+
+	// Archived console variables (name -> value), optional so older files still load
+	std::optional<std::map<std::string, std::string>> cvars;
 };
 
 class ConfigManager : public Master {
@@ -24,14 +27,20 @@ public:
 
 	virtual void Open() override;
 
+	// Same as Open(), reporting to the given streams instead of the console
+	void Open(std::wostream& out, std::wostream& err);
+
 	virtual void Tick() override;
 
 	virtual void Close() override;
 
-	bool LoadConfiguration();
+	bool LoadConfiguration(std::wostream& out = std::wcout, std::wostream& err = std::wcerr);
 
 	bool SaveConfiguration();
 
+	/** @brief Serializes now and writes the file from a job; for frequent saves such as autosave */
+	void SaveConfigurationAsync();
+
 	void SetClearColor(float r, float g, float b, float a);
 
 	void GetClearColor(float& r, float& g, float& b, float& a) const;
@@ -43,11 +52,26 @@ public:
 	void SetConfigFilePath(const std::wstring& path);
 
 private:
+	bool WriteJson(const std::string& jsonContent);
+
+	void WritePending();
+
 	AppConfiguration m_config;
 
 	std::wstring m_configFilePath;
 
 	bool m_bConfigLoaded;
+
+	// Set by Close(); the destructor only saves if Close() never ran
+	bool m_bClosed;
+
+	// Newest JSON waiting for the write job; only one such job is scheduled at a time
+	std::mutex	m_pendingMutex;
+	std::string m_pendingJson;
+	bool		m_bWriteScheduled;
+
+	// Serializes writes to the file between SaveConfiguration() and the job
+	std::mutex m_fileMutex;
 };
 
 } // namespace app
@@ -6,9 +6,22 @@
 
 #include "PCH.hpp"
 #include "Classes.hpp"
+#include "SpscRing.hpp"
+#include "Benchmark.hpp"
 namespace app {
-class ConsoleInputHandler : public Master {
+class ConsoleInputHandler final : public Master {
 public:
+	/**
+	 * @brief Line handed from the input thread to the main thread
+	 */
+	struct QueuedCommand {
+		std::string							  text;
+		std::chrono::steady_clock::time_point enqueued; // For input-to-execution latency
+		bool								  bProbe;	// Benchmark marker, never executed
+	};
+
+	using CommandRing = SpscRing<QueuedCommand, 1024>;
+
 	ConsoleInputHandler();
 
 	virtual ~ConsoleInputHandler();
@@ -19,12 +32,51 @@ public:
 
 	virtual void Close() override;
 
-	bool IsRunning() const { return m_bIsRunning; }
+	bool IsRunning() const { return m_reader->isRunning; }
 
 	void StopInputThread();
 
+	/**
+	 * @brief Measures producer-to-consumer hand-off latency through a CommandRing
+	 *
+	 * Uses a private ring and producer thread so it never competes with the
+	 * real input thread (the ring supports a single producer only).
+	 * @param iterations Number of probe commands to send
+	 */
+	BenchResult MeasureQueueLatency(uint32_t iterations);
+
 private:
-	void InputThreadFunction();
+	// Everything the reader thread touches; shared so a detached reader can
+	// outlive the handler (see StopInputThread())
+	struct ReaderState {
+		ReaderState();
+		~ReaderState();
+
+		std::atomic<bool> isRunning;
+		std::atomic<bool> shouldStop;
+
+		// Set by the reader right before it returns; StopInputThread() waits on it
+		std::atomic<bool> readerExited;
+
+#ifdef _WIN32
+		// ReadConsoleW() buffer, sized on the first console read and reused
+		std::vector<wchar_t> wideChunk;
+#else
+		// Self-pipe polled together with stdin to wake the reader on shutdown
+		int wakePipe[2];
+#endif
+
+		// Input thread -> main thread hand-off; wait-free on both sides
+		CommandRing commandRing;
+	};
+
+	static void InputThreadFunction(std::shared_ptr<ReaderState> state);
+
+	static bool IsInteractiveInput();
+
+	static bool ReadInputChunk(ReaderState& state, std::string& out);
+
+	static bool ConsumeInputChunk(ReaderState& state, const std::string& chunk, std::string& pending);
 
 	void ProcessCommand(const std::string& command);
 
@@ -38,15 +90,20 @@ private:
 
 	void ShowStatus();
 
-	std::thread m_inputThread;
+	/** @brief Moves every queued command into batch (consumer side) */
+	static void DrainRing(CommandRing& ring, std::vector<QueuedCommand>& batch);
 
-	std::atomic<bool> m_bIsRunning;
+	std::thread m_inputThread;
 
-	std::atomic<bool> m_bShouldStop;
+	std::shared_ptr<ReaderState> m_reader;
 
-	std::mutex m_commandMutex;
+	// Reused by Tick() so draining does not allocate
+	std::vector<QueuedCommand> m_batch;
 
-	std::queue<std::string> m_commandQueue;
+	// Input-to-execution latency of real commands (main thread only)
+	uint64_t m_commandsProcessed;
+	double	 m_lastLatencyUs;
+	double	 m_maxLatencyUs;
 
 	std::map<std::string, std::string> m_commandDescriptions;
 };
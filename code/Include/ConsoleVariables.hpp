@@ -0,0 +1,295 @@
+// ConsoleVariables.hpp
+// Typed console variables (cvars) that any subsystem can declare and the
+// console 'set' command can inspect and change at runtime.
+//
+// Reads are a single relaxed atomic load, so hot paths (the frame loop, AddLog,
+// Tick) can query a knob every frame without taking a lock. Variables flagged
+// with CVarFlags_Archive are persisted through ConfigManager.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "Utf.hpp"
+
+namespace app {
+
+/**
+ * @brief Value type stored by a console variable
+ */
+enum class CVarType : uint8_t { Bool, Int, Float, Enum, String };
+
+/**
+ * @brief Behaviour flags for console variables
+ */
+enum CVarFlags_ : uint32_t {
+	CVarFlags_None	   = 0,
+	CVarFlags_Archive  = 1 << 0, // Saved to / loaded from config.json
+	CVarFlags_ReadOnly = 1 << 1, // Visible in 'set' but cannot be changed from the console
+};
+
+/**
+ * @brief Base class for every console variable
+ *
+ * Derived classes own the actual (atomic) storage and register themselves
+ * with CVarRegistry at the end of their constructor, once FromString() is
+ * safe to call. They unregister at the start of their destructor, while
+ * ToString() can still be called to keep an archived value.
+ */
+class CVar {
+public:
+	CVar(const char* name, const char* description, CVarType type, uint32_t flags);
+	virtual ~CVar() = default;
+
+	CVar(const CVar&)			 = delete;
+	CVar& operator=(const CVar&) = delete;
+
+	/**
+	 * @brief Parses a textual value and stores it
+	 * @param value Text typed by the user or read from config.json
+	 * @return true if the value was valid and stored
+	 */
+	virtual bool FromString(std::string_view value) = 0;
+
+	/** @brief Current value as text */
+	virtual std::string ToString() const = 0;
+
+	/** @brief Default value as text */
+	virtual std::string DefaultToString() const = 0;
+
+	/** @brief Accepted range or option list, empty if unrestricted */
+	virtual std::string DescribeDomain() const { return {}; }
+
+	const std::string& GetName() const { return m_name; }
+	const std::string& GetDescription() const { return m_description; }
+	CVarType		   GetType() const { return m_type; }
+	uint32_t		   GetFlags() const { return m_flags; }
+	const char*		   GetTypeName() const;
+
+	/**
+	 * @brief Number of times the value changed since start-up
+	 *
+	 * Consumers that need to react to a change (e.g. reopen a file) cache this
+	 * counter and compare it each frame instead of registering callbacks. The
+	 * 'set' command and a config reload also publish ConfigChanged (EventBus.hpp)
+	 * for consumers that would rather not poll.
+	 */
+	uint32_t GetModificationCount() const { return m_modCount.load(std::memory_order_relaxed); }
+
+protected:
+	void MarkModified() { m_modCount.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+	std::string			  m_name;
+	std::string			  m_description;
+	CVarType			  m_type;
+	uint32_t			  m_flags;
+	std::atomic<uint32_t> m_modCount;
+};
+
+/**
+ * @brief Process-wide registry of console variables
+ *
+ * Lookups and registration are guarded by a mutex; they only happen when the
+ * user types a command or when the configuration is loaded/saved, never on
+ * the per-frame path.
+ */
+class CVarRegistry {
+public:
+	static CVarRegistry* Get_CVarRegistry_Singleton();
+
+	void  Register(CVar* cvar);
+	void  Unregister(CVar* cvar);
+	CVar* Find(std::string_view name) const;
+
+	/**
+	 * @brief Calls fn(const CVar&) for every registered variable, sorted by name
+	 */
+	template <typename Fn>
+	void ForEach(Fn&& fn) const {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const auto& [name, cvar] : m_cvars) fn(*cvar);
+	}
+
+	/**
+	 * @brief Applies archived values loaded from disk
+	 *
+	 * Values for variables that are not registered yet are kept and applied
+	 * as soon as the owning subsystem registers them.
+	 */
+	void LoadArchived(const std::map<std::string, std::string>& values);
+
+	/**
+	 * @brief Collects every archived variable as name -> text
+	 */
+	std::map<std::string, std::string> SaveArchived() const;
+
+private:
+	CVarRegistry() = default;
+
+	mutable std::mutex								m_mutex;
+	// Names are case-insensitive: "Log_Capacity" finds log_capacity
+	std::map<std::string, CVar*, utf::NoCaseLess>		m_cvars;
+	std::map<std::string, std::string, utf::NoCaseLess> m_pending; // Loaded before registration
+};
+
+/**
+ * @brief Boolean console variable (true/false/on/off/yes/no/1/0)
+ */
+class CVarBool : public CVar {
+public:
+	CVarBool(const char* name, bool defaultValue, const char* description,
+			 uint32_t flags = CVarFlags_Archive);
+	virtual ~CVarBool() override;
+
+	bool Get() const { return m_value.load(std::memory_order_relaxed); }
+	void Set(bool value);
+
+	virtual bool		FromString(std::string_view value) override;
+	virtual std::string ToString() const override;
+	virtual std::string DefaultToString() const override;
+	virtual std::string DescribeDomain() const override { return "on|off"; }
+
+private:
+	std::atomic<bool> m_value;
+	bool			  m_default;
+};
+
+/**
+ * @brief Numeric console variable clamped to [min, max]
+ * @tparam T int32_t or float
+ */
+template <typename T>
+class CVarNumeric : public CVar {
+	static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, float>,
+				  "CVarNumeric supports int32_t and float");
+
+public:
+	CVarNumeric(const char* name, T defaultValue, T minValue, T maxValue, const char* description,
+				uint32_t flags = CVarFlags_Archive) :
+	CVar(name, description, std::is_same_v<T, float> ? CVarType::Float : CVarType::Int, flags),
+	m_value(std::clamp(defaultValue, minValue, maxValue)),
+	m_default(std::clamp(defaultValue, minValue, maxValue)),
+	m_min(minValue),
+	m_max(maxValue) {
+		CVarRegistry::Get_CVarRegistry_Singleton()->Register(this);
+	}
+	virtual ~CVarNumeric() override { CVarRegistry::Get_CVarRegistry_Singleton()->Unregister(this); }
+
+	T	 Get() const { return m_value.load(std::memory_order_relaxed); }
+	T	 GetMin() const { return m_min; }
+	T	 GetMax() const { return m_max; }
+	void Set(T value) {
+		m_value.store(std::clamp(value, m_min, m_max), std::memory_order_relaxed);
+		MarkModified();
+	}
+
+	virtual bool FromString(std::string_view value) override {
+		T parsed{};
+		auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+		if (ec != std::errc() || ptr != value.data() + value.size()) return false;
+		// from_chars takes "nan" and "inf"; NaN would slip past the range check
+		if constexpr (std::is_same_v<T, float>) {
+			if (!std::isfinite(parsed)) return false;
+		}
+		if (parsed < m_min || parsed > m_max) return false;
+		Set(parsed);
+		return true;
+	}
+
+	virtual std::string ToString() const override { return Format(Get()); }
+	virtual std::string DefaultToString() const override { return Format(m_default); }
+	virtual std::string DescribeDomain() const override {
+		return Format(m_min) + ".." + Format(m_max);
+	}
+
+private:
+	static std::string Format(T value) {
+		char buf[32];
+		auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+		return std::string(buf, ptr);
+	}
+
+	std::atomic<T> m_value;
+	T			   m_default;
+	T			   m_min;
+	T			   m_max;
+};
+
+using CVarInt	= CVarNumeric<int32_t>;
+using CVarFloat = CVarNumeric<float>;
+
+/**
+ * @brief Enumerated console variable
+ *
+ * Stores the option index atomically; accepts either the option name
+ * (case-insensitive) or its index when set from text.
+ */
+class CVarEnum : public CVar {
+public:
+	CVarEnum(const char* name, std::initializer_list<const char*> options, int32_t defaultIndex,
+			 const char* description, uint32_t flags = CVarFlags_Archive);
+	virtual ~CVarEnum() override;
+
+	int32_t		Get() const { return m_index.load(std::memory_order_relaxed); }
+	const char* GetOptionName() const { return m_options[static_cast<size_t>(Get())]; }
+	void		Set(int32_t index);
+
+	virtual bool		FromString(std::string_view value) override;
+	virtual std::string ToString() const override;
+	virtual std::string DefaultToString() const override;
+	virtual std::string DescribeDomain() const override;
+
+private:
+	std::vector<const char*> m_options;
+	std::atomic<int32_t>	 m_index;
+	int32_t					 m_default;
+};
+
+/**
+ * @brief String console variable
+ *
+ * Strings cannot be swapped atomically, so reads take a short lock and return
+ * a copy. Avoid Get() in per-frame code; poll GetModificationCount() instead.
+ */
+class CVarString : public CVar {
+public:
+	CVarString(const char* name, const char* defaultValue, const char* description,
+			   uint32_t flags = CVarFlags_Archive);
+	virtual ~CVarString() override;
+
+	std::string Get() const;
+	void		Set(std::string_view value);
+
+	virtual bool		FromString(std::string_view value) override;
+	virtual std::string ToString() const override { return Get(); }
+	virtual std::string DefaultToString() const override { return m_default; }
+
+private:
+	mutable std::mutex m_mutex;
+	std::string		   m_value;
+	std::string		   m_default;
+};
+
+/**
+ * @brief Application-wide tuning knobs
+ *
+ * Subsystems may declare their own CVar objects in their translation units;
+ * these are the ones shared across several files.
+ */
+namespace cvars {
+extern CVarInt	  FrameCap;			// Max frames per second, 0 = unlimited
+extern CVarEnum	  PresentMode;		// Swap chain sync interval
+extern CVarFloat  FontSize;			// Base font size in pixels
+extern CVarInt	  LogCapacity;		// Max lines kept by ConsoleWindow
+extern CVarInt	  LogFlushMs;		// Milliseconds between log file flushes
+extern CVarInt	  PanelReleaseSeconds; // Closed tool windows are freed after this, 0 = never
+extern CVarInt	  JobWorkers;		   // Job system threads at startup, 0 = cores - 1
+extern CVarBool	  ConsoleAutoScroll;
+extern CVarBool	  ConsoleFileLogging;
+extern CVarString ConsoleLogFile;
+extern CVarString ControlEndpoint; // Local IPC endpoint name, empty = disabled
+extern CVarInt	  ConsoleQueueKb;  // Native console write-behind queue size
+extern CVarEnum	  ConsoleOverflow; // What to do when that queue is full
+} // namespace cvars
+
+} // namespace app
@@ -3,6 +3,10 @@
 #include "PCH.hpp"
 #include "Master.hpp"
 #include "ImWcharString.hpp"
+#include "StringPool.hpp"
+#include "Benchmark.hpp"
+#include "AnsiParser.hpp"
+#include "EventBus.hpp"
 
 //-----------------------------------------------------------------------------
 // [SECTION] Example App: Debug Console / ShowExampleAppConsole()
@@ -12,15 +16,34 @@
 // history. For the m_console example, we are using a more C++ like approach of declaring a class to
 // hold both data and functions.
 namespace app {
-class ConsoleWindow : public Master {
+
+/**
+ * @brief Start of a run of one color inside a console line
+ */
+struct ConsoleSpan {
+	int	  Begin; // Index into ConsoleItem::Text; the run ends where the next span begins
+	ImU32 Color; // 0 = default text color
+};
+
+/**
+ * @brief One console line with its colors resolved at insertion time
+ */
+struct ConsoleItem {
+	ImWchar*	 Text;		// Escape sequences already removed; owned (ImGui::MemAlloc)
+	int			 Length;	// In ImWchar, terminator excluded
+	ConsoleSpan* Spans;		// Owned; nullptr when the whole line has one color
+	int			 SpanCount;
+	ImU32		 Color;		// Whole-line color when Spans is nullptr; 0 = default
+};
+
+class ConsoleWindow final : public Master {
 private:
 ImWchar							 InputBuf[256];
-ImVector<ImWchar*>					 Items;
-ImVector<const ImWchar*>		 Commands;
-ImVector<ImWchar*>					 History;
+ImVector<ConsoleItem>				 Items;
+ImVector<StrId>					 Commands;
+std::vector<ImStr>					 History;
 int								 HistoryPos;
 ImGuiTextFilter					 Filter;
-bool							 AutoScroll;
 bool							 ScrollToBottom;
 std::map<std::wstring, uint64_t> m_MyCommmands;
 
@@ -33,6 +56,22 @@ std::map<std::wstring, uint64_t> m_MyCommmands;
 	// File logging
 	std::ofstream m_logFile;
 	std::wstring  m_logFilePath;
+	uint32_t	  m_logFileCVarVersion; // Last seen modification count of the log_file cvar
+
+	// In-process micro-benchmarks ('bench' command)
+	Benchmark m_bench;
+	// Lines from AddBenchNote(); a run's output goes to a scratch log that is discarded
+	std::vector<std::string> m_benchNotes;
+
+	// Output of the remote command being run, nullptr otherwise
+	std::string* m_pCapture;
+
+	// Colors of incoming text: ANSI state and the color set by the last [tag] line
+	AnsiParser			  m_ansi;
+	ImU32				  m_tagColor;
+	ImVector<ImWchar>	  m_itemText;  // Reused by AppendItem()
+	ImVector<ConsoleSpan> m_itemSpans; // Reused by AppendItem()
+	std::string			  m_plainText; // Reused by AppendItem() for the log file
 
 
 	class MemoryManagement*		m_memory;
@@ -40,10 +79,7 @@ std::map<std::wstring, uint64_t> m_MyCommmands;
 	class CommandLineArguments* m_cmdArgs;
 	class WindowManager*		m_window;
 	class FontManager*			m_font_manager;
-	class FontManagerWindow*	m_font_manager_window;
-	class DebugWindow*			m_debug_window;
 	class ConfigManager*		m_configManager;
-	class WindowClass*			m_window_obj;
 	class App*					m_App;
 	class ConsoleInputHandler*	m_ConsoleInputHandler;
 	class ConfigManager*		m_ConfigManager;
@@ -51,6 +87,8 @@ std::map<std::wstring, uint64_t> m_MyCommmands;
 	class DxDemos*				m_DxDemos;
 	class DX12Renderer*			m_DX12Renderer;
 	class FrameContext*			m_FrameContext;
+	class ControlServer*		m_ControlServer;
+	class FrameArena*			m_frameArena;
 
 public:
 	ConsoleWindow();
@@ -77,6 +115,22 @@ protected:
 	static void		Wcstrim(ImWchar* s);
 	static size_t	Wcslen(const ImWchar* s);
 
+	// Appends an owned line to Items, enforcing the log_capacity cvar
+	void PushItem(ConsoleItem item);
+
+	// Parses colors out of a UTF-8 line and appends it (also to the log file / capture)
+	void		AppendItem(std::string_view utf8);
+	static void FreeItem(ConsoleItem& item);
+
+	// Command dispatch and tab completion shared with the 'bench' command
+	void RunCommandLine(const std::string& full_command);
+	bool DispatchCommand(std::string_view command, const std::string& args);
+	void CollectCompletions(const char* word_start, const char* word_end,
+							ImVector<const char*>& out) const;
+	void RegisterBenchTargets();
+	// Like AddLog(), for a target's own report; shown after the run's results
+	void AddBenchNote(const char* fmt, ...) IM_FMTARGS(2);
+
 
 public:
 	void ClearLog();
@@ -95,16 +149,20 @@ public:
 	void CommandStatus();
 	void CommandBreak();
 	void CommandFonts();
+	void CommandSizes();
 
 	// Parameterized command handlers (with arguments)
 	void CommandEcho(const std::string& args);
 	void CommandSet(const std::string& args);
 	void CommandLog(const std::string& args);
+	void CommandBench(const std::string& args);
+	void CommandActivate(const std::string& args);
 
 	// AddLog overloads for different string types
 	void AddLog(const char* fmt, ...) IM_FMTARGS(2); // UTF-8 format string
 	void AddLog(const ImWchar* fmt, ...);			 // ImWchar format string
 	void AddLogW(const wchar_t* fmt, ...);			 // Windows wchar_t format string
+	void AddLine(std::string_view line);			 // Pre-formatted UTF-8 line, no '\n', may hold ANSI colors
 
 	// File logging control
 	void				EnableFileLogging(bool enable = true);
@@ -112,6 +170,10 @@ public:
 	bool				IsFileLoggingEnabled() const { return m_bEnableFileLogging; }
 	const std::wstring& GetLogFilePath() const { return m_logFilePath; }
 	void				FlushLogFile();
+	void				WriteLogFile(std::string_view text, bool newline);
+
+	// Reopens or closes the log file when 'log_file' / 'logging' are set
+	void OnConfigChanged(const ConfigChanged& event);
 
 	// Debug log flag helper
 	void ShowDebugLogFlag(const char* name, ImGuiDebugLogFlags flag);
@@ -119,6 +181,7 @@ public:
 
 	void Render(const char* title, bool* p_open);
 	void ExecMyCommand(const ImWchar* command_line);
+	void ExecRemoteCommand(const std::string& command_line, std::string& output);
 
 	// In C++11 you'd be better off using lambdas for this sort of forwarding callbacks
 	static int TextEditCallbackStub(ImGuiInputTextCallbackData* data);
@@ -0,0 +1,193 @@
+// ControlServer.hpp
+// Local control endpoint that lets other processes drive the console.
+//
+// Listens on a named pipe (\\.\pipe\<name>) on Windows or a Unix domain
+// socket (/tmp/<name>.sock) elsewhere. The endpoint is off by default and is
+// enabled with the 'control_endpoint' cvar, e.g. 'set control_endpoint imgui'.
+//
+// Protocol (one connection may pipeline any number of commands):
+//   client -> server : one command per line, '\n' terminated ('\r' ignored)
+//   server -> client : the lines the command logged, then a line with a
+//                      single '.'; output lines starting with '.' get an
+//                      extra '.' prepended (SMTP-style dot-stuffing)
+//
+// All socket / pipe I/O runs on a dedicated thread with non-blocking I/O
+// (an I/O completion port on Windows, poll() elsewhere). Commands are handed
+// to the main thread through an SpscRing and run by Tick() through the same
+// dispatch table as the ImGui console; responses travel back through a second
+// ring. The UI thread never waits on a client.
+//
+// Quick local test from PowerShell:
+//   $p = New-Object IO.Pipes.NamedPipeClientStream '.', 'imgui', 'InOut'
+//   $p.Connect(); $w = New-Object IO.StreamWriter $p; $r = New-Object IO.StreamReader $p
+//   $w.AutoFlush = $true; $w.WriteLine('status'); while (($l = $r.ReadLine()) -ne '.') { $l }
+
+#pragma once
+
+#include "PCH.hpp"
+#include "Master.hpp"
+#include "SpscRing.hpp"
+#include "Benchmark.hpp"
+
+namespace app {
+
+class ControlServer final : public Master {
+public:
+	/**
+	 * @param followCVar false for a server that only listens where Start() tells it
+	 *        (the single-instance endpoint) and ignores 'control_endpoint'
+	 */
+	explicit ControlServer(bool followCVar = true);
+	~ControlServer();
+
+	HRESULT Alloc();
+
+	virtual void Open() override;
+	virtual void Tick() override;
+	virtual void Close() override;
+
+	/**
+	 * @brief Starts listening on the given endpoint (stops a previous one first)
+	 * @param name Pipe / socket name; see ResolveEndpoint()
+	 * @return false if the name is invalid or the endpoint could not be created
+	 *         (e.g. already in use)
+	 */
+	bool Start(const std::string& name);
+
+	/** @brief Disconnects every client and stops the I/O thread */
+	void Stop();
+
+	bool			   IsListening() const { return m_bListening; }
+	const std::string& GetEndpoint() const { return m_endpoint; }
+	uint32_t		   GetClientCount() const { return m_clientCount.load(std::memory_order_relaxed); }
+	uint64_t		   GetCommandsServed() const { return m_commandsServed; }
+
+	/**
+	 * @brief Maps an endpoint name to the OS object name
+	 *
+	 * Windows: \\.\pipe\<name>. POSIX: /tmp/<name>.sock. Start() only accepts
+	 * names made of letters, digits, '_', '.' and '-'.
+	 */
+	static std::string ResolveEndpoint(const std::string& name);
+
+	/**
+	 * @brief Round-trip latency of 'echo' through the endpoint
+	 *
+	 * A client thread sends commands one at a time while the calling (main)
+	 * thread runs them, exactly as Tick() would. Uses a temporary endpoint if
+	 * none is open.
+	 */
+	BenchResult MeasureRoundTrip(uint32_t iterations);
+
+private:
+	struct Request {
+		uint32_t	client;
+		std::string line;
+	};
+
+	struct Response {
+		uint32_t	client;
+		std::string text; // Already framed (dot-stuffed, '.' terminated)
+	};
+
+	using RequestRing  = SpscRing<Request, 1024>;
+	using ResponseRing = SpscRing<Response, 1024>;
+
+	void ServerThreadFunction();
+
+	// Runs queued commands on the calling thread; returns how many ran
+	uint32_t ProcessRequests(uint32_t maxCommands);
+
+	// Queues a complete line received from a client (server thread)
+	void QueueRequest(uint32_t client, std::string&& line);
+	void FlushRequestBacklog();
+
+	// Wakes the I/O thread so it picks up responses or the stop flag
+	void Wake();
+
+	static void FrameResponse(const std::string& output, std::string& framed);
+
+	class ConsoleWindow* m_consoleWindow;
+	const bool			 m_bFollowCVar;
+
+	std::thread			  m_serverThread;
+	std::atomic<bool>	  m_bShouldStop;
+	std::atomic<bool>	  m_bListening;
+	std::atomic<uint32_t> m_clientCount;
+
+	std::string m_endpoint;			   // Name as given to Start()
+	uint32_t	m_endpointCVarVersion; // Last seen modification count of 'control_endpoint'
+
+	// Server thread -> main thread
+	UPtr<RequestRing>	m_requests;
+	std::deque<Request> m_requestBacklog; // Server thread only, used while the ring is full
+
+	// Main thread -> server thread
+	UPtr<ResponseRing>	 m_responses;
+	std::deque<Response> m_responseBacklog; // Main thread only, used while the ring is full
+
+	uint64_t m_commandsServed;
+
+#ifdef _WIN32
+	HANDLE m_iocp;		// Completion port for every pipe instance + wakeups
+	HANDLE m_firstPipe; // Created by Start() so errors surface synchronously
+#else
+	int m_listenSocket;
+	int m_wakePipe[2];
+#endif
+};
+
+/**
+ * @brief Minimal blocking client for the control endpoint
+ *
+ * Used by the round-trip benchmark and by single-instance mode to forward a
+ * second launch's arguments to the running instance.
+ */
+class ControlClient {
+public:
+	ControlClient();
+	~ControlClient();
+
+	ControlClient(const ControlClient&)			   = delete;
+	ControlClient& operator=(const ControlClient&) = delete;
+
+	/**
+	 * @brief Connects to a running ControlServer
+	 * @param name Endpoint name as passed to ControlServer::Start()
+	 * @param timeoutMs How long to wait for a free pipe instance
+	 */
+	bool Connect(const std::string& name, uint32_t timeoutMs = 1000);
+
+	/**
+	 * @brief Sends one command and waits for its complete output
+	 * @param output Receives the command's output lines ('\n' separated)
+	 */
+	bool Execute(const std::string& command, std::string& output);
+
+	/**
+	 * @brief Sends one command without waiting for its output
+	 *
+	 * The server still runs it; its response is dropped if the client has
+	 * disconnected by then. Call Flush() before disconnecting.
+	 */
+	bool Post(const std::string& command);
+
+	/** @brief Waits until the server has read everything sent so far */
+	void Flush();
+
+	void Disconnect();
+	bool IsConnected() const;
+
+private:
+	bool WriteAll(const char* data, size_t size);
+	bool ReadSome();
+
+#ifdef _WIN32
+	HANDLE m_pipe;
+#else
+	int m_socket;
+#endif
+	std::string m_inbox; // Bytes received but not yet returned
+};
+
+} // namespace app
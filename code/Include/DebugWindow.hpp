@@ -1,11 +1,13 @@
 #pragma once
 
 #include "PCH.hpp"
-#include "MemoryManagement.hpp"
+#include "Master.hpp"
 
 namespace app {
 
-class DebugWindow : public MemoryManagement {
+class FrameArena;
+
+class DebugWindow final : public Master {
 public:
 	DebugWindow();
 
@@ -18,8 +20,19 @@ public:
 	virtual void Tick() override;
 	virtual void Close() override;
 
+	/** @brief Reads the process memory counters shown by Render(); any thread, window or not */
+	static void SampleProcessMemory();
+
+#if APP_FEATURE_PROCESS_LAUNCHER
+	/** @brief A PowerShell or Python thread still points at this window */
+	bool IsBusy() const { return bPsOpen || bPyOpen; }
+#endif
+
 private:
 	void Render();
+
+#if APP_FEATURE_PROCESS_LAUNCHER
+	void RenderLauncher();
 	void openPowershell();
 	void openPy();
 
@@ -27,16 +40,25 @@ private:
 	void openPyTherad();
 
 	bool IsPsProcessRunning();
+#endif
 
 	ImGuiIO* m_io;
 
+#if APP_FEATURE_PROCESS_LAUNCHER
 	std::thread		  tPsTHread;
 	std::thread		  tPyTHread;
 	std::atomic<bool> bPsOpen;
 	std::atomic<bool> bPyOpen;
 	HANDLE			  hPsProcessHandle; // Armazena o handle do PowerShell
 	HANDLE			  hPyProcessHandle;
+#endif
+
+	bool*		m_shown;	  // MemoryManagement::m_bShow_Debug_window, set by Open()
+	FrameArena* m_frameArena; // Set by Open()
 
-    MemoryManagement* m_memory;
+	// Written by SampleProcessMemory() on the scheduler's background thread; outlive
+	// the window, which only exists while it is shown (see LazyPanel.hpp)
+	static inline std::atomic<uint64_t> s_workingSetBytes{0};
+	static inline std::atomic<uint64_t> s_privateBytes{0};
 };
 } // namespace app
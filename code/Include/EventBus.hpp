@@ -0,0 +1,141 @@
+// EventBus.hpp
+// Typed publish/subscribe for the few state changes other services react to.
+//
+// A service that changes shared state publishes an event once; whoever
+// depends on that state subscribes instead of comparing it every frame:
+// - ConsoleVisibilityChanged: the 'show'/'hide' commands
+// - StyleChanged: a style loaded from file or a preset applied
+// - FontLoaded: FontManager added fonts to the atlas
+// - ConfigChanged: a cvar set from the console, config.json reloaded or the
+//   clear color changed
+//
+// Publish() on the main thread calls the subscribers before it returns, so the
+// change shows in the frame that made it. From any other thread the event goes
+// into a lock-free queue that Dispatch() empties at the start of the next
+// frame (App schedules it in TickPhase::PreFrame), and subscribers still run on
+// the main thread. Until App names the main thread every event is queued.
+//
+// Subscribe() and Unsubscribe() are main-thread calls, outside of delivery. A
+// subscriber that can go away before the end of the program unsubscribes in
+// its destructor.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "MpscRing.hpp"
+
+namespace app {
+
+class CVar;
+
+struct ConsoleVisibilityChanged {
+	bool visible;
+};
+
+struct StyleChanged {
+	bool sizesReset; // Sizes came from the style file, unscaled; a preset only changes colors
+};
+
+struct FontLoaded {
+	int count; // Fonts added by this load
+};
+
+struct ConfigChanged {
+	const CVar* cvar; // The cvar that was set, or nullptr for a reload or ConfigManager's own settings
+};
+
+class EventBus {
+public:
+	using Event = std::variant<ConsoleVisibilityChanged, StyleChanged, FontLoaded, ConfigChanged>;
+
+	static constexpr size_t kEventCount = std::variant_size_v<Event>;
+
+	/** @brief Counters for the Debug window */
+	struct Stats {
+		uint64_t published; // All Publish() calls
+		uint64_t queued;	// Of those, published off the main thread
+		uint64_t overflowed; // Of those, the ring was full and they took the locked path
+	};
+
+	static EventBus* Get_EventBus_Singleton();
+
+	/** @brief Makes the calling thread the one that delivers; called once by App */
+	void BindToCurrentThread();
+
+	/** @brief Calls (object->*Method)(const E&) for every E published */
+	template <typename E, auto Method, typename T>
+	void Subscribe(T* object) {
+		AddSubscriber(IndexOf<E>(), object,
+					  [](void* self, const void* event) { (static_cast<T*>(self)->*Method)(*static_cast<const E*>(event)); });
+	}
+
+	/** @brief Calls function(const E&) for every E published */
+	template <typename E>
+	void Subscribe(void (*function)(const E&)) {
+		// The function pointer rides in the object slot
+		AddSubscriber(IndexOf<E>(), reinterpret_cast<void*>(function), [](void* self, const void* event) {
+			reinterpret_cast<void (*)(const E&)>(self)(*static_cast<const E*>(event));
+		});
+	}
+
+	/** @brief Removes every subscription made for object */
+	void Unsubscribe(const void* object);
+
+	/** @brief Delivers now on the main thread, at the next Dispatch() from any other */
+	template <typename E>
+	void Publish(const E& event) {
+		m_published.fetch_add(1, std::memory_order_relaxed);
+		if (std::this_thread::get_id() == m_mainThread.load(std::memory_order_acquire)) {
+			Deliver(IndexOf<E>(), &event);
+		} else {
+			Enqueue(Event(event));
+		}
+	}
+
+	/** @brief Delivers the events other threads published; main thread */
+	void Dispatch();
+
+	Stats GetStats() const;
+
+private:
+	EventBus();
+
+	template <typename E>
+	static constexpr size_t IndexOf() {
+		return IndexIn<E>(static_cast<Event*>(nullptr));
+	}
+
+	template <typename E, typename... Ts>
+	static constexpr size_t IndexIn(std::variant<Ts...>*) {
+		constexpr bool matches[] = {std::is_same_v<E, Ts>...};
+		for (size_t i = 0; i < sizeof...(Ts); ++i)
+			if (matches[i]) return i;
+		return sizeof...(Ts);
+	}
+
+	struct Subscriber {
+		void* object;
+		void  (*call)(void*, const void*);
+	};
+
+	void AddSubscriber(size_t index, void* object, void (*call)(void*, const void*));
+	void Deliver(size_t index, const void* event);
+	void Enqueue(Event&& event);
+
+	std::atomic<std::thread::id> m_mainThread;
+	std::vector<Subscriber>		 m_subscribers[kEventCount];
+	uint32_t					 m_delivering; // Nesting depth of Deliver(); main thread only
+
+	MpscRing<Event, 256> m_queue;
+	// Used once the ring is full, and by everyone after that until Dispatch()
+	// empties it, so events from one thread keep their order
+	std::mutex			 m_overflowMutex;
+	std::vector<Event>	 m_overflow;
+	std::atomic<bool>	 m_hasOverflow;
+
+	std::atomic<uint64_t> m_published;
+	std::atomic<uint64_t> m_queued;
+	std::atomic<uint64_t> m_overflowed;
+};
+
+} // namespace app
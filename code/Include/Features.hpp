@@ -0,0 +1,63 @@
+// Features.hpp
+// Optional subsystems, chosen when the program is compiled.
+//
+// Every feature is on by default. APP_MINIMAL=1 turns them all off, for the
+// kiosk build that only needs the render loop, the config files and the
+// console (msbuild /p:AppMinimal=true, see the project file). A single one can
+// also be set, e.g. APP_FEATURE_IMPLOT=0.
+//
+// A feature that is off leaves no code, data or startup step behind: its
+// translation units compile to nothing, its service is left out of
+// MemoryManagement::Services (so any remaining use of it is a compile error),
+// and App neither schedules nor offers it. Code that only needs to skip a few
+// statements tests the Features constants with if constexpr; code that names
+// the feature's types or functions needs the #if.
+//
+// Included by PCH.hpp, so it must not include anything itself.
+
+#pragma once
+
+#if defined(APP_MINIMAL) && APP_MINIMAL
+#define APP_FEATURE_DEFAULT 0
+#else
+#define APP_FEATURE_DEFAULT 1
+#endif
+
+// File system browser window (WindowClass)
+#ifndef APP_FEATURE_FILE_BROWSER
+#define APP_FEATURE_FILE_BROWSER APP_FEATURE_DEFAULT
+#endif
+
+// PowerShell / Python launcher buttons of the Debug window
+#ifndef APP_FEATURE_PROCESS_LAUNCHER
+#define APP_FEATURE_PROCESS_LAUNCHER APP_FEATURE_DEFAULT
+#endif
+
+// Font Manager window; the FontManager service that loads fonts always stays
+#ifndef APP_FEATURE_FONT_MANAGER_UI
+#define APP_FEATURE_FONT_MANAGER_UI APP_FEATURE_DEFAULT
+#endif
+
+// ImPlot context and plots (the memory history in the Debug window)
+#ifndef APP_FEATURE_IMPLOT
+#define APP_FEATURE_IMPLOT APP_FEATURE_DEFAULT
+#endif
+
+// ImGui demo, "Another Window", ImGui's style editor and DxDemos. The project
+// file also defines IMGUI_DISABLE_DEMO_WINDOWS for the minimal build, which
+// empties imgui_demo.cpp
+#ifndef APP_FEATURE_DEMO_WINDOWS
+#define APP_FEATURE_DEMO_WINDOWS APP_FEATURE_DEFAULT
+#endif
+
+namespace app {
+
+struct Features {
+	static constexpr bool FileBrowser	  = APP_FEATURE_FILE_BROWSER != 0;
+	static constexpr bool ProcessLauncher = APP_FEATURE_PROCESS_LAUNCHER != 0;
+	static constexpr bool FontManagerUI	  = APP_FEATURE_FONT_MANAGER_UI != 0;
+	static constexpr bool ImPlot		  = APP_FEATURE_IMPLOT != 0;
+	static constexpr bool DemoWindows	  = APP_FEATURE_DEMO_WINDOWS != 0;
+};
+
+} // namespace app
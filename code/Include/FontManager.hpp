@@ -3,6 +3,8 @@
 
 #pragma once	   // Prevent multiple inclusion of this header
 #include "PCH.hpp" // Include precompiled header with all necessary dependencies
+#include "MemoryTags.hpp"
+#include "StringPool.hpp"
 
 namespace app {
 // FontManager class - Manages ImGui font loading and switching
@@ -21,6 +23,16 @@ private:
 	// Key: Font name (e.g., "Arial"), Value: Pointer to ImFont
 	std::map<std::string, ImFont*> m_fontMap;
 
+	// Same fonts keyed by the StrId id of their name; GetFontByName() looks here
+	std::unordered_map<uint32_t, ImFont*> m_fontIndex;
+
+	// Font files read ahead by PreloadFontFiles(), keyed by path; kept for the
+	// life of the process because the atlas does not own the bytes
+	std::map<std::string, TaggedVector<uint8_t, MemTag::Fonts>> m_fileCache;
+
+	// Adds a font under name to both m_fontMap and m_fontIndex
+	void MapFont(const std::string& name, ImFont* font);
+
 public:
 	// Default constructor - initializes all members to nullptr/empty
 	FontManager();
@@ -33,6 +45,18 @@ public:
 	// Loads fonts from hardcoded paths (your original implementation)
 	void LoadFonts();
 
+	// Reads the system font files used by LoadFonts() and the default UI font
+	// into memory. Touches no ImGui state, so startup runs it on a worker thread
+	// while the window and the device are created; it must finish before the
+	// first AddFontFile() call.
+	void PreloadFontFiles();
+
+	// AddFontFromFileTTF that takes the bytes read by PreloadFontFiles() when it
+	// has them, so no file is read twice (or on the main thread)
+	// @return: The font, or nullptr if the file could not be loaded
+	ImFont* AddFontFile(const char* path, float sizePixels, const ImFontConfig* config = nullptr,
+						const ImWchar* ranges = nullptr);
+
 	// NEW: Scans a folder and loads all font files found
 	// @param folderPath: Path to the folder containing font files
 	// @return: Number of fonts successfully loaded
@@ -150,6 +174,9 @@ private:
 	// @param fontPath: Path to the font file
 	// @return: Pointer to loaded font, or nullptr if failed
 	ImFont* LoadSingleFont(const std::string& fontPath);
+
+	// Publishes FontLoaded once per load call, not per font
+	int PublishLoaded(int count);
 };
 
 } // namespace app
@@ -5,7 +5,8 @@
 
 #include "PCH.hpp"
 #include "FontManager.hpp"
-#include "MemoryManagement.hpp"
+#include "Master.hpp"
+#include "EventBus.hpp"
 
 namespace app {
 
@@ -14,7 +15,7 @@ namespace app {
 // ============================================================================
 
 // This class manages the ImGui UI with file/folder dialog buttons
-class FontManagerWindow : public MemoryManagement{
+class FontManagerWindow final : public Master {
 
 
 	// FontManager instance for managing fonts
@@ -38,12 +39,18 @@ class FontManagerWindow : public MemoryManagement{
 	// Counter for total fonts loaded
 	int m_totalFontsLoaded;
 
-    MemoryManagement* m_memory;
+	bool* m_shown; // MemoryManagement::m_bShow_FontManager_window, set by Open()
+
+	// A folder search is running as a job
+	bool m_searching;
 
 
     // Main render function - called every frame to draw the UI
     void Render();
 
+	// Adds up the fonts loaded while the window exists
+	void OnFontLoaded(const FontLoaded& event);
+
 public:
 	FontManagerWindow();
 
@@ -61,6 +68,9 @@ public:
 	// Method to display a font preview m_window (bonus feature)
 	void RenderFontPreview();
 
+	// A search job still has to hand its result back; see LazyPanel.hpp
+	bool IsBusy() const { return m_searching; }
+
 	bool bShowFontPreview;
 
 	bool bFonstsWereLoaded;
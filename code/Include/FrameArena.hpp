@@ -0,0 +1,135 @@
+// FrameArena.hpp
+// Per-frame linear allocator for transient strings and buffers.
+//
+// UI code builds many short-lived strings every frame (labels, UTF-8 copies of
+// wide text, formatted values). FrameArena hands out memory by bumping an
+// offset and throws everything away at once in BeginFrame(), which App calls
+// right before ImGui::NewFrame(). It has two buffers and alternates between
+// them, so memory from the previous frame stays valid until the end of the
+// current one.
+//
+// When a frame needs more than the buffer holds, the extra comes from the ImGui
+// heap; the next time that buffer is reset it is replaced by one large enough
+// for the whole frame. After a few frames the buffers fit the workload and
+// resetting them is just zeroing an offset.
+//
+// FrameArena is a std::pmr::memory_resource, so std::pmr containers can use it
+// directly; deallocation is a no-op. It belongs to the main thread.
+//
+// HeapProbe proves the point in debug builds: it counts operator new calls
+// made inside the scopes that are supposed to use the arena instead, and the
+// Debug window shows the count for the last frame.
+
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+
+class FrameArena final : public std::pmr::memory_resource {
+public:
+	/** @brief Size of a buffer before its first growth */
+	static constexpr size_t kInitialBytes = 64 * 1024;
+
+	/** @brief Usage of one frame, published by BeginFrame() */
+	struct FrameStats {
+		size_t	 peakBytes;	 // Most bytes in use at once
+		size_t	 capacity;	 // Buffer size at the start of the frame
+		uint32_t overflows;	 // Allocations that did not fit the buffer
+		uint64_t heapAllocs; // operator new calls inside HeapProbe scopes (debug builds)
+	};
+
+	/** @brief Position returned by Mark(); Rewind() frees everything allocated after it */
+	struct Marker {
+		void*  block;
+		size_t blockUsed;
+		size_t used;
+	};
+
+	/**
+	 * @brief Counts heap allocations made on this thread while in scope
+	 *
+	 * Wrap code that should only allocate from the arena. Compiles to nothing
+	 * outside debug builds.
+	 */
+	class HeapProbe {
+	public:
+		explicit HeapProbe(FrameArena& arena);
+		~HeapProbe();
+
+		HeapProbe(const HeapProbe&)			   = delete;
+		HeapProbe& operator=(const HeapProbe&) = delete;
+
+	private:
+#ifdef _DEBUG
+		FrameArena& m_arena;
+		uint64_t	m_start;
+#endif
+	};
+
+	FrameArena();
+	~FrameArena() override;
+
+	FrameArena(const FrameArena&)			 = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+	/**
+	 * @brief Starts a frame: switches buffers and releases the one from two frames ago
+	 *
+	 * O(1) unless that buffer overflowed, in which case it is replaced by one
+	 * that fits.
+	 */
+	void BeginFrame();
+
+	/** @brief Uninitialized memory valid until the BeginFrame() after next */
+	void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+		return do_allocate(bytes, alignment);
+	}
+
+	Marker Mark() const;
+
+	/** @brief Frees everything allocated since mark, if it all came from the same block */
+	void Rewind(const Marker& mark);
+
+	/** @brief Empty string that grows inside the arena */
+	std::pmr::string String() { return std::pmr::string(this); }
+
+	/** @brief vsnprintf into the arena; always null-terminated */
+	const char* Printf(const char* fmt, ...) IM_FMTARGS(2);
+
+	/** @brief parts joined into the arena; the view is null-terminated */
+	std::string_view Concat(std::initializer_list<std::string_view> parts);
+
+	/** @brief UTF-8 copy of wide text in the arena; the view is null-terminated */
+	template <typename Unit>
+	std::string_view Utf8(const Unit* text, size_t length);
+	std::string_view Utf8(std::wstring_view text) { return Utf8(text.data(), text.size()); }
+
+	const FrameStats& GetLastFrameStats() const { return m_lastFrame; }
+
+private:
+	struct alignas(std::max_align_t) Block {
+		Block* next;
+		size_t size;
+		size_t used;
+	};
+
+	void* do_allocate(size_t bytes, size_t alignment) override;
+	void  do_deallocate(void*, size_t, size_t) override {}
+	bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+	// Gives back the end of the newest allocation, which must be size bytes at ptr
+	void Trim(char* ptr, size_t size, size_t newSize);
+
+	static Block* NewBlock(size_t size);
+	static void	  FreeBlocks(Block* block);
+
+	Block*	 m_buffers[2]; // Newest block first; more than one means the buffer overflowed
+	uint32_t m_current;
+	size_t	 m_used; // Bytes used in the current buffer, padding included
+
+	FrameStats m_frame;
+	FrameStats m_lastFrame;
+};
+
+} // namespace app
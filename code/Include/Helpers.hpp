@@ -14,11 +14,23 @@ class Helpers {
 
         static  int UnkExcpt();
 
+        // Case folding (app::utf::FoldCase): Unicode-aware, never lengthens the text
+
         static std::string strtoLower(std::string s);
 
         static std::wstring strtoLowerW(std::wstring s);
 
+        static void ToLowerInPlace(std::string& s);
+        static void ToLowerInPlace(std::wstring& s);
+
+        // Folds a null-terminated UTF-8 string in place
         static void charToLower(char* c);
+
+        // Returns a per-thread buffer, valid until the next call on the same thread
         static const char* constCharToLower(const char* c);
+
+        // Writes content to path + ".tmp", then renames it over path, so an exit
+        // in the middle of the write leaves the old file intact
+        static bool WriteFileAtomic(const std::wstring& path, std::string_view content);
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "PCH.hpp"
+#include "StringPool.hpp"
 
 namespace app {
 
@@ -74,6 +75,60 @@ public:
         else
             return ImVec4(1.0f, 1.0f, 1.0f, 1.0f);  // Default white
     }
+
+    // Find the color a console line selects with a [tag] (or a "# " prefix).
+    // The color stays in effect for the following lines until a "[reset]" line.
+    // Returns false if the line has no tag; reset is set for "[reset]".
+    static bool FindLineTag(const char* line, ImVec4& color, bool& reset) {
+        // Same precedence the console has always used. The tags are interned
+        // once; every "[...]" in the line is looked up in the pool and compared
+        // by id instead of searching the line once per tag.
+        constexpr size_t kTagCount = 21;
+        struct TagTable {
+            StrId  reset;
+            StrId  ids[kTagCount];
+            ImVec4 colors[kTagCount];
+
+            TagTable() : reset("[reset]") {
+                static const char* const tags[kTagCount] = {
+                    "[error]", "[red]", "[warning]", "[yellow]", "[success]", "[green]",
+                    "[info]", "[blue]", "[cyan]", "[cmd]", "[history]", "[magenta]",
+                    "[grey]", "[white]", "[bright_red]", "[bright_green]", "[bright_yellow]",
+                    "[bright_blue]", "[bright_magenta]", "[bright_cyan]", "[bright_white]"};
+                for(size_t i = 0; i < kTagCount; i++) {
+                    ids[i]    = StrId(tags[i]);
+                    colors[i] = TagToColor(tags[i]);
+                }
+            }
+        };
+        static const TagTable table;
+
+        reset = false;
+        size_t best = kTagCount;
+        for(const char* open = strchr(line, '['); open; open = strchr(open + 1, '[')) {
+            const char* close = strchr(open + 1, ']');
+            if(!close) break; // No later '[' can be closed either
+            const uint32_t id = StringPool::Get_StringPool_Singleton()->Find(
+                std::string_view(open, static_cast<size_t>(close - open) + 1));
+            if(id == table.reset.GetId()) {
+                reset = true;
+                return true;
+            }
+            for(size_t i = 0; i < best; i++) {
+                if(table.ids[i].GetId() == id) {
+                    best = i;
+                    break;
+                }
+            }
+        }
+        if(best < kTagCount) {
+            color = table.colors[best];
+            return true;
+        }
+        if(strncmp(line, "# ", 2) != 0) return false;
+        color = ImVec4(1.0f, 0.8f, 0.4f, 1.0f);  // Orange
+        return true;
+    }
 };
 
 // ImGui termcolor namespace - provides termcolor-like manipulators for ImGui console
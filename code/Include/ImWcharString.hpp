@@ -1,145 +1,266 @@
 #pragma once
 
 #include "PCH.hpp"
+#include "Utf.hpp"
 
 namespace app {
 
+/**
+ * @brief Bump allocator for strings that die together (one frame, one command).
+ *
+ * Allocating is a pointer bump inside blocks taken from ImGui::MemAlloc;
+ * nothing is freed until Reset() or destruction, which invalidate every
+ * string allocated from the arena at once.
+ */
+class ImStrArena {
+public:
+    explicit ImStrArena(size_t blockBytes = 4096)
+        : m_blocks(nullptr), m_blockBytes(blockBytes), m_bytesUsed(0) {}
+
+    ~ImStrArena() { FreeBlocks(m_blocks); }
+
+    ImStrArena(const ImStrArena&) = delete;
+    ImStrArena& operator=(const ImStrArena&) = delete;
+
+    /**
+     * @brief Returns 8-byte aligned memory valid until Reset().
+     */
+    void* Allocate(size_t bytes) {
+        bytes = (bytes + 7) & ~size_t(7);
+        Block* block = m_blocks;
+        if (!block || block->used + bytes > block->size) {
+            const size_t size = bytes > m_blockBytes ? bytes : m_blockBytes;
+            block = (Block*)ImGui::MemAlloc(sizeof(Block) + size);
+            IM_ASSERT(block);
+            block->next = m_blocks;
+            block->size = size;
+            block->used = 0;
+            m_blocks = block;
+        }
+        void* ptr = reinterpret_cast<char*>(block + 1) + block->used;
+        block->used += bytes;
+        m_bytesUsed += bytes;
+        return ptr;
+    }
+
+    /**
+     * @brief Releases everything allocated so far, keeping the newest block for reuse.
+     */
+    void Reset() {
+        if (!m_blocks) return;
+        FreeBlocks(m_blocks->next);
+        m_blocks->next = nullptr;
+        m_blocks->used = 0;
+        m_bytesUsed = 0;
+    }
+
+    /**
+     * @brief Bytes handed out since the last Reset().
+     */
+    size_t GetBytesUsed() const { return m_bytesUsed; }
+
+private:
+    struct Block {
+        Block* next;
+        size_t size;
+        size_t used;
+        // Data follows
+    };
+
+    static void FreeBlocks(Block* block) {
+        while (block) {
+            Block* next = block->next;
+            ImGui::MemFree(block);
+            block = next;
+        }
+    }
+
+    Block* m_blocks; // Newest first
+    size_t m_blockBytes;
+    size_t m_bytesUsed;
+};
+
 /**
  * @brief RAII wrapper for ImWchar* strings with automatic memory management.
- * 
- * This class provides safe management of ImWchar strings allocated with ImGui::MemAlloc,
- * preventing memory leaks through automatic cleanup and providing convenient string operations.
- * 
+ *
+ * Strings of up to kInlineCapacity characters - command names, tags, most
+ * history entries - live inside the object and never allocate. Longer ones
+ * go to ImGui::MemAlloc, or to an ImStrArena when one is given, in which case
+ * the arena owns the memory and the string must not outlive its next Reset().
+ * Copies never inherit the source's arena, so a copy is always safe to keep.
+ *
  * Features:
  * - Automatic memory management (RAII)
+ * - Inline storage for short strings
+ * - Optional arena allocation for bulk lifetimes
  * - Move semantics support
  * - Conversion from various string types
- * - Safe copy operations
  * - Comparison operators
  * - Length tracking for performance
  */
 class ImStr {
+public:
+    static constexpr size_t kInlineCapacity = 15; // Characters stored without allocating
+
 private:
-    ImWchar* m_data;
-    size_t   m_length; // Cached length (excluding null terminator)
+    union {
+        ImWchar* m_heap;                        // length > kInlineCapacity
+        ImWchar  m_inline[kInlineCapacity + 1]; // Otherwise; null-terminated
+    };
+    size_t      m_length; // Cached length (excluding null terminator)
+    ImStrArena* m_arena;  // Owns m_heap when set; nothing to free here
 
     /**
-     * @brief Internal helper to calculate string length.
+     * @brief Points the string at room for length characters plus the terminator.
+     * @return Buffer the caller fills (terminator included).
      */
-    static size_t CalcLength(const ImWchar* str) {
-        if (!str) return 0;
-        size_t len = 0;
-        while (str[len]) len++;
-        return len;
+    ImWchar* Allocate(size_t length, ImStrArena* arena) {
+        m_length = length;
+        m_arena = nullptr;
+        if (length <= kInlineCapacity) return m_inline;
+
+        const size_t bytes = (length + 1) * sizeof(ImWchar);
+        if (arena) {
+            m_arena = arena;
+            m_heap = (ImWchar*)arena->Allocate(bytes);
+        } else {
+            m_heap = (ImWchar*)ImGui::MemAlloc(bytes);
+        }
+        IM_ASSERT(m_heap);
+        return m_heap;
     }
 
     /**
-     * @brief Internal helper to duplicate ImWchar string.
+     * @brief Frees the buffer (if owned) and leaves the string empty.
      */
-    static ImWchar* Duplicate(const ImWchar* str, size_t len) {
-        if (!str || len == 0) return nullptr;
-        size_t allocSize = (len + 1) * sizeof(ImWchar);
-        ImWchar* buf = (ImWchar*)ImGui::MemAlloc(allocSize);
-        IM_ASSERT(buf);
-        memcpy(buf, str, len * sizeof(ImWchar));
-        buf[len] = 0; // Null terminator
-        return buf;
+    void Free() {
+        if (!IsInline() && !m_arena) ImGui::MemFree(m_heap);
+        m_length = 0;
+        m_arena = nullptr;
+        m_inline[0] = 0;
+    }
+
+    void Assign(const ImWchar* str, size_t length, ImStrArena* arena) {
+        ImWchar* buf = Allocate(length, arena);
+        if (length) memcpy(buf, str, length * sizeof(ImWchar));
+        buf[length] = 0;
+    }
+
+    void AssignUtf8(const char* utf8_str, size_t bytes, ImStrArena* arena) {
+        const size_t length = utf::WideLengthFromUtf8<ImWchar>(utf8_str, bytes);
+        ImWchar* buf = Allocate(length, arena);
+        utf::Utf8ToWide(utf8_str, bytes, buf, length);
+        buf[length] = 0;
+    }
+
+    /**
+     * @brief Takes other's buffer (or copies its inline text); other becomes empty.
+     */
+    void Steal(ImStr& other) {
+        m_length = other.m_length;
+        m_arena = other.m_arena;
+        if (other.IsInline()) {
+            memcpy(m_inline, other.m_inline, (m_length + 1) * sizeof(ImWchar));
+        } else {
+            m_heap = other.m_heap;
+        }
+        other.m_length = 0;
+        other.m_arena = nullptr;
+        other.m_inline[0] = 0;
     }
 
 public:
     /**
      * @brief Default constructor - creates empty string.
      */
-    ImStr() : m_data(nullptr), m_length(0) {}
+    ImStr() : m_length(0), m_arena(nullptr) { m_inline[0] = 0; }
 
     /**
      * @brief Construct from ImWchar* (takes ownership - does NOT copy).
      * @param data The ImWchar* to take ownership of (must be allocated with ImGui::MemAlloc).
+     * @note A string short enough to be stored inline is copied and data is freed right away.
      */
-    explicit ImStr(ImWchar* data) : m_data(data), m_length(CalcLength(data)) {}
+    explicit ImStr(ImWchar* data) : m_length(utf::Length(data)), m_arena(nullptr) {
+        if (!IsInline()) {
+            m_heap = data;
+            return;
+        }
+        m_inline[0] = 0;
+        if (data) {
+            memcpy(m_inline, data, (m_length + 1) * sizeof(ImWchar));
+            ImGui::MemFree(data);
+        }
+    }
 
     /**
      * @brief Construct by copying from const ImWchar*.
      * @param str The ImWchar string to copy from.
+     * @param arena Where to allocate if the string does not fit inline (nullptr: ImGui heap).
      */
-    ImStr(const ImWchar* str) {
-        m_length = CalcLength(str);
-        m_data = Duplicate(str, m_length);
+    ImStr(const ImWchar* str, ImStrArena* arena = nullptr) {
+        Assign(str, utf::Length(str), arena);
+    }
+
+    ImStr(const ImWchar* str, size_t length, ImStrArena* arena = nullptr) {
+        Assign(str, length, arena);
     }
 
     /**
      * @brief Construct from UTF-8 string.
      * @param utf8_str The UTF-8 string to convert.
+     * @param arena Where to allocate if the string does not fit inline (nullptr: ImGui heap).
      */
-    ImStr(const char* utf8_str) {
-        if (!utf8_str || utf8_str[0] == '\0') {
-            m_data = nullptr;
-            m_length = 0;
-            return;
-        }
+    ImStr(const char* utf8_str, ImStrArena* arena = nullptr) {
+        AssignUtf8(utf8_str, utf8_str ? strlen(utf8_str) : 0, arena);
+    }
 
-        // Allocate buffer for conversion (estimate size)
-        size_t estimated_len = strlen(utf8_str) + 1;
-        ImWchar* buf = (ImWchar*)ImGui::MemAlloc(estimated_len * sizeof(ImWchar));
-        IM_ASSERT(buf);
-        
-        const char* str_end = nullptr;
-        ImTextStrFromUtf8(buf, (int)estimated_len, utf8_str, nullptr, &str_end);
-        
-        m_data = buf;
-        m_length = CalcLength(buf);
+    ImStr(std::string_view utf8_str, ImStrArena* arena = nullptr) {
+        AssignUtf8(utf8_str.data(), utf8_str.size(), arena);
     }
 
     /**
      * @brief Construct from std::string (UTF-8).
      */
-    ImStr(const std::string& str) : ImStr(str.c_str()) {}
+    ImStr(const std::string& str, ImStrArena* arena = nullptr)
+        : ImStr(std::string_view(str), arena) {}
 
     /**
      * @brief Construct from std::wstring.
      */
-    ImStr(const std::wstring& wstr) {
-        if (wstr.empty()) {
-            m_data = nullptr;
-            m_length = 0;
-            return;
-        }
-
-        m_length = wstr.length();
-        m_data = (ImWchar*)ImGui::MemAlloc((m_length + 1) * sizeof(ImWchar));
-        IM_ASSERT(m_data);
-        
+    ImStr(const std::wstring& wstr, ImStrArena* arena = nullptr) {
+        ImWchar* buf = Allocate(wstr.length(), arena);
         for (size_t i = 0; i < m_length; i++) {
-            m_data[i] = (ImWchar)wstr[i];
+            buf[i] = (ImWchar)wstr[i];
         }
-        m_data[m_length] = 0;
+        buf[m_length] = 0;
     }
 
     /**
-     * @brief Copy constructor.
+     * @brief Copy constructor (heap or inline, never the source's arena).
      */
     ImStr(const ImStr& other) {
-        m_length = other.m_length;
-        m_data = Duplicate(other.m_data, m_length);
+        Assign(other.c_str(), other.m_length, nullptr);
+    }
+
+    /**
+     * @brief Copy into an arena.
+     */
+    ImStr(const ImStr& other, ImStrArena* arena) {
+        Assign(other.c_str(), other.m_length, arena);
     }
 
     /**
      * @brief Move constructor.
      */
-    ImStr(ImStr&& other) noexcept 
-        : m_data(other.m_data), m_length(other.m_length) {
-        other.m_data = nullptr;
-        other.m_length = 0;
+    ImStr(ImStr&& other) noexcept {
+        Steal(other);
     }
 
     /**
      * @brief Destructor - automatically frees memory.
      */
     ~ImStr() {
-        if (m_data) {
-            ImGui::MemFree(m_data);
-            m_data = nullptr;
-        }
+        Free();
     }
 
     /**
@@ -147,9 +268,8 @@ public:
      */
     ImStr& operator=(const ImStr& other) {
         if (this != &other) {
-            if (m_data) ImGui::MemFree(m_data);
-            m_length = other.m_length;
-            m_data = Duplicate(other.m_data, m_length);
+            Free();
+            Assign(other.c_str(), other.m_length, nullptr);
         }
         return *this;
     }
@@ -159,11 +279,8 @@ public:
      */
     ImStr& operator=(ImStr&& other) noexcept {
         if (this != &other) {
-            if (m_data) ImGui::MemFree(m_data);
-            m_data = other.m_data;
-            m_length = other.m_length;
-            other.m_data = nullptr;
-            other.m_length = 0;
+            Free();
+            Steal(other);
         }
         return *this;
     }
@@ -172,38 +289,50 @@ public:
      * @brief Assign from UTF-8 string.
      */
     ImStr& operator=(const char* utf8_str) {
-        *this = ImStr(utf8_str);
+        Free();
+        AssignUtf8(utf8_str, utf8_str ? strlen(utf8_str) : 0, nullptr);
         return *this;
     }
 
     /**
-     * @brief Get raw pointer (const).
+     * @brief Get raw pointer (const); never nullptr.
      */
-    const ImWchar* c_str() const { 
-        static const ImWchar empty[1] = {0};
-        return m_data ? m_data : empty; 
+    const ImWchar* c_str() const {
+        return IsInline() ? m_inline : m_heap;
     }
 
     /**
-     * @brief Get raw pointer (non-const).
+     * @brief Get raw pointer (non-const); never nullptr.
      */
-    ImWchar* data() { return m_data; }
+    ImWchar* data() { return IsInline() ? m_inline : m_heap; }
 
     /**
-     * @brief Release ownership of the internal pointer.
-     * @return The internal ImWchar* (caller is responsible for freeing).
+     * @brief Release ownership of the text.
+     * @return An ImGui::MemAlloc'd string the caller frees, nullptr if empty.
+     *         Heap strings are handed over; inline and arena strings are duplicated.
      */
     ImWchar* release() {
-        ImWchar* ptr = m_data;
-        m_data = nullptr;
+        if (empty()) return nullptr;
+
+        ImWchar* ptr;
+        if (!IsInline() && !m_arena) {
+            ptr = m_heap;
+        } else {
+            const size_t bytes = (m_length + 1) * sizeof(ImWchar);
+            ptr = (ImWchar*)ImGui::MemAlloc(bytes);
+            IM_ASSERT(ptr);
+            memcpy(ptr, c_str(), bytes);
+        }
         m_length = 0;
+        m_arena = nullptr;
+        m_inline[0] = 0;
         return ptr;
     }
 
     /**
      * @brief Check if string is empty.
      */
-    bool empty() const { return m_length == 0 || m_data == nullptr; }
+    bool empty() const { return m_length == 0; }
 
     /**
      * @brief Get string length (cached, O(1)).
@@ -215,27 +344,37 @@ public:
      */
     size_t size() const { return m_length; }
 
+    /**
+     * @brief True when the text is stored in the object itself.
+     */
+    bool IsInline() const { return m_length <= kInlineCapacity; }
+
+    /**
+     * @brief Arena owning the text, nullptr for inline and heap strings.
+     */
+    ImStrArena* GetArena() const { return m_arena; }
+
     /**
      * @brief Convert to UTF-8 std::string.
      */
     std::string toUtf8() const {
-        if (!m_data || m_length == 0) return std::string();
-        
-        char buf[1024];
-        ImTextStrToUtf8(buf, sizeof(buf), m_data, nullptr);
-        return std::string(buf);
+        if (m_length == 0) return std::string();
+
+        std::string out(utf::Utf8LengthFromWide(c_str(), m_length), '\0');
+        utf::WideToUtf8(c_str(), m_length, out.data(), out.size());
+        return out;
     }
 
     /**
      * @brief Convert to std::wstring.
      */
     std::wstring toWstring() const {
-        if (!m_data || m_length == 0) return std::wstring();
-        
-        std::wstring result;
-        result.reserve(m_length);
+        if (m_length == 0) return std::wstring();
+
+        const ImWchar* text = c_str();
+        std::wstring result(m_length, L'\0');
         for (size_t i = 0; i < m_length; i++) {
-            result += (wchar_t)m_data[i];
+            result[i] = (wchar_t)text[i];
         }
         return result;
     }
@@ -244,13 +383,9 @@ public:
      * @brief Case-insensitive comparison.
      */
     int compareNoCase(const ImStr& other) const {
-        if (!m_data && !other.m_data) return 0;
-        if (!m_data) return -1;
-        if (!other.m_data) return 1;
-        
-        const ImWchar* s1 = m_data;
-        const ImWchar* s2 = other.m_data;
-        
+        const ImWchar* s1 = c_str();
+        const ImWchar* s2 = other.c_str();
+
         while (*s1 && *s2) {
             ImWchar c1 = (*s1 >= 'A' && *s1 <= 'Z') ? *s1 + 32 : *s1;
             ImWchar c2 = (*s2 >= 'A' && *s2 <= 'Z') ? *s2 + 32 : *s2;
@@ -262,17 +397,11 @@ public:
     }
 
     /**
-     * @brief Comparison operators.
+     * @brief Comparison operators (length check, then one memcmp).
      */
     bool operator==(const ImStr& other) const {
-        if (m_length != other.m_length) return false;
-        if (!m_data && !other.m_data) return true;
-        if (!m_data || !other.m_data) return false;
-        
-        for (size_t i = 0; i < m_length; i++) {
-            if (m_data[i] != other.m_data[i]) return false;
-        }
-        return true;
+        return m_length == other.m_length &&
+               memcmp(c_str(), other.c_str(), m_length * sizeof(ImWchar)) == 0;
     }
 
     bool operator!=(const ImStr& other) const {
@@ -0,0 +1,192 @@
+// JobSystem.hpp
+// Work-stealing thread pool for short background jobs.
+//
+// A subsystem hands a job to Schedule() and the pool runs it on one of its
+// worker threads; nothing outside this file creates or joins a thread for it.
+// Each worker keeps its own deque: jobs scheduled from a job go onto the
+// running worker's deque, which it works through newest first while idle
+// workers steal the oldest from the other end. Jobs scheduled from any other
+// thread go into a shared queue.
+//
+// A JobCounter counts the jobs scheduled against it that have not finished
+// yet. A job may also wait for a counter: it is held back until that counter
+// reaches zero, then scheduled like any other. Wait() runs jobs on the calling
+// thread until a counter is done, so fanning out and joining from a job, or
+// from a benchmark, keeps every thread busy.
+//
+// Jobs do not touch ImGui or the services' UI state. Work whose result the UI
+// needs ends with RunOnMainThread(); App runs those continuations at the start
+// of the next frame (TickPhase::PreFrame). An object whose jobs can still call
+// back into it must stay alive until they have; a panel says so with IsBusy()
+// (see LazyPanel.hpp).
+//
+// Jobs are short. Threads that block for a long time - the stdin reader, the
+// control endpoint, a launched process - keep their own std::thread.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "Benchmark.hpp"
+
+namespace app {
+
+class JobSystem;
+
+namespace detail {
+struct Job; // A scheduled JobFn and its counter; defined in JobSystem.cpp
+}
+
+/** @brief Number of scheduled jobs that have not finished yet */
+class JobCounter {
+public:
+	JobCounter() : m_state(0), m_mutex(), m_waiting() {}
+	~JobCounter() { IM_ASSERT(IsDone() && "JobCounter destroyed while its jobs are pending"); }
+
+	JobCounter(const JobCounter&)			 = delete;
+	JobCounter& operator=(const JobCounter&) = delete;
+
+	/** @brief No job pending and none still being released; the counter may then be destroyed */
+	bool	 IsDone() const { return m_state.load(std::memory_order_acquire) == 0; }
+	uint32_t GetPending() const { return static_cast<uint32_t>(m_state.load(std::memory_order_relaxed) & kPendingMask); }
+
+private:
+	friend class JobSystem;
+
+	static constexpr uint64_t kPendingMask = 0xFFFFFFFFull;
+	static constexpr uint64_t kReleasing   = 1ull << 32;
+
+	// Low half: jobs pending. High half: set by the last job to finish while it
+	// hands m_waiting to the pool, so the owner cannot destroy the counter under it
+	std::atomic<uint64_t>	  m_state;
+	std::mutex				  m_mutex;	 // Guards m_waiting against the last job finishing
+	std::vector<detail::Job*> m_waiting; // Jobs held back until the pending count reaches zero
+};
+
+class JobSystem {
+public:
+	using JobFn = std::function<void()>;
+
+	/** @brief Counters for the Debug window */
+	struct Stats {
+		uint32_t workers;
+		uint64_t executed; // Jobs run, by the workers and in Wait()
+		uint64_t stolen;   // Of those, taken from another worker's deque
+		uint64_t failed;   // Jobs that threw anything; it is logged and dropped
+	};
+
+	/** @brief Upper bound for the pool, whatever job_workers says */
+	static constexpr uint32_t kMaxWorkers = 64;
+
+	/** @brief The pool shared by the services; App starts and stops it */
+	static JobSystem* Get_JobSystem_Singleton();
+
+	JobSystem();
+	~JobSystem();
+
+	JobSystem(const JobSystem&)			   = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	/**
+	 * @brief Starts the worker threads
+	 * @param workers 0 runs jobs only inside Wait()
+	 */
+	void Start(uint32_t workers);
+
+	/**
+	 * @brief Joins the workers once their running jobs return
+	 *
+	 * Jobs that have not started are dropped; their counters still count down.
+	 * Jobs held back by a counter that never finishes are dropped as well.
+	 * Anything that must reach the disk is written by its owner's Close().
+	 */
+	void Stop();
+
+	bool IsRunning() const { return !m_workers.empty(); }
+
+	/** @brief Set once Stop() is called; a long job checks it and returns early */
+	bool IsStopping() const { return m_stop.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Runs fn on a worker thread
+	 * @param counter Counts the job until it has finished; may be nullptr
+	 * @param after Counter the job waits for; may be nullptr or already done
+	 * @note After Stop() the job is logged and dropped; asserts in debug builds
+	 */
+	void Schedule(JobFn fn, JobCounter* counter = nullptr, JobCounter* after = nullptr);
+
+	/** @brief Runs jobs on the calling thread until counter is done */
+	void Wait(const JobCounter& counter);
+
+	/** @brief Queues fn for the main thread; safe from any thread */
+	void RunOnMainThread(JobFn fn);
+
+	/** @brief Runs the queued continuations; main thread, scheduled in TickPhase::PreFrame */
+	void DispatchMainThread();
+
+	Stats GetStats() const;
+
+	/**
+	 * @brief Time to fan out and join a batch of equal jobs on 1..N cores
+	 *
+	 * The calling thread counts as one core: it joins with Wait(), so cores = 1
+	 * runs every job on it and cores = N starts N - 1 workers. One iteration is
+	 * one batch of kScalingJobs jobs, scheduled from a job so they spread by
+	 * stealing.
+	 */
+	static BenchResult MeasureScaling(uint32_t iterations, uint32_t cores);
+
+	static constexpr uint32_t kScalingJobs = 256;
+
+private:
+	using Job = detail::Job;
+
+	// Chase-Lev deque: the owner pushes and pops at the bottom, thieves take
+	// from the top. Bounded; a full deque sends the job to the shared queue.
+	class WorkerDeque {
+	public:
+		static constexpr int64_t kCapacity = 4096;
+
+		WorkerDeque() : m_top(0), m_bottom(0), m_slots() {}
+
+		bool Push(Job* job);  // Owner only
+		Job* Pop();			  // Owner only
+		Job* Steal();		  // Any thread
+
+	private:
+		alignas(64) std::atomic<int64_t> m_top;
+		alignas(64) std::atomic<int64_t> m_bottom;
+		alignas(64) std::array<std::atomic<Job*>, kCapacity> m_slots;
+	};
+
+	struct Worker {
+		WorkerDeque deque;
+		std::thread thread;
+	};
+
+	void Enqueue(Job* job);
+	Job* FindJob(int32_t self, bool& stolen);
+	void Execute(Job* job);
+	void Finish(JobCounter* counter);
+	void WorkerLoop(int32_t self);
+
+	std::vector<std::unique_ptr<Worker>> m_workers;
+
+	std::mutex		 m_sharedMutex; // Jobs scheduled from outside the workers
+	std::deque<Job*> m_shared;
+
+	// Queued jobs anywhere; workers sleep while it is 0
+	std::atomic<int64_t>	m_queued;
+	std::atomic<uint32_t>	m_sleeping;
+	std::mutex				m_wakeMutex;
+	std::condition_variable m_wake;
+	std::atomic<bool>		m_stop;
+
+	std::mutex		   m_mainThreadMutex;
+	std::vector<JobFn> m_mainThread;
+
+	std::atomic<uint64_t> m_executed;
+	std::atomic<uint64_t> m_stolen;
+	std::atomic<uint64_t> m_failed;
+};
+
+} // namespace app
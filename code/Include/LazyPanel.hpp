@@ -0,0 +1,96 @@
+// LazyPanel.hpp
+// Creates a tool window the first time it is shown and frees it once it has
+// been closed for a while.
+//
+// Most sessions never open the Debug, Font Manager or file browser windows, so
+// MemoryManagement::AllocAll() leaves them out. App schedules a LazyPanel for
+// each instead:
+// - Tick() runs in the UI phase while the window's show flag is set; the first
+//   one creates the panel through MemoryManagement and opens it.
+// - Collect() runs about once a second and frees the panel when it has been
+//   hidden for cvars::PanelReleaseSeconds (0 keeps it).
+//
+// A panel that has work in flight can refuse to be freed with a
+// `bool IsBusy() const`. The panel's state (current directory, selections)
+// goes with it; reopening starts fresh.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "Master.hpp"
+#include "Component.hpp"
+#include "ConsoleVariables.hpp"
+#include "MemoryManagement.hpp"
+
+namespace app {
+
+template <typename T>
+class LazyPanel final : public Master {
+public:
+	/** @param shown The MemoryManagement flag that shows the window */
+	explicit LazyPanel(bool* shown) : m_shown(shown), m_panel(nullptr), m_hiddenSince() {}
+
+	LazyPanel(const LazyPanel&)			   = delete;
+	LazyPanel& operator=(const LazyPanel&) = delete;
+
+	virtual void Open() override {}
+
+	/** @brief Draws the panel, creating it first if needed; schedule with the show flag as enabled */
+	virtual void Tick() override {
+		if (!m_panel && !Materialize()) {
+			*m_shown = false; // Creation failed and was reported; do not retry every frame
+			return;
+		}
+		m_hiddenSince = {};
+		m_panel->T::Tick();
+	}
+
+	/** @brief Nothing to do: a panel that still exists at shutdown goes with the other services */
+	virtual void Close() override {}
+
+	/** @brief Frees the panel once it has been hidden long enough */
+	void Collect() {
+		if (!m_panel || *m_shown) return;
+
+		const int32_t releaseSeconds = cvars::PanelReleaseSeconds.Get();
+		if (releaseSeconds == 0) return;
+
+		const Clock::time_point now = Clock::now();
+		if (m_hiddenSince == Clock::time_point{}) m_hiddenSince = now;
+		if (now - m_hiddenSince < std::chrono::seconds(releaseSeconds)) return;
+
+		if constexpr (requires(const T& panel) { panel.IsBusy(); }) {
+			if (m_panel->IsBusy()) return;
+		}
+		Release();
+	}
+
+	/** @brief Whether the panel currently exists */
+	bool IsMaterialized() const { return m_panel != nullptr; }
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	bool Materialize() {
+		static_assert(Component<T>, "LazyPanel calls T::Tick() directly");
+
+		MemoryManagement* memory = MemoryManagement::Get_MemoryManagement_Singleton();
+		if (FAILED(memory->CreateOnDemand<T>())) return false;
+		m_panel = memory->Get<T>();
+		m_panel->Open();
+		return true;
+	}
+
+	void Release() {
+		m_panel->Close();
+		m_panel		  = nullptr;
+		m_hiddenSince = {};
+		MemoryManagement::Get_MemoryManagement_Singleton()->DestroyOnDemand<T>();
+	}
+
+	bool*			  m_shown;
+	T*				  m_panel;		 // nullptr until first shown and after Release()
+	Clock::time_point m_hiddenSince; // Epoch while shown or not yet seen hidden
+};
+
+} // namespace app
@@ -6,6 +6,8 @@
 
 #include "pch.hpp"
 #include "Master.hpp"
+#include "StartupGraph.hpp"
+#include "ServiceRegistry.hpp"
 namespace app {
 
 // Forward declarations to avoid circular dependencies
@@ -14,15 +16,15 @@ class App;
 class CommandLineArguments;
 class ConsoleWindow;
 class ConsoleInputHandler;
+class ControlServer;
 class ConfigManager;
 class StyleManager;
 class DX12Renderer;
-class DxDemos;
 class DebugWindow;
 class ExampleDescriptorHeapAllocator;
 class FontManager;
 class FontManagerWindow;
-struct FrameContext;
+class FrameArena;
 class WindowClass;
 class WindowManager;
 class OutputConsole;
@@ -41,103 +43,60 @@ public:
     HRESULT AllocAll();
     HRESULT Destroy_All();
 
+    /** @brief Startup steps; App::Initialize() adds and runs the Open steps */
+    StartupGraph& GetStartupGraph() { return m_startup; }
 
 
 
-	static MemoryManagement*		Get_MemoryManagement_Singleton();
 
-    App* Get_App() const;
-
-	ExampleDescriptorHeapAllocator* Get_ExampleDescriptorHeapAllocator() const;
-
-	CommandLineArguments* Get_CommandLineArguments() const;
-	ConsoleInputHandler*  Get_ConsoleInputHandler() const;
-	ConsoleWindow*		  Get_ConsoleWindow() const;
-	DebugWindow*		  Get_DebugWindow() const;
-	DX12Renderer*		  Get_DX12Renderer() const;
-	FontManager*		  Get_FontManager() const;
-	FontManagerWindow*	  Get_FontManagerWindow() const;
-	WindowClass*		  Get_WindowClass() const;
-	WindowManager*		  Get_WindowManager() const;
-	ConfigManager*		  Get_ConfigManager() const;
-	StyleManager*		  Get_StyleManager() const;
-	OutputConsole*		  Get_OutputConsole() const;
-
-
-protected:
-    HRESULT Alloc_App();
-	HRESULT Alloc_command_line_args();
-	HRESULT Alloc_console_window();
-	HRESULT Alloc_console_input_handler();
-	HRESULT Alloc_config_manager();
-	HRESULT Alloc_style_manager();
-	HRESULT Alloc_dx12_renderer();
-	HRESULT Alloc_dx_demos();
-	HRESULT Alloc_debug_window();
-	HRESULT Alloc_Example_Descriptor_Heap_Allocator();
-	HRESULT Alloc_font_manager();
-	HRESULT Alloc_font_manager_window();
-	HRESULT Alloc_frame_context();
-	HRESULT Alloc_window_class();
-	HRESULT Alloc_window_manager();
-	HRESULT Alloc_output_console();
-
-    HRESULT Destroy_App();
-    HRESULT Destroy_command_line_args();
-    HRESULT Destroy_console_window();
-    HRESULT Destroy_console_input_handler();
-    HRESULT Destroy_config_manager();
-    HRESULT Destroy_style_manager();
-    HRESULT Destroy_dx12_renderer();
-    HRESULT Destroy_dx_demos();
-    HRESULT Destroy_debug_window();
-    HRESULT Destroy_Example_Descriptor_Heap_Allocator();
-    HRESULT Destroy_font_manager();
-    HRESULT Destroy_font_manager_window();
-    HRESULT Destroy_frame_context();
-    HRESULT Destroy_window_class();
-    HRESULT Destroy_window_manager();
-    HRESULT Destroy_output_console();
+	static MemoryManagement*		Get_MemoryManagement_Singleton();
 
+	/** @brief Every service compiled in, in no particular order; see ServiceRegistry.hpp and Features.hpp */
+	using Services =
+		ServiceRegistryOf<OptionalService<App>, OptionalService<CommandLineArguments>, OptionalService<ConsoleWindow>,
+						  OptionalService<ConsoleInputHandler>, OptionalService<ControlServer>,
+						  OptionalService<ConfigManager>, OptionalService<StyleManager>, OptionalService<DX12Renderer>,
+						  OptionalService<DebugWindow>, OptionalService<ExampleDescriptorHeapAllocator>,
+						  OptionalService<FontManager>, OptionalService<FontManagerWindow, Features::FontManagerUI>,
+						  OptionalService<FrameArena>, OptionalService<WindowClass, Features::FileBrowser>,
+						  OptionalService<WindowManager>, OptionalService<OutputConsole>>;
+
+	/**
+	 * @brief The service T; an array load, so there is no need to avoid calling it
+	 * @note Asserts in debug builds if T was not created yet
+	 */
+	template <typename T>
+	T* Get() const noexcept {
+		return m_services.Get<T>();
+	}
+
+	/** @brief T, or nullptr while an on-demand service does not exist */
+	template <typename T>
+	T* Find() const noexcept {
+		return m_services.Find<T>();
+	}
+
+	/**
+	 * @brief Creates a service that AllocAll() leaves out; main thread, after startup
+	 * @return S_OK, or the error from ServiceRegistry::Create()
+	 */
+	template <typename T>
+	HRESULT CreateOnDemand() {
+		return m_services.Create<T>();
+	}
+
+	/** @brief Destroys a service created by CreateOnDemand() */
+	template <typename T>
+	void DestroyOnDemand() {
+		m_services.Destroy<T>();
+	}
 
 private:
-	// UPtr<DX12Renderer>					 dx12_renderer;
-
-	UPtr<ExampleDescriptorHeapAllocator> m_Example_Descriptor_Heap_Allocator;
-    UPtr<App> m_app;
-	UPtr<CommandLineArguments> m_command_line_args;
-	UPtr<ConsoleWindow>		   m_console_window;
-	UPtr<ConsoleInputHandler>  m_console_input_handler;
-	UPtr<ConfigManager>		   m_config_manager;
-	UPtr<StyleManager>		   m_style_manager;
-	UPtr<DxDemos>			   m_dx_demos;
-	UPtr<DX12Renderer>		   m_dx12_renderer;
-	UPtr<DebugWindow>		   m_debug_window;
-	UPtr<FontManager>		   m_font_manager;
-	UPtr<FontManagerWindow>	   m_font_manager_window;
-	UPtr<FrameContext>		   m_frame_context;
-	UPtr<WindowClass>		   m_window_class;
-	UPtr<WindowManager>		   m_window_manager;
-	UPtr<OutputConsole>		   m_output_console;
-
-    bool m_bApp_allocated;
-	bool m_bCommand_line_args_allocated;
-	bool m_bConsole_window_allocated;
-	bool m_bConsole_input_handler_allocated;
-	bool m_bConfig_manager_allocated;
-	bool m_bStyle_manager_allocated;
-	bool m_bDx12_renderer_allocated;
-	bool m_bDx_demos_allocated;
-	bool m_bDebug_window_allocated;
-	bool m_bExample_Descriptor_Heap_Allocator_allocated;
-	bool m_bFont_manager_allocated;
-	bool m_bFont_manager_window_allocated;
-	bool m_bFrame_context_allocated;
-	bool m_bmemory_management_allocated;
-	bool m_bWindow_class_allocated;
-	bool m_bWindow_manager_allocated;
-	bool m_bOutput_console_allocated;
+	template <typename T>
+	void AddAllocStep(std::initializer_list<std::string_view> dependencies, StartupGraph::Affinity affinity);
 
+	Services		 m_services;
+	StartupGraph m_startup;
 
 	// imgui flags
 public:
@@ -0,0 +1,143 @@
+// MemoryTags.hpp
+// Per-subsystem accounting of ImGui::MemAlloc memory.
+//
+// Every block the pools hand out (see PoolAllocator.hpp) records the tag that
+// was current on the allocating thread, and its pool keeps live bytes and
+// block counts per tag. Freeing subtracts from the tag stored in the block, so
+// a line logged under Console is still charged to Console when the scrollback
+// drops it from another scope.
+//
+// Two ways to tag:
+// - MemTagScope sets the tag of the current thread until it goes out of
+//   scope; scopes nest.
+// - TaggedAllocator<T, Tag> makes a standard container allocate through the
+//   pools under Tag wherever it is used (TaggedVector is the common case).
+//
+// Only memory that goes through the pools is seen: operator new (std::string,
+// fs::path) is not tracked.
+//
+// Define APP_MEMORY_TAGS=0 to compile it out: scopes become empty, tagged
+// containers use std::allocator and the pools keep no per-tag counters.
+
+#pragma once
+
+#include "PCH.hpp"
+
+#ifndef APP_MEMORY_TAGS
+#define APP_MEMORY_TAGS 1
+#endif
+
+namespace app {
+
+enum class MemTag : uint8_t {
+	Untagged,
+	ImGui,		 // Windows, draw lists and glyphs built during the frame
+	ImPlot,
+	Console,	 // Scrollback and its line buffers
+	Fonts,		 // Font files and atlas sources
+	FileBrowser, // Directory listing
+	FrameArena,
+	Count
+};
+
+inline constexpr uint32_t kMemTagCount = static_cast<uint32_t>(MemTag::Count);
+
+constexpr const char* MemTagName(MemTag tag) {
+	switch (tag) {
+	case MemTag::Untagged: return "Untagged";
+	case MemTag::ImGui: return "ImGui";
+	case MemTag::ImPlot: return "ImPlot";
+	case MemTag::Console: return "Console";
+	case MemTag::Fonts: return "Fonts";
+	case MemTag::FileBrowser: return "File browser";
+	case MemTag::FrameArena: return "Frame arena";
+	default: return "?";
+	}
+}
+
+#if APP_MEMORY_TAGS
+
+/** @brief Tags this thread's ImGui::MemAlloc calls until destroyed */
+class MemTagScope {
+public:
+	explicit MemTagScope(MemTag tag) : m_previous(s_current) { s_current = tag; }
+	~MemTagScope() { s_current = m_previous; }
+
+	MemTagScope(const MemTagScope&)			   = delete;
+	MemTagScope& operator=(const MemTagScope&) = delete;
+
+	static MemTag Current() { return s_current; }
+
+private:
+	MemTag m_previous;
+
+	static inline thread_local MemTag s_current = MemTag::Untagged;
+};
+
+/**
+ * @brief Standard allocator that takes its memory from the ImGui allocator under Tag
+ *
+ * Calls the installed allocator functions directly rather than ImGui::MemAlloc,
+ * which also updates the metrics of the current ImGui context and so belongs to
+ * the main thread.
+ */
+template <typename T, MemTag Tag>
+class TaggedAllocator {
+public:
+	static_assert(alignof(T) <= 16, "the pools align blocks to 16 bytes");
+
+	using value_type = T;
+
+	template <typename U>
+	struct rebind {
+		using other = TaggedAllocator<U, Tag>;
+	};
+
+	TaggedAllocator() noexcept = default;
+	template <typename U>
+	TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept {}
+
+	T* allocate(size_t count) {
+		ImGuiMemAllocFunc allocFunc;
+		ImGuiMemFreeFunc  freeFunc;
+		void*			  userData;
+		ImGui::GetAllocatorFunctions(&allocFunc, &freeFunc, &userData);
+
+		MemTagScope scope(Tag);
+		void*		ptr = allocFunc(count * sizeof(T), userData);
+		if (!ptr) throw std::bad_alloc();
+		return static_cast<T*>(ptr);
+	}
+
+	void deallocate(T* ptr, size_t) noexcept {
+		ImGuiMemAllocFunc allocFunc;
+		ImGuiMemFreeFunc  freeFunc;
+		void*			  userData;
+		ImGui::GetAllocatorFunctions(&allocFunc, &freeFunc, &userData);
+		freeFunc(ptr, userData);
+	}
+
+	template <typename U>
+	bool operator==(const TaggedAllocator<U, Tag>&) const noexcept {
+		return true;
+	}
+};
+
+#else
+
+class MemTagScope {
+public:
+	explicit MemTagScope(MemTag) {}
+
+	static constexpr MemTag Current() { return MemTag::Untagged; }
+};
+
+template <typename T, MemTag Tag>
+using TaggedAllocator = std::allocator<T>;
+
+#endif // APP_MEMORY_TAGS
+
+template <typename T, MemTag Tag>
+using TaggedVector = std::vector<T, TaggedAllocator<T, Tag>>;
+
+} // namespace app
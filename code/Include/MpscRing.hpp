@@ -0,0 +1,99 @@
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+
+/**
+ * @brief Bounded multi-producer / single-consumer ring buffer.
+ *
+ * Lock-free for the producers and wait-free for the consumer: every slot
+ * carries a sequence number that tells whether it is free for the push at
+ * that position or holds the value for the pop at that position. Producers
+ * claim a position with one compare-exchange on the shared head; the consumer
+ * owns the tail alone. No allocation after construction.
+ *
+ * Any number of threads may call TryPush(); only one thread may call TryPop()
+ * at a time. Capacity must be a power of two. See SpscRing for the cheaper
+ * single-producer version.
+ *
+ * @tparam T        Element type (moved in and out)
+ * @tparam Capacity Number of slots, power of two
+ */
+template <typename T, size_t Capacity>
+class MpscRing {
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+				  "MpscRing capacity must be a power of two");
+
+public:
+	MpscRing() : m_head(0), m_tail(0), m_cells() {
+		for (size_t i = 0; i < Capacity; ++i) m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	MpscRing(const MpscRing&)			 = delete;
+	MpscRing& operator=(const MpscRing&) = delete;
+
+	/**
+	 * @brief Producer side: moves value into the ring; safe from any thread
+	 * @return false if the ring is full (value is left untouched)
+	 */
+	bool TryPush(T&& value) {
+		size_t position = m_head.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell&		   cell		= m_cells[position & (Capacity - 1)];
+			const size_t   sequence = cell.sequence.load(std::memory_order_acquire);
+			const intptr_t diff		= static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+			if (diff == 0) {
+				// Free for this position - claim it (on failure position is reloaded)
+				if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					cell.value = std::move(value);
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (diff < 0) {
+				return false; // Still holds the value from one lap ago
+			} else {
+				position = m_head.load(std::memory_order_relaxed); // Another producer got there first
+			}
+		}
+	}
+
+	/**
+	 * @brief Consumer side: moves the oldest value out of the ring
+	 * @return false if the ring is empty or the oldest push is not finished yet
+	 */
+	bool TryPop(T& out) {
+		const size_t position = m_tail.load(std::memory_order_relaxed);
+		Cell&		 cell	  = m_cells[position & (Capacity - 1)];
+		if (cell.sequence.load(std::memory_order_acquire) != position + 1) return false;
+
+		out = std::move(cell.value);
+		cell.sequence.store(position + Capacity, std::memory_order_release); // Free for the next lap
+		m_tail.store(position + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/**
+	 * @brief Approximate number of queued elements; safe from any thread
+	 */
+	size_t SizeApprox() const {
+		const size_t tail = m_tail.load(std::memory_order_acquire);
+		const size_t head = m_head.load(std::memory_order_acquire);
+		return head > tail ? head - tail : 0;
+	}
+
+	static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+	struct Cell {
+		std::atomic<size_t> sequence;
+		T					value;
+	};
+
+	// Producers contend on the head; the consumer's tail gets its own line
+	alignas(64) std::atomic<size_t> m_head;
+	alignas(64) std::atomic<size_t> m_tail;
+	alignas(64) std::array<Cell, Capacity> m_cells;
+};
+
+} // namespace app
@@ -2,61 +2,157 @@
 #include "pch.hpp"
 #include "Classes.hpp"
 #include "ImGuiTermcolor.hpp"
+#include "OutputSinks.hpp"
+#include "Benchmark.hpp"
 
 namespace app {
 
 // Forward declaration
 class ConsoleWindow;
 
-class CustomOutput{
+/**
+ * @brief Stream-style formatter behind OutputConsole::Out
+ *
+ * Everything streamed in is formatted once into a reusable line buffer:
+ * numbers with std::to_chars, wide strings converted straight to UTF-8,
+ * termcolor manipulators as ANSI SGR sequences, anything else through an
+ * std::ostream that writes into the same buffer (so std::hex, setprecision
+ * and friends keep working). When a line is complete every registered sink
+ * receives a view of it.
+ *
+ * Text without a trailing newline stays buffered until the line is finished;
+ * std::endl ends the line and flushes the sinks, std::flush only flushes them.
+ *
+ * Thread safety: any thread may stream into the same CustomOutput. Each thread
+ * assembles its partial line (and keeps its own stream flags and color tag) in
+ * thread-local storage, so formatting takes no lock; only complete lines are
+ * published, under one mutex, so lines never interleave. Sinks that must run
+ * on the main thread (the ImGui console) get lines from other threads later,
+ * through DispatchDeferred(). A line a thread never finishes is not published.
+ */
+class CustomOutput {
 private:
-	ConsoleWindow* m_consoleWindow;
-	std::string m_buffer; // Buffer to accumulate text until newline
-	std::string m_currentColorTag; // Current ImGui color tag
+	// Appends whatever an std::ostream writes to the line being built
+	class LineBuffer : public std::streambuf {
+	public:
+		explicit LineBuffer(std::string& target) : m_target(target) {}
+
+	protected:
+		virtual int_type overflow(int_type ch) override {
+			if (!traits_type::eq_int_type(ch, traits_type::eof()))
+				m_target.push_back(traits_type::to_char_type(ch));
+			return traits_type::not_eof(ch);
+		}
+
+		virtual std::streamsize xsputn(const char* s, std::streamsize n) override {
+			m_target.append(s, static_cast<size_t>(n));
+			return n;
+		}
+
+	private:
+		std::string& m_target;
+	};
+
+	// Formatting state of one thread for one CustomOutput; see Local()
+	struct ThreadLine {
+		ThreadLine();
+
+		std::string				line;		  // Line being assembled; capacity is reused
+		size_t					scanPos;	  // Bytes of line already searched for '\n'
+		LineBuffer				buffer;		  // Must follow line
+		std::ostream			stream;		  // Formats into line
+		std::ios_base::fmtflags defaultFlags; // Fast paths only apply while these are unchanged
+		std::string				colorTag;	  // Current ImGui color tag
+	};
+
+	struct LocalState {
+		uint64_t		 owner; // CustomOutput::m_id
+		UPtr<ThreadLine> state;
+	};
+
+	template <typename T>
+	static constexpr bool IsNumber =
+		std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+		!std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> &&
+		!std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> &&
+		!std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+	// Lines from other threads kept for main-thread sinks before the oldest are dropped
+	static constexpr size_t kMaxDeferredLines = 8192;
+
+	const uint64_t	m_id;		  // Keys the thread-local state; never reused
+	std::thread::id m_mainThread; // Thread that created this object
+
+	std::mutex					  m_sinkMutex; // Guards every member below
+	std::vector<UPtr<OutputSink>> m_sinks;
+	ConsoleWindowSink*			  m_consoleWindowSink; // Owned by m_sinks
+	uint32_t					  m_mainThreadSinks;   // Sinks with RequiresMainThread()
+	std::deque<std::string>		  m_deferred;		   // Lines waiting for DispatchDeferred()
+	uint64_t					  m_droppedLines;	   // Deferred lines lost to the cap
 
 public:
 	CustomOutput();
-	void SetConsoleWindow(ConsoleWindow* consoleWindow);
+	~CustomOutput();
 
-	
+	CustomOutput(const CustomOutput&)			 = delete;
+	CustomOutput& operator=(const CustomOutput&) = delete;
 
-	template <class elem = char, class _Traits = std::char_traits<char>>
-	CustomOutput& operator<<(
-		std::basic_ostream<char, std::char_traits<char>>&(__cdecl* _Pfn)(
-			std::basic_ostream<char, std::char_traits<char>>&)) {
-		_Pfn(std::cout);
-		
-		// If this is std::endl or std::flush, flush to ConsoleWindow
-		if (_Pfn == static_cast<std::ostream&(*)(std::ostream&)>(std::endl) ||
-		    _Pfn == static_cast<std::ostream&(*)(std::ostream&)>(std::flush)) {
-			m_buffer += '\n';
-			FlushToConsoleWindow();
-		}
-		
-		return *this;
-	}
+	void SetConsoleWindow(ConsoleWindow* consoleWindow);
 
-	// Catch-all template for IO manipulators (hex, dec, termcolor, etc.)
-	template<typename T>
-	CustomOutput& operator<<(T val) {
-		std::cout << val;
+	/**
+	 * @brief Registers a sink; every following line is delivered to it
+	 * @return The sink, still owned by this object
+	 * @note Sinks are called with the publishing lock held and must not write
+	 *       back into this CustomOutput
+	 */
+	OutputSink* AddSink(UPtr<OutputSink> sink);
+	void		RemoveSink(OutputSink* sink);
+
+	/**
+	 * @brief Hands lines logged by other threads to the main-thread sinks
+	 *
+	 * Called once per frame by the main loop; does nothing on other threads.
+	 * Lines the main thread publishes itself dispatch the backlog first, so
+	 * ordering is kept.
+	 */
+	void DispatchDeferred();
+
+	/**
+	 * @brief Delivers deferred lines, flushes every sink and waits for sinks
+	 *        with a background writer to reach their device
+	 *
+	 * Used on shutdown, once the threads that log have been stopped. Deferred
+	 * lines and main-thread sinks are only handled on the main thread.
+	 *
+	 * @return false if a sink was still busy when timeout ran out
+	 */
+	bool Drain(std::chrono::milliseconds timeout);
+
+	// std::endl, std::flush and stream manipulators such as tc::green
+	CustomOutput& operator<<(std::ostream& (*manip)(std::ostream&));
+
+	// Numbers use std::to_chars; everything else goes through the ostream
+	template <typename T>
+	CustomOutput& operator<<(const T& value) {
+		ThreadLine& local = Local();
+		if constexpr (IsNumber<T>) {
+			AppendNumber(local, value);
+		} else {
+			local.stream << value;
+		}
+		EmitLines(local);
 		return *this;
 	}
 
-
-	CustomOutput& operator<<(const long long& valor);
-	CustomOutput& operator<<(const int& valor);
-	CustomOutput& operator<<(const long double& valor);
-	CustomOutput& operator<<(const float& valor);
 	CustomOutput& operator<<(const char* dado);
 	CustomOutput& operator<<(const wchar_t* dado);
 	CustomOutput& operator<<(const std::string& dado);
 	CustomOutput& operator<<(const std::wstring& dado);
 
-	// ImGui color control methods
+	// ImGui color control methods (per thread)
 	CustomOutput& SetImGuiColor(const char* colorTag);
 	CustomOutput& ResetImGuiColor();
-	const std::string& GetCurrentColorTag() const { return m_currentColorTag; }
+	const std::string& GetCurrentColorTag() { return Local().colorTag; }
 
 	// Guaranteed output methods - always appear in both consoles
 	void WriteLine(const std::string& message);
@@ -67,15 +163,54 @@ public:
 	// Status and information methods
 	void ShowSystemStatus();
 
+	/**
+	 * @brief Per-line cost while every hardware thread (up to 8) logs at once
+	 *
+	 * Each thread streams 'iterations' lines into a private CustomOutput with a
+	 * counting sink. With uncontended formatting the median matches the
+	 * single-threaded 'out_format' target; throws if any line is lost.
+	 */
+	static BenchResult MeasureConcurrentLines(uint32_t iterations);
+
 private:
-	void FlushToConsoleWindow();
-	void ForceFlush(); // Force immediate flush regardless of newline
-
-	/* template<typename Func>
-    auto operator<<(Func&& manipulator) -> decltype(manipulator(std::declval<std::ostream&>()), *this) {
-        manipulator(std::cout);
-        return *this;
-    }*/
+	// State of the calling thread, created on first use
+	ThreadLine& Local();
+
+	// Every state the calling thread holds, for all CustomOutput objects
+	static std::vector<LocalState>& ThreadStates();
+
+	template <typename T>
+	static void AppendNumber(ThreadLine& local, T value) {
+		if (!UsesDefaultFormat(local)) {
+			local.stream << value; // Honour std::hex, std::setprecision, ...
+			return;
+		}
+
+		char				 buf[64];
+		std::to_chars_result result;
+		if constexpr (std::is_floating_point_v<T>) {
+			// Same text as an unmodified std::ostream (%g, 6 digits)
+			result = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::general, 6);
+		} else {
+			result = std::to_chars(buf, buf + sizeof(buf), value);
+		}
+		local.line.append(buf, result.ptr);
+	}
+
+	static bool UsesDefaultFormat(const ThreadLine& local) {
+		return local.stream.flags() == local.defaultFlags && local.stream.precision() == 6 &&
+			   local.stream.width() == 0;
+	}
+
+	static void AppendWide(ThreadLine& local, const wchar_t* text, size_t length);
+
+	// Publishes every complete line of local.line, then drops them from it
+	void EmitLines(ThreadLine& local);
+	void FlushSinks();
+
+	// m_sinkMutex must be held
+	void PublishLocked(std::string_view line, bool onMainThread);
+	void DispatchDeferredLocked();
 };
 
 class OutputConsole : public Master {
@@ -97,6 +232,10 @@ private:
 	void CreateConsole();
 
 	void setConsoleFontSize(int size);
+
+	// Shows or hides the native console when the 'show'/'hide' commands say so
+	void OnConsoleVisibilityChanged(const ConsoleVisibilityChanged& event);
+
 	bool m_bWasConsoleCreated;
 	bool m_bShouldCreateConsole;
 	bool m_bShowConsole;
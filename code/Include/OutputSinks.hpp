@@ -0,0 +1,141 @@
+// OutputSinks.hpp
+// Destinations for lines produced by CustomOutput (OutputConsole::Out).
+//
+// CustomOutput formats every line exactly once into a reusable buffer and then
+// hands each registered sink a view of the finished line. Sinks must not keep
+// the view past the call; copy what you need.
+//
+// Lines are UTF-8, carry no trailing '\n', and may contain ANSI SGR escape
+// sequences produced by termcolor manipulators (tc::green, tc::reset, ...).
+//
+// CustomOutput serializes all calls into its sinks, so a sink needs no locking
+// of its own. Calls may come from any thread unless RequiresMainThread() says
+// otherwise.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "AsyncConsoleWriter.hpp"
+
+namespace app {
+
+class ConsoleWindow;
+
+/**
+ * @brief Receiver of complete output lines
+ */
+class OutputSink {
+public:
+	virtual ~OutputSink() = default;
+
+	/**
+	 * @brief Receives one finished line
+	 * @param line UTF-8 text without the line terminator; only valid during the call
+	 */
+	virtual void WriteLine(std::string_view line) = 0;
+
+	/** @brief Called for std::endl / std::flush; push buffered data to the device */
+	virtual void Flush() {}
+
+	/**
+	 * @brief Waits until lines handed to a background writer reached the device
+	 * @return false if they had not after timeout
+	 */
+	virtual bool WaitIdle(std::chrono::milliseconds /*timeout*/) { return true; }
+
+	/**
+	 * @brief True if the sink may only be called on the thread that created the
+	 *        CustomOutput; lines from other threads are then queued for it
+	 */
+	virtual bool RequiresMainThread() const { return false; }
+};
+
+/**
+ * @brief Native Win32 console (stdout); keeps the ANSI colours, which the
+ *        console renders with virtual terminal processing enabled
+ *
+ * Lines go through an AsyncConsoleWriter, so a slow console or a stalled
+ * pipe never holds up the caller; Flush() has nothing to do. Queue size and
+ * overflow policy follow the 'console_queue_kb' and 'console_overflow' cvars.
+ */
+class NativeConsoleSink : public OutputSink {
+public:
+	NativeConsoleSink();
+
+	virtual void WriteLine(std::string_view line) override;
+	virtual bool WaitIdle(std::chrono::milliseconds timeout) override { return m_writer.WaitIdle(timeout); }
+
+	AsyncConsoleWriter& GetWriter() { return m_writer; }
+
+private:
+	AsyncConsoleWriter m_writer;
+	uint32_t		   m_cvarVersion; // Sum of the cvars' modification counts last applied
+};
+
+/**
+ * @brief ImGui console window (and, through it, its log file and remote
+ *        command capture); ANSI colors become ImGui color spans
+ */
+class ConsoleWindowSink : public OutputSink {
+public:
+	explicit ConsoleWindowSink(ConsoleWindow* consoleWindow);
+
+	virtual void WriteLine(std::string_view line) override;
+
+	// ConsoleWindow items are read by the renderer without locking
+	virtual bool RequiresMainThread() const override { return true; }
+
+private:
+	ConsoleWindow* m_consoleWindow;
+};
+
+/**
+ * @brief Plain-text file; not registered by default
+ */
+class FileSink : public OutputSink {
+public:
+	explicit FileSink(const fs::path& path, bool append = true);
+
+	bool IsOpen() const { return m_file.is_open(); }
+
+	virtual void WriteLine(std::string_view line) override;
+	virtual void Flush() override;
+
+private:
+	std::ofstream m_file;
+	std::string	  m_plain; // Reused for AnsiParser::Strip()
+};
+
+/**
+ * @brief Keeps the last lines in memory (raw, escapes included)
+ */
+class MemorySink : public OutputSink {
+public:
+	explicit MemorySink(size_t maxLines = 1024);
+
+	virtual void WriteLine(std::string_view line) override;
+
+	const std::deque<std::string>& GetLines() const { return m_lines; }
+	void						   Clear() { m_lines.clear(); }
+
+private:
+	std::deque<std::string> m_lines;
+	size_t					m_maxLines;
+};
+
+/**
+ * @brief Forwards each line to a callable (IPC forwarding, counters, tests)
+ */
+class CallbackSink : public OutputSink {
+public:
+	using Callback = std::function<void(std::string_view line)>;
+
+	explicit CallbackSink(Callback callback);
+
+	virtual void WriteLine(std::string_view line) override { m_callback(line); }
+
+private:
+	Callback m_callback;
+};
+
+} // namespace app
@@ -0,0 +1,202 @@
+// PoolAllocator.hpp
+// Size-class pool allocator behind ImGui::MemAlloc / ImGui::MemFree.
+//
+// ImGui, ImPlot and our own code (Wcsdup, ImStr, completion candidates, the
+// frame arena) allocate through ImGui::MemAlloc, which defaults to malloc.
+// PoolAllocator replaces it with pools of fixed-size blocks: a request is
+// rounded up to one of 43 size classes (16-byte steps up to 256 bytes, then
+// four classes per power of two up to 32 KiB) and served from that class's
+// free list. Larger requests go to malloc.
+//
+// Every thread that allocates gets its own SizeClassPool, so the common path
+// takes no lock. A block freed by another thread is pushed onto its pool's
+// lock-free remote list and reclaimed by the owner on its next allocation.
+// When a thread exits its pool is parked and reused by the next new thread.
+//
+// Each block starts with a 16-byte header naming its pool, class, requested
+// size and memory tag, which is how MemFree - which gets no size - finds its
+// way back and which subsystem to credit.
+//
+// Install() must run before anything is allocated through ImGui::MemAlloc,
+// since blocks from the old allocator cannot be freed into the pools; Main
+// calls it first thing.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "Benchmark.hpp"
+#include "MemoryTags.hpp"
+
+namespace app {
+
+class SizeClassPool {
+public:
+	static constexpr size_t	  kHeaderBytes	  = 16;
+	static constexpr size_t	  kMaxBlockBytes  = 32 * 1024; // Header included
+	static constexpr uint32_t kClassCount	  = 43;
+	static constexpr uint32_t kLargeClass	  = kClassCount; // Histogram slot of malloc'd requests
+	static constexpr size_t	  kSpanBytes	  = 64 * 1024;	 // Minimum carved at once per class
+
+	/** @brief Counters of one pool, or the sum of several */
+	struct Stats {
+		uint64_t allocs;
+		uint64_t frees;
+		int64_t	 liveBytes;		// Requested bytes not freed yet
+		uint64_t reservedBytes; // Spans and large blocks held
+		uint64_t histogram[kClassCount + 1]; // Allocations per size class, then large
+#if APP_MEMORY_TAGS
+		int64_t tagBytes[kMemTagCount];	 // Live requested bytes per MemTag
+		int64_t tagBlocks[kMemTagCount]; // Live blocks per MemTag
+#endif
+	};
+
+	SizeClassPool();
+	~SizeClassPool(); // Releases every span; only for pools no block is left in
+
+	SizeClassPool(const SizeClassPool&)			   = delete;
+	SizeClassPool& operator=(const SizeClassPool&) = delete;
+
+	/** @brief Owner thread only */
+	void* Allocate(size_t size);
+
+	/** @brief Owner thread only; ptr must come from this pool */
+	void Free(void* ptr);
+
+	/** @brief Any thread; the owner reclaims the block on its next Allocate() */
+	void FreeRemote(void* ptr);
+
+	/** @brief Adds this pool's counters to out; safe from any thread */
+	void AddStats(Stats& out) const;
+
+	/** @brief Pool that allocated ptr */
+	static SizeClassPool* OwnerOf(void* ptr);
+
+	/** @brief Size class of a block of total bytes (header included), 1 <= total <= kMaxBlockBytes */
+	static constexpr uint32_t ClassOf(size_t total) {
+		if (total <= 256) return total <= 32 ? 0 : uint32_t((total + 15) / 16 - 2);
+		const size_t   t	 = total - 1;
+		const uint32_t msb	 = uint32_t(std::bit_width(t)) - 1;
+		const uint32_t sub	 = uint32_t(t >> (msb - 2)) & 3;
+		return 15 + (msb - 8) * 4 + sub;
+	}
+
+	/** @brief Block size of a class, header included */
+	static constexpr size_t ClassSize(uint32_t cls) {
+		if (cls < 15) return 32 + size_t(cls) * 16;
+		const uint32_t k = cls - 15;
+		return size_t(4 + k % 4 + 1) << (8 + k / 4 - 2);
+	}
+
+private:
+	// Leads every block; while the block is free, next overlays owner
+	struct Header {
+		union {
+			SizeClassPool* owner;
+			Header*		   next;
+		};
+		uint32_t requested;
+		uint8_t	 cls;
+		MemTag	 tag;
+		uint16_t unused;
+	};
+	static_assert(sizeof(Header) == kHeaderBytes, "Header must keep the payload 16-byte aligned");
+
+	// Leads every span; the same size as Header, so blocks after it stay aligned
+	struct Span {
+		Span*  next;
+		size_t bytes;
+	};
+	static_assert(sizeof(Span) == kHeaderBytes);
+
+	Header* Carve(uint32_t cls);
+	void	Release(Header* header);
+	void	DrainRemote();
+
+	// Only the owner writes the counters; plain load + store keeps it free of
+	// locked instructions while readers on other threads still see whole values
+	template <typename T>
+	static void Bump(std::atomic<T>& counter, T delta) {
+		counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+	}
+
+	Header*				 m_free[kClassCount];
+	char*				 m_bump[kClassCount]; // Uncarved part of the newest span of each class
+	char*				 m_bumpEnd[kClassCount];
+	Span*				 m_spans;
+	std::atomic<Header*> m_remote;
+
+	std::atomic<uint64_t> m_allocs;
+	std::atomic<uint64_t> m_frees;
+	std::atomic<int64_t>  m_liveBytes;
+	std::atomic<uint64_t> m_reservedBytes;
+	std::atomic<uint64_t> m_histogram[kClassCount + 1];
+#if APP_MEMORY_TAGS
+	std::atomic<int64_t> m_tagBytes[kMemTagCount];
+	std::atomic<int64_t> m_tagBlocks[kMemTagCount];
+#endif
+};
+
+static_assert(SizeClassPool::ClassOf(SizeClassPool::kMaxBlockBytes) == SizeClassPool::kClassCount - 1);
+static_assert(SizeClassPool::ClassSize(SizeClassPool::kClassCount - 1) == SizeClassPool::kMaxBlockBytes);
+
+class PoolAllocator {
+public:
+	/** @brief What the Debug window shows */
+	struct Snapshot {
+		SizeClassPool::Stats totals;
+		int64_t				 peakLiveBytes;	 // Highest liveBytes seen by Sample()
+		double				 allocsPerSecond; // Over the last full second
+		uint32_t			 pools;
+	};
+
+	/** @brief Makes the pools ImGui's allocator; call before any ImGui::MemAlloc */
+	static void Install();
+
+	static bool IsInstalled() { return s_installed; }
+
+	/** @brief Updates the peak and the allocation rate; called once per frame */
+	static void Sample();
+
+	static Snapshot GetSnapshot();
+
+#if APP_MEMORY_TAGS && APP_FEATURE_IMPLOT
+	/** @brief Live KiB per tag, recorded by Sample() twice a second for the Debug window's plot */
+	struct TagHistory {
+		static constexpr int kPoints = 240; // Two minutes
+
+		float time[kPoints]; // Seconds since Install()
+		float kib[kMemTagCount][kPoints];
+		int	  count; // Points recorded, at most kPoints
+		int	  next;	 // Ring index the next point goes to; the oldest once count == kPoints
+	};
+
+	/** @brief Main thread only, like Sample() */
+	static const TagHistory& GetTagHistory();
+#endif
+
+	static void* Alloc(size_t size, void* user_data);
+	static void	 Free(void* ptr, void* user_data);
+
+	/** @brief Heap usage at the end of MeasureSession() */
+	struct SessionReport {
+		uint64_t liveBytes;		 // Requested bytes still allocated
+		uint64_t committedBytes; // Memory the allocator holds for them
+	};
+
+	/**
+	 * @brief Replays a scripted allocation session and times every frame
+	 *
+	 * The script mimics this app at 60 frames per second: per-frame temporaries,
+	 * console lines kept up to a capacity, completion candidate lists and
+	 * periodic bursts of strings. Run it against a private SizeClassPool
+	 * (pooled) or a private Win32 heap, which is what malloc uses.
+	 *
+	 * @param frames Frames to simulate; 36000 is ten minutes
+	 */
+	static BenchResult MeasureSession(uint32_t frames, bool pooled, SessionReport& report);
+
+private:
+	static bool s_installed;
+};
+
+} // namespace app
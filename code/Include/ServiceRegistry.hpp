@@ -0,0 +1,177 @@
+// ServiceRegistry.hpp
+// Typed, fixed-size registry of the application's long-lived objects.
+//
+// Every service type gets a slot whose index is computed at compile time from
+// its position in the registry's type list, so Get<T>() is a single array load:
+// no map, no string, no flag to test. Using a type that is not in the list is
+// a compile error; using a service before it was created trips an assert in
+// debug builds and returns nullptr in release builds.
+//
+// Creation and destruction go through one generic path. Services are
+// destroyed in the reverse order they were created in.
+//
+// Adding a subsystem: add its type to MemoryManagement::Services and a step to
+// MemoryManagement::AllocAll(). Callers that use a service every frame should
+// fetch it once and keep the pointer; it stays valid until DestroyAll().
+//
+// A service can also be created later and destroyed on its own (see
+// LazyPanel.hpp); pointers to such a service must not be kept.
+//
+// ServiceRegistryOf builds the registry from OptionalService entries, so a
+// feature compiled out (see Features.hpp) has no slot at all.
+
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+
+template <typename... Services>
+class ServiceRegistry {
+public:
+	static constexpr size_t kCount = sizeof...(Services);
+
+	/** @brief Slot of T; a compile error if T is not one of Services */
+	template <typename T>
+	static constexpr size_t IndexOf() {
+		constexpr size_t index = FindIndex<T>();
+		static_assert(index < kCount, "Type is not registered in this ServiceRegistry");
+		return index;
+	}
+
+	ServiceRegistry() : m_services{}, m_deleters{}, m_order{}, m_created(0) {}
+	~ServiceRegistry() { DestroyAll(); }
+
+	ServiceRegistry(const ServiceRegistry&)			   = delete;
+	ServiceRegistry& operator=(const ServiceRegistry&) = delete;
+
+	/**
+	 * @brief The service; one indexed load
+	 * @note Asserts in debug builds if T was not created; nullptr in release builds
+	 */
+	template <typename T>
+	T* Get() const noexcept {
+		T* service = static_cast<T*>(m_services[IndexOf<T>()]);
+		IM_ASSERT(service && "Service used before it was created");
+		return service;
+	}
+
+	/** @brief nullptr instead of an assert when T does not exist */
+	template <typename T>
+	T* Find() const noexcept {
+		return static_cast<T*>(m_services[IndexOf<T>()]);
+	}
+
+	/**
+	 * @brief Constructs T in its slot
+	 *
+	 * Different services may be created concurrently (the startup graph does);
+	 * the same service must not be.
+	 *
+	 * @return S_OK
+	 * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if T already exists
+	 * @return E_OUTOFMEMORY if the allocation failed
+	 */
+	template <typename T, typename... Args>
+	HRESULT Create(Args&&... args) {
+		constexpr size_t index = IndexOf<T>();
+		if (m_services[index]) {
+			Report((std::string(Name<T>()) + " is already allocated.").c_str(), "Memory Error", MB_ICONERROR);
+			return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
+		}
+
+		try {
+			m_services[index] = new T(std::forward<Args>(args)...);
+		} catch (const std::bad_alloc&) {
+			Report(("Failed to allocate memory for " + std::string(Name<T>()) + ".").c_str(), "Critical Error",
+				   MB_ICONSTOP);
+			return E_OUTOFMEMORY;
+		}
+		m_deleters[index]									  = [](void* service) { delete static_cast<T*>(service); };
+		m_order[m_created.fetch_add(1, std::memory_order_relaxed)] = static_cast<uint8_t>(index);
+		return S_OK;
+	}
+
+	/**
+	 * @brief Destroys T ahead of the others; nothing happens if it does not exist
+	 * @note Not safe while other services are being created
+	 */
+	template <typename T>
+	void Destroy() {
+		constexpr size_t index	 = IndexOf<T>();
+		void*			 service = std::exchange(m_services[index], nullptr);
+		if (!service) return;
+		m_deleters[index](service);
+
+		// Keep the creation order of the rest, so a later Create<T>() gets a fresh place at the end
+		const size_t created = m_created.load(std::memory_order_relaxed);
+		auto		 end	 = std::remove(m_order.begin(), m_order.begin() + created, static_cast<uint8_t>(index));
+		m_created.store(static_cast<size_t>(end - m_order.begin()), std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Destroys every service, newest first
+	 * @return S_OK (services without a slot are skipped)
+	 */
+	HRESULT DestroyAll() {
+		for (size_t n = m_created.exchange(0, std::memory_order_relaxed); n-- > 0;) {
+			const size_t index = m_order[n];
+			if (void* service = std::exchange(m_services[index], nullptr)) m_deleters[index](service);
+		}
+		return S_OK;
+	}
+
+	/** @brief Class name of T without the namespace, for messages */
+	template <typename T>
+	static std::string_view Name() {
+		std::string_view name = typeid(T).name();
+		for (std::string_view prefix : {"class ", "struct ", "app::"}) {
+			if (name.substr(0, prefix.size()) == prefix) name.remove_prefix(prefix.size());
+		}
+		return name;
+	}
+
+private:
+	template <typename T>
+	static constexpr size_t FindIndex() {
+		constexpr bool matches[] = {std::is_same_v<T, Services>...};
+		for (size_t i = 0; i < kCount; i++) {
+			if (matches[i]) return i;
+		}
+		return kCount;
+	}
+
+	static void Report(const char* message, const char* caption, UINT icon) {
+		MessageBoxA(NULL, message, caption, MB_OK | icon);
+	}
+
+	static_assert(kCount <= 256, "m_order stores slots as uint8_t");
+
+	std::array<void*, kCount>			m_services;
+	std::array<void (*)(void*), kCount> m_deleters;
+	std::array<uint8_t, kCount>			m_order; // Slots in creation order
+	std::atomic<size_t>					m_created;
+};
+
+/** @brief T as a registry entry, or no entry at all when Enabled is false */
+template <typename T, bool Enabled = true>
+struct OptionalService {};
+
+namespace detail {
+
+template <typename Registry, typename... Entries>
+struct CollectServices {
+	using type = Registry;
+};
+
+template <typename... Ts, typename T, bool Enabled, typename... Rest>
+struct CollectServices<ServiceRegistry<Ts...>, OptionalService<T, Enabled>, Rest...>
+: CollectServices<std::conditional_t<Enabled, ServiceRegistry<Ts..., T>, ServiceRegistry<Ts...>>, Rest...> {};
+
+} // namespace detail
+
+/** @brief ServiceRegistry of the enabled entries, in order */
+template <typename... Entries>
+using ServiceRegistryOf = typename detail::CollectServices<ServiceRegistry<>, Entries...>::type;
+
+} // namespace app
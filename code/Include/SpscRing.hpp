@@ -0,0 +1,86 @@
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+
+/**
+ * @brief Bounded single-producer / single-consumer ring buffer.
+ *
+ * Wait-free for both sides: TryPush() and TryPop() each do one relaxed load
+ * of their own index, at most one acquire load of the other side's index,
+ * and one release store. No locks, no allocation after construction.
+ *
+ * Only one thread may call TryPush() and only one (other) thread may call
+ * TryPop() at a time. Capacity must be a power of two; one slot is never
+ * wasted because the indices are free-running counters.
+ *
+ * @tparam T        Element type (moved in and out)
+ * @tparam Capacity Number of slots, power of two
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+				  "SpscRing capacity must be a power of two");
+
+public:
+	SpscRing() : m_head(0), m_cachedTail(0), m_tail(0), m_cachedHead(0), m_slots() {}
+
+	SpscRing(const SpscRing&)			 = delete;
+	SpscRing& operator=(const SpscRing&) = delete;
+
+	/**
+	 * @brief Producer side: moves value into the ring
+	 * @return false if the ring is full (value is left untouched)
+	 */
+	bool TryPush(T&& value) {
+		const size_t head = m_head.load(std::memory_order_relaxed);
+		if (head - m_cachedTail == Capacity) {
+			// Looks full - refresh our view of the consumer
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+			if (head - m_cachedTail == Capacity) return false;
+		}
+		m_slots[head & (Capacity - 1)] = std::move(value);
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Consumer side: moves the oldest value out of the ring
+	 * @return false if the ring is empty
+	 */
+	bool TryPop(T& out) {
+		const size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail == m_cachedHead) {
+			// Looks empty - refresh our view of the producer
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			if (tail == m_cachedHead) return false;
+		}
+		out = std::move(m_slots[tail & (Capacity - 1)]);
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Approximate number of queued elements; safe from any thread
+	 */
+	size_t SizeApprox() const {
+		const size_t tail = m_tail.load(std::memory_order_acquire);
+		const size_t head = m_head.load(std::memory_order_acquire);
+		return head - tail;
+	}
+
+	static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+	// Producer and consumer indices live on separate cache lines so the two
+	// threads do not false-share. Each side keeps a cached copy of the other
+	// side's index to avoid touching the shared line on every call.
+	alignas(64) std::atomic<size_t> m_head;
+	size_t m_cachedTail;
+	alignas(64) std::atomic<size_t> m_tail;
+	size_t m_cachedHead;
+	alignas(64) std::array<T, Capacity> m_slots;
+};
+
+} // namespace app
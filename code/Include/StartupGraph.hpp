@@ -0,0 +1,120 @@
+// StartupGraph.hpp
+// Dependency-ordered, parallel application startup.
+//
+// Every startup step names the steps it needs. Run() starts a step as soon as
+// all of its dependencies have finished: steps pinned to the main thread
+// (window, D3D device, ImGui) run on the caller, the rest on a small pool of
+// worker threads, so reading and parsing files overlaps with creating the
+// window and the device.
+//
+// Steps are added in batches: MemoryManagement::AllocAll() runs the
+// allocations, then App::Initialize() adds the Open steps, which may depend on
+// allocation steps that already ran. FormatReport() covers every batch and
+// walks back the critical path - the chain of steps that decided how long
+// startup took, which is where making a step faster actually helps.
+
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+
+class StartupGraph {
+public:
+	using Clock	 = std::chrono::steady_clock;
+	using StepFn = std::function<HRESULT()>;
+
+	enum class Affinity {
+		MainThread, // Run by the thread that calls Run()
+		Any			// Run by a worker thread
+	};
+
+	/** @brief Upper bound for the pool; startup is I/O and driver bound */
+	static constexpr uint32_t kMaxWorkers = 4;
+
+	StartupGraph();
+	~StartupGraph();
+
+	StartupGraph(const StartupGraph&)			 = delete;
+	StartupGraph& operator=(const StartupGraph&) = delete;
+
+	/**
+	 * @brief Adds a step to the next Run(); not allowed while Run() is in progress
+	 * @param name Unique; used by dependencies and in the report
+	 * @param dependencies Steps that must finish first, from this batch or an earlier one
+	 * @throws std::invalid_argument if name is already taken
+	 */
+	void Add(std::string_view name, std::initializer_list<std::string_view> dependencies,
+			 Affinity affinity, StepFn fn);
+
+	/**
+	 * @brief Runs every step added since the last call, in dependency order
+	 *
+	 * Must be called from the main thread. Once a step fails no new steps
+	 * start; the ones already running are waited for.
+	 *
+	 * @return S_OK, or the HRESULT of the first step that failed
+	 * @throws std::invalid_argument for a dependency on an unknown step
+	 * @throws std::logic_error for a dependency cycle or a call after Finish()
+	 * @throws The first exception a step threw, after the running steps finished
+	 */
+	HRESULT Run();
+
+	/** @brief Stops the worker threads; call once the last batch has run */
+	void Finish();
+
+	/**
+	 * @brief Wall time, total work and the critical path of everything run so far
+	 * @return Multi-line text without a trailing newline
+	 */
+	std::string FormatReport() const;
+
+private:
+	static constexpr size_t kNoStep = SIZE_MAX;
+
+	struct Step {
+		std::string				 name;
+		Affinity				 affinity;
+		StepFn					 fn;
+		std::vector<std::string> dependencyNames; // Resolved by Run()
+		std::vector<size_t>		 dependencies;	  // All of them; the report walks these
+		std::vector<size_t>		 dependents;
+		size_t					 waitingOn; // Dependencies not finished yet
+		size_t					 heldBy;	// Finished last of what it waited for; the report walks these
+		bool					 done;
+		Clock::time_point		 begin;
+		Clock::time_point		 end;
+	};
+
+	void WorkerFunction();
+
+	// Runs one step with m_mutex released, then releases its dependents.
+	// lock must hold m_mutex on entry and holds it again on return.
+	void RunStep(size_t index, std::unique_lock<std::mutex>& lock);
+
+	bool IsFailedLocked() const { return FAILED(m_result) || m_exception; }
+	bool IsBatchOverLocked() const { return m_remaining == 0 || (IsFailedLocked() && m_running == 0); }
+
+	mutable std::mutex		m_mutex;
+	std::condition_variable m_workReady; // Workers: m_readyAny or m_stop
+	std::condition_variable m_mainReady; // Run(): m_readyMain, or the batch is over
+
+	std::deque<Step>						m_steps; // Deque: references stay valid while adding
+	std::unordered_map<std::string, size_t> m_index;
+	size_t									m_firstPending; // First step not handed to Run() yet
+
+	std::deque<size_t> m_readyMain;
+	std::deque<size_t> m_readyAny;
+	size_t			   m_lastMainStep; // Main-thread step that finished last, or kNoStep
+	size_t			   m_remaining; // Steps of the running batch not finished
+	size_t			   m_running;	// Steps executing right now
+	HRESULT			   m_result;
+	std::exception_ptr m_exception;
+
+	std::vector<std::thread> m_workers; // Started by the first batch with worker steps; kept after Finish() for the report
+	bool					 m_stop;
+
+	Clock::time_point m_start; // First Run()
+};
+
+} // namespace app
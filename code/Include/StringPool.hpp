@@ -0,0 +1,106 @@
+// StringPool.hpp
+// Process-wide string interning.
+//
+// Strings that repeat all over the app - command names, color tags, font
+// names, file extensions - are stored once and referred to by a 32-bit id
+// (StrId). Comparing two ids is an integer compare, and an id is cheap to
+// copy, hash and store in ImVector.
+//
+// Interned text is UTF-8, null-terminated and never freed, so views returned
+// by the pool stay valid for the life of the process. Interning takes a lock;
+// reading the text of an id does not.
+
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+
+class StringPool {
+public:
+	static StringPool* Get_StringPool_Singleton();
+
+	/** @brief Id returned by Find() for text that was never interned */
+	static constexpr uint32_t kInvalidId = 0xFFFFFFFFu;
+
+	/**
+	 * @brief Returns the id of text, adding it on first use
+	 * @return 0 for the empty string
+	 */
+	uint32_t Intern(std::string_view text);
+
+	/** @brief Id of text if it was interned, kInvalidId otherwise (never inserts) */
+	uint32_t Find(std::string_view text) const;
+
+	/** @brief Text of an id returned by Intern(); lock-free */
+	std::string_view View(uint32_t id) const;
+	const char*		 CStr(uint32_t id) const { return View(id).data(); }
+
+	size_t GetCount() const { return m_count.load(std::memory_order_acquire); }
+	size_t GetBytes() const;
+
+private:
+	StringPool();
+	~StringPool() = delete; // Never destroyed, see Get_StringPool_Singleton()
+
+	struct Entry {
+		const char* text;
+		uint32_t	length;
+		uint32_t	hash;
+	};
+
+	static constexpr uint32_t kSegmentBits = 10;
+	static constexpr uint32_t kSegmentSize = 1u << kSegmentBits;
+	static constexpr uint32_t kMaxSegments = 4096; // 4M strings
+	static constexpr size_t	  kChunkBytes  = 64 * 1024;
+
+	static uint32_t Hash(std::string_view text);
+
+	const Entry& GetEntry(uint32_t id) const;
+
+	// m_mutex must be held. Returns the id or 0, and the slot where it is / would go.
+	uint32_t FindLocked(std::string_view text, uint32_t hash, size_t& slot) const;
+	void	 GrowTableLocked();
+	char*	 StoreLocked(std::string_view text);
+
+	mutable std::mutex					   m_mutex;
+	std::array<std::atomic<Entry*>, kMaxSegments> m_segments;
+	std::atomic<uint32_t>				   m_count;
+
+	std::vector<uint32_t>				 m_table; // Open addressing over ids; 0 = free slot
+	std::vector<std::unique_ptr<char[]>> m_chunks;
+	char*								 m_chunkPos;
+	size_t								 m_chunkLeft;
+	size_t								 m_bytes;
+};
+
+/**
+ * @brief Interned string handle
+ *
+ * Default-constructed ids are the empty string. Ids are only meaningful
+ * within one process run - persist the text, not the id.
+ */
+class StrId {
+public:
+	StrId() : m_id(0) {}
+	explicit StrId(std::string_view text) : m_id(StringPool::Get_StringPool_Singleton()->Intern(text)) {}
+
+	uint32_t		 GetId() const { return m_id; }
+	std::string_view View() const { return StringPool::Get_StringPool_Singleton()->View(m_id); }
+	const char*		 c_str() const { return View().data(); }
+	size_t			 size() const { return View().size(); }
+	bool			 empty() const { return m_id == 0; }
+
+	bool operator==(const StrId& other) const { return m_id == other.m_id; }
+	bool operator!=(const StrId& other) const { return m_id != other.m_id; }
+
+private:
+	uint32_t m_id;
+};
+
+} // namespace app
+
+template <>
+struct std::hash<app::StrId> {
+	size_t operator()(const app::StrId& id) const noexcept { return id.GetId(); }
+};
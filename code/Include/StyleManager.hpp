@@ -22,9 +22,13 @@ public:
 	virtual void Tick() override;
 	virtual void Close() override;
 
+	// Open() split in two: LoadConfiguration() (no ImGui, any thread), then this
+	void FinishOpen(bool configLoaded);
+
 	// Configuration management
-	bool LoadConfiguration();
-	bool SaveConfiguration();
+	bool LoadConfiguration(std::wostream& out = std::wcout, std::wostream& err = std::wcerr);
+	bool SaveConfiguration(); // Captures the ImGui style first; main thread
+	bool WriteConfiguration(); // Writes what was captured last; any thread
 
 	// Apply the loaded style to ImGui
 	void ApplyStyleToImGui();
@@ -64,6 +68,7 @@ private:
 	StyleConfiguration m_styleConfig;
 	std::wstring m_configFilePath;
 	bool m_bConfigLoaded;
+	bool m_bClosed; // Set by Close(); the destructor only saves if Close() never ran
 };
 
 } // namespace app
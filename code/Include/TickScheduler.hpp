@@ -0,0 +1,129 @@
+// TickScheduler.hpp
+// Runs the per-frame and periodic work of the services, phase by phase.
+//
+// Each registration names the phase it runs in, an optional period, a priority
+// and an optional enable flag:
+// - PreFrame: main thread, after the message pump and before the ImGui frame
+// - UI: main thread, inside the ImGui frame (App::RenderUI)
+// - PostPresent: main thread, after the frame was presented
+// - Background: the scheduler's own thread; only for work that is safe there
+//
+// Within a phase, entries run by ascending priority, then in the order they
+// were added. A period makes an entry run at most once per that many
+// milliseconds of wall-clock time, however fast or slow frames are. A disabled
+// entry costs a load and a branch: it reads no clock and calls nothing.
+//
+// Every call is timed, so the Debug window can show what each entry costs.
+//
+// Add() everything before StartBackground(); the lists do not change after.
+
+#pragma once
+
+#include "PCH.hpp"
+#include "Component.hpp"
+#include "ConsoleVariables.hpp"
+
+namespace app {
+
+enum class TickPhase : uint8_t { PreFrame, UI, PostPresent, Background };
+
+inline constexpr uint32_t kTickPhaseCount = 4;
+
+const char* TickPhaseName(TickPhase phase);
+
+struct TickOptions {
+	TickPhase	   phase	  = TickPhase::UI;
+	uint32_t	   periodMs	  = 0;		 // 0 runs it on every pass of the phase
+	const CVarInt* periodCVar = nullptr; // Period in ms read on every run; overrides periodMs
+	int32_t		   priority	  = 0;		 // Lower runs first
+	const bool*	   enabled	  = nullptr; // Skipped while *enabled is false; must be nullptr for Background
+};
+
+class TickScheduler {
+public:
+	/** @brief Cost of one entry so far */
+	struct Timing {
+		const char* name;
+		TickPhase	phase;
+		int32_t		priority;
+		uint32_t	periodMs; // Current period; 0 for every pass
+		uint64_t	runs;
+		double		lastUs;
+		double		maxUs;
+		double		totalUs;
+	};
+
+	TickScheduler();
+	~TickScheduler();
+
+	TickScheduler(const TickScheduler&)			   = delete;
+	TickScheduler& operator=(const TickScheduler&) = delete;
+
+	/** @brief Schedules component->Tick() */
+	template <Component T>
+	void Add(const char* name, T* component, const TickOptions& options) {
+		AddEntry(name, component, [](void* self) { static_cast<T*>(self)->T::Tick(); }, options);
+	}
+
+	/** @brief Schedules (object->*Method)(), for services with more than one kind of periodic work */
+	template <auto Method, typename T>
+	void Add(const char* name, T* object, const TickOptions& options) {
+		AddEntry(name, object, [](void* self) { (static_cast<T*>(self)->*Method)(); }, options);
+	}
+
+	/** @brief Schedules a plain function */
+	void Add(const char* name, void (*function)(), const TickOptions& options);
+
+	/** @brief Runs the due entries of a main-thread phase */
+	void Run(TickPhase phase);
+
+	/** @brief Starts the thread that runs TickPhase::Background */
+	void StartBackground();
+
+	/** @brief Stops and joins it; entries that are running finish first */
+	void StopBackground();
+
+	std::vector<Timing> GetTimings() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	// Cold half of an entry; stays put while the entry lists are sorted
+	struct Stats {
+		const char*			  name;
+		TickPhase			  phase;
+		std::atomic<uint64_t> runs; // Written by the thread that runs the phase
+		std::atomic<int64_t>  lastNs;
+		std::atomic<int64_t>  maxNs;
+		std::atomic<int64_t>  totalNs;
+	};
+
+	// Hot half, walked on every pass of its phase
+	struct Entry {
+		const bool*	   enabled;
+		void*		   object;
+		void		   (*call)(void*);
+		int64_t		   nextDue; // Clock ticks; 0 until the first run
+		uint32_t	   periodMs;
+		const CVarInt* periodCVar;
+		int32_t		   priority;
+		Stats*		   stats;
+	};
+
+	void AddEntry(const char* name, void* object, void (*call)(void*), const TickOptions& options);
+
+	// Runs what is due at now; returns the earliest nextDue left (INT64_MAX if none)
+	static int64_t RunEntries(std::vector<Entry>& entries, int64_t now);
+
+	void BackgroundLoop();
+
+	std::vector<Entry> m_phases[kTickPhaseCount];
+	std::deque<Stats>  m_stats; // A deque, so Entry::stats stays valid
+
+	std::thread				m_background;
+	std::mutex				m_backgroundMutex;
+	std::condition_variable m_backgroundWake;
+	bool					m_backgroundStop;
+};
+
+} // namespace app
@@ -0,0 +1,164 @@
+// Utf.hpp
+// UTF-8 / UTF-16 / UTF-32 transcoding, validation and case folding.
+//
+// Every text conversion in the app (Conv, ImStr, the console, the output
+// sinks, the native console writer) goes through these functions instead of
+// locale-dependent or deprecated CRT facilities. Runs of ASCII - nearly all
+// console text - are handled 16 or 32 bytes at a time (SSE2 and, when the CPU
+// has it, AVX2 on x86; NEON on ARM64); other characters go through a scalar
+// decoder.
+//
+// Conventions:
+//   - Lengths are in code units and never include a terminator.
+//   - Invalid input (malformed UTF-8, lone surrogates, values past U+10FFFF)
+//     becomes U+FFFD. The *Length queries count it the same way, so a buffer
+//     sized by a query always fits the conversion exactly.
+//   - Converters write at most dstCapacity units, never split a character,
+//     and return the number of units written.
+//   - The "Wide" templates take the code unit type: 2-byte units (char16_t,
+//     wchar_t on Windows, ImWchar16) are UTF-16, 4-byte units (char32_t,
+//     ImWchar32) are UTF-32. They are instantiated in Utf.cpp for char16_t,
+//     char32_t, wchar_t, unsigned short and unsigned int.
+
+#pragma once
+
+#include "PCH.hpp"
+
+namespace app {
+namespace utf {
+
+constexpr char32_t kReplacementChar = 0xFFFD;
+
+/** @brief Number of leading bytes below 0x80 */
+size_t CountAscii(const char* src, size_t len);
+
+/** @brief True if src is well-formed UTF-8 (no overlongs, surrogates or values past U+10FFFF) */
+bool IsValidUtf8(const char* src, size_t len);
+
+/** @brief Units Utf8ToWide() produces for the whole input */
+template <typename Unit>
+size_t WideLengthFromUtf8(const char* src, size_t len);
+
+template <typename Unit>
+size_t Utf8ToWide(const char* src, size_t len, Unit* dst, size_t dstCapacity);
+
+/** @brief Bytes WideToUtf8() produces for the whole input */
+template <typename Unit>
+size_t Utf8LengthFromWide(const Unit* src, size_t len);
+
+template <typename Unit>
+size_t WideToUtf8(const Unit* src, size_t len, char* dst, size_t dstCapacity);
+
+/**
+ * @brief Null-terminated, truncating conversions for fixed-size buffers
+ * @param dstSize Size of dst including room for the terminator (must be > 0)
+ * @return Units written, terminator excluded
+ */
+template <typename Unit>
+size_t WideToUtf8Cstr(const Unit* src, char* dst, size_t dstSize);
+
+template <typename Unit>
+size_t Utf8ToWideCstr(const char* src, Unit* dst, size_t dstSize);
+
+size_t Utf16ToUtf32(const char16_t* src, size_t len, char32_t* dst, size_t dstCapacity);
+size_t Utf32ToUtf16(const char32_t* src, size_t len, char16_t* dst, size_t dstCapacity);
+
+/** @brief Length of a null-terminated string of any unit type */
+template <typename Unit>
+size_t Length(const Unit* src) {
+	size_t len = 0;
+	if (src)
+		while (src[len]) len++;
+	return len;
+}
+
+// Owning helpers
+
+std::wstring ToWide(std::string_view utf8);
+std::string	 ToUtf8(std::wstring_view wide);
+
+/** @brief Appends wide as UTF-8, growing out by exactly the bytes needed */
+void AppendUtf8(std::string& out, std::wstring_view wide);
+
+// Case folding and case-insensitive comparison
+//
+// Simple Unicode case folding (one code point to one) for Latin, Greek,
+// Cyrillic, Armenian, Georgian, Glagolitic, Deseret and fullwidth letters.
+// Foldings that would make the UTF-8 encoding longer are left out, so
+// folding in place never grows a string; multi-character foldings (U+00DF
+// to "ss") are not applied. Invalid bytes and lone surrogates are left as
+// they are and compare by value. ASCII runs are folded and compared 16 bytes
+// at a time.
+
+/** @brief Simple case folding of one code point (lowercase for the scripts above) */
+char32_t FoldCodePoint(char32_t cp);
+
+/** @brief Lowercases A-Z in place; every other byte is untouched */
+void ToLowerAscii(char* text, size_t len);
+
+/**
+ * @brief Folds UTF-8 in place
+ * @return New length; never more than len
+ */
+size_t FoldCase(char* text, size_t len);
+void   FoldCase(std::string& text);
+
+/**
+ * @brief Folds src into dst; dstCapacity >= src.size() always fits everything
+ * @return Bytes written, never splitting a character
+ */
+size_t FoldCase(std::string_view src, char* dst, size_t dstCapacity);
+
+/** @brief Folds UTF-16 / UTF-32 in place; the length never changes */
+template <typename Unit>
+void FoldCaseWide(Unit* text, size_t len);
+void FoldCase(std::wstring& text);
+
+/** @brief <0, 0 or >0 ordering by folded code point */
+int	 CompareNoCase(std::string_view a, std::string_view b);
+bool EqualsNoCase(std::string_view a, std::string_view b);
+bool StartsWithNoCase(std::string_view text, std::string_view prefix);
+
+template <typename Unit>
+int CompareNoCaseWide(const Unit* a, size_t aLen, const Unit* b, size_t bLen);
+
+inline int CompareNoCase(std::wstring_view a, std::wstring_view b) {
+	return CompareNoCaseWide(a.data(), a.size(), b.data(), b.size());
+}
+inline bool EqualsNoCase(std::wstring_view a, std::wstring_view b) { return CompareNoCase(a, b) == 0; }
+
+/**
+ * @brief FNV-1a of the folded text as UTF-8
+ *
+ * Strings that compare equal hash equal, across encodings too:
+ * HashNoCase("Help") == HashNoCaseWide(L"HELP", 4).
+ */
+uint32_t HashNoCase(std::string_view text);
+
+template <typename Unit>
+uint32_t HashNoCaseWide(const Unit* text, size_t len);
+
+// Transparent functors for case-insensitive containers, e.g.
+// std::unordered_map<std::string, T, NoCaseHash, NoCaseEqual> or
+// std::map<std::wstring, T, NoCaseLess>; lookups take views without copying.
+
+struct NoCaseHash {
+	using is_transparent = void;
+	size_t operator()(std::string_view text) const { return HashNoCase(text); }
+	size_t operator()(std::wstring_view text) const { return HashNoCaseWide(text.data(), text.size()); }
+};
+
+struct NoCaseEqual {
+	using is_transparent = void;
+	bool operator()(std::string_view a, std::string_view b) const { return EqualsNoCase(a, b); }
+	bool operator()(std::wstring_view a, std::wstring_view b) const { return EqualsNoCase(a, b); }
+};
+
+struct NoCaseLess {
+	using is_transparent = void;
+	bool operator()(std::string_view a, std::string_view b) const { return CompareNoCase(a, b) < 0; }
+	bool operator()(std::wstring_view a, std::wstring_view b) const { return CompareNoCase(a, b) < 0; }
+};
+
+} // namespace utf
+} // namespace app
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "PCH.hpp"
-#include "MemoryManagement.hpp"
+#include "Master.hpp"
+#include "MemoryTags.hpp"
+#include "StringPool.hpp"
 
 namespace app {
 
-class WindowClass : public MemoryManagement {
+class FrameArena;
+
+class WindowClass final : public Master {
 
 public:
 
@@ -18,6 +22,9 @@ public:
 
 	void Draw(std::string_view label);
 
+	// A listing job still has to hand its result back; see LazyPanel.hpp
+	bool IsBusy() const { return m_listing; }
+
 protected:
 
 	void DrawMenu();
@@ -30,11 +37,30 @@ protected:
 	HRESULT renameFile(const fs::path& old_Path, const fs::path& new_Path);
     HRESULT deleteFile(const fs::path& Path);
 
+	// Re-reads m_currentPath when it changed, after a rename/delete, or once the listing is old
+	void RefreshListing();
+
 private:
 
+	struct ListedEntry {
+		fs::path path;
+		bool	 isDirectory;
+		bool	 isFile;
+		StrId	 extension; // Interned UTF-8 extension of a file, empty otherwise
+	};
+
+	// Runs as a job; a directory that cannot be read lists as empty instead of throwing
+	static std::vector<ListedEntry> ListDirectory(const fs::path& path);
+
 	fs::path		  m_currentPath;
 	fs::path		  m_selectedEntry;
-	MemoryManagement* m_memory;
+	bool*			  m_shown;		// MemoryManagement::m_bShow_FileSys_window, set by Open()
+	FrameArena*		  m_frameArena; // Labels and UTF-8 paths are built here every frame
+
+	TaggedVector<ListedEntry, MemTag::FileBrowser> m_entries; // Contents of m_listedPath
+	fs::path									   m_listedPath;
+	double										   m_listedTime; // ImGui::GetTime() of the last read; < 0 forces a read
+	bool										   m_listing;	 // A read is running as a job
     bool m_renameDialogOpen;
     bool m_deleteDialogOpen;
 
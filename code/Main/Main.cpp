@@ -35,11 +35,29 @@ _Use_decl_annotations_ int WINAPI wWinMain(_In_ HINSTANCE	  hInstance,
 
     int i = 0;
 
+    // -single: hand the arguments to the running instance and skip the whole
+    // startup; leaves the same way as below, without the static destructors
+    if (app::CommandLineArguments::ForwardToRunningInstance()) {
+        std::fflush(nullptr);
+        std::quick_exit(EXIT_SUCCESS);
+    }
+
+    // Before the first ImGui::MemAlloc: blocks from malloc cannot be freed into the pools
+    app::PoolAllocator::Install();
+
     app::MemoryManagement* memory = app::MemoryManagement::Get_MemoryManagement_Singleton();
     if(memory) memory->AllocAll();
-    app::App* m_app = memory->Get_App();
-    if(m_app) m_app->Run(hInstance);
-    memory->Destroy_All();
+    app::App* m_app = memory->Get<app::App>();
+    int exitCode = EXIT_SUCCESS;
+    if(m_app) exitCode = m_app->Run(hInstance);
+
+    // Run() has stopped the worker threads, saved the configs (it waits for
+    // both writers, even past its flush budget), flushed the logs and released
+    // the GPU. What is left is process-lifetime heap memory, which the OS
+    // reclaims faster than Destroy_All() and the static destructors could free
+    // it, so skip both.
+    std::fflush(nullptr);
+    std::quick_exit(exitCode);
 
 	try {
 		
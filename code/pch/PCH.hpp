@@ -1,29 +1,40 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <bit>
+#include <charconv>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <iostream>
 #include <io.h>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <queue>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 #include <locale>
 #include <codecvt>
 
 #include <cctype>
 #include <cstdint>
+#include <cstring>
 #include <cstdio>
 #include <fstream>      // For file I/O
+#include <functional>
+#include <future>
 #include <sstream>      // For string streams
 #include <stdint.h>
 #include <stdio.h>
@@ -54,6 +65,8 @@
 
 #include <freetype\freetype.h>
 
+#include "Features.hpp"
+
 #include "imconfig.h"
 
 #include "imgui.h"
@@ -67,8 +80,10 @@
 
 
 
+#if APP_FEATURE_IMPLOT
 #include "implot.h"
 #include "implot_internal.h"
+#endif
 
 #include "plutovg.h"
 #include "plutosvg.h"
@@ -79,6 +94,9 @@
 #include <rfl.hpp>
 #include <rfl/json.hpp>
 
+// Emit ANSI sequences instead of SetConsoleTextAttribute so colours can be
+// captured into CustomOutput's line buffer (the console has VT processing on)
+#define TERMCOLOR_USE_ANSI_ESCAPE_SEQUENCES
 #include <termcolor/termcolor.hpp>
 
 
@@ -0,0 +1,120 @@
+// AnsiParser.cpp
+// Implementation of the streaming ANSI SGR parser
+
+#include "PCH.hpp"
+#include "Classes.hpp"
+#include "AnsiParser.hpp"
+#include "ImGuiTermcolor.hpp"
+
+namespace app {
+
+AnsiParser::AnsiParser() :
+m_state(State::Text),
+m_params(),
+m_paramCount(0),
+m_color(0),
+m_extended(0),
+m_basic(-1),
+m_bold(false) {}
+
+void AnsiParser::Reset() {
+	m_state		 = State::Text;
+	m_paramCount = 0;
+	m_color		 = 0;
+	m_extended	 = 0;
+	m_basic		 = -1;
+	m_bold		 = false;
+}
+
+bool AnsiParser::ApplySgr() {
+	// "ESC[m" is the same as "ESC[0m"
+	if (m_paramCount == 0) m_params[m_paramCount++] = 0;
+
+	for (int k = 0; k < m_paramCount; k++) {
+		const int p = m_params[k];
+		if (p == 0) {
+			m_extended = 0;
+			m_basic	   = -1;
+			m_bold	   = false;
+		} else if (p == 1) {
+			m_bold = true;
+		} else if (p == 22) {
+			m_bold = false;
+		} else if (p >= 30 && p <= 37) {
+			m_basic = p - 30;
+		} else if (p >= 90 && p <= 97) {
+			m_basic = p - 90 + 8;
+		} else if (p == 39) {
+			m_extended = 0;
+			m_basic	   = -1;
+		} else if (p == 38 || p == 48) {
+			// Extended color: 5;n or 2;r;g;b. Background (48) is parsed only to skip it.
+			const int mode = k + 1 < m_paramCount ? m_params[k + 1] : -1;
+			if (mode == 5 && k + 2 < m_paramCount) {
+				if (p == 38) {
+					m_extended = PaletteColor(m_params[k + 2]);
+					m_basic	   = -1;
+				}
+				k += 2;
+			} else if (mode == 2 && k + 4 < m_paramCount) {
+				if (p == 38) {
+					m_extended = IM_COL32(std::min(m_params[k + 2], 255), std::min(m_params[k + 3], 255),
+										  std::min(m_params[k + 4], 255), 255);
+					m_basic	   = -1;
+				}
+				k += 4;
+			} else {
+				break; // Malformed: ignore the rest
+			}
+		}
+		// Background, underline, blink, ... have no ImGui equivalent
+	}
+
+	ImU32 color = m_extended;
+	if (m_basic >= 0) color = PaletteColor(m_bold && m_basic < 8 ? m_basic + 8 : m_basic);
+
+	if (color == m_color) return false;
+	m_color = color;
+	return true;
+}
+
+ImU32 AnsiParser::PaletteColor(int index) {
+	// Basic 16 colors: shared with the [tag] convention
+	static const std::array<ImU32, 16> basic = []() {
+		static const char* const tags[16] = {
+			"[grey]",		"[red]",		 "[green]",		   "[yellow]",
+			"[blue]",		"[magenta]",	 "[cyan]",		   "[white]",
+			"[grey]",		"[bright_red]",	 "[bright_green]", "[bright_yellow]",
+			"[bright_blue]", "[bright_magenta]", "[bright_cyan]", "[bright_white]"};
+		std::array<ImU32, 16> colors{};
+		for (int i = 0; i < 16; i++)
+			colors[i] = ImGui::ColorConvertFloat4ToU32(ImGuiTermcolor::TagToColor(tags[i]));
+		return colors;
+	}();
+
+	index = std::clamp(index, 0, 255);
+	if (index < 16) return basic[index];
+
+	if (index < 232) {
+		// 6x6x6 color cube
+		static const int levels[6] = {0, 95, 135, 175, 215, 255};
+		const int		 cube	   = index - 16;
+		return IM_COL32(levels[cube / 36], levels[(cube / 6) % 6], levels[cube % 6], 255);
+	}
+
+	// Grey ramp
+	const int grey = 8 + (index - 232) * 10;
+	return IM_COL32(grey, grey, grey, 255);
+}
+
+std::string_view AnsiParser::Strip(std::string_view line, std::string& out) {
+	if (line.find('\x1b') == std::string_view::npos) return line;
+
+	out.clear();
+	AnsiParser parser;
+	parser.Feed(
+		line, [&out](std::string_view text) { out.append(text); }, [](ImU32) {});
+	return out;
+}
+
+} // namespace app
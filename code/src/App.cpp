@@ -9,21 +9,52 @@ namespace app {
 
 // Static instance
 App* App::s_instance = nullptr;
+std::atomic<bool> App::s_exitRequested{false};
+
+namespace {
+
+// Budget for draining the logs on exit while the config files are saved; a
+// save that takes longer is still waited for, after the GPU is released
+constexpr auto kShutdownFlushTimeout = std::chrono::seconds(2);
+
+/**
+ * @brief Runs fn on a detached thread
+ *
+ * Unlike std::async, the returned future does not block when destroyed;
+ * Shutdown() decides when to wait for it.
+ */
+std::future<void> RunDetached(std::function<void()> fn) {
+    auto task = std::make_shared<std::packaged_task<void()>>(std::move(fn));
+    std::future<void> result = task->get_future();
+    std::thread([task]() { (*task)(); }).detach();
+    return result;
+}
+
+} // namespace
 
 App::App() :
     m_memory(nullptr),
     m_console(nullptr),
     m_cmdArgs(nullptr),
+    m_inputHandler(nullptr),
+    m_controlServer(nullptr),
     m_window(nullptr),
     m_font_manager(nullptr),
-    m_font_manager_window(nullptr),
-    m_debug_window(nullptr),
     m_configManager(nullptr),
-    m_window_obj(nullptr),
+    m_styleManager(nullptr),
+    m_frameArena(nullptr),
+#if APP_FEATURE_FILE_BROWSER
+    m_fileBrowser(&MemoryManagement::Get_MemoryManagement_Singleton()->m_bShow_FileSys_window),
+#endif
+    m_debugPanel(&MemoryManagement::Get_MemoryManagement_Singleton()->m_bShow_Debug_window),
+#if APP_FEATURE_FONT_MANAGER_UI
+    m_fontManagerPanel(&MemoryManagement::Get_MemoryManagement_Singleton()->m_bShow_FontManager_window),
+#endif
     m_renderer(nullptr),
     m_HeapAlloc(nullptr),
     m_io(nullptr),
-    m_style(nullptr) {
+    m_style(nullptr),
+    m_clearColor(0.15f, 0.15f, 0.15f, 1.0f) {
     
     s_instance = this;
 
@@ -31,15 +62,20 @@ App::App() :
 }
 
 HRESULT App::Alloc() {
+    // Events published on this thread are delivered at once, the rest in PreFrame
+    EventBus::Get_EventBus_Singleton()->BindToCurrentThread();
+
     m_memory = MemoryManagement::Get_MemoryManagement_Singleton();
 
-    m_cmdArgs = m_memory->Get_CommandLineArguments();
-    m_console = m_memory->Get_OutputConsole();
-    m_consoleWindow = m_memory->Get_ConsoleWindow();
-    m_configManager = m_memory->Get_ConfigManager();
-    m_font_manager = m_memory->Get_FontManager();
-    m_font_manager_window = m_memory->Get_FontManagerWindow();
-    m_debug_window = m_memory->Get_DebugWindow();
+    m_cmdArgs = m_memory->Get<CommandLineArguments>();
+    m_console = m_memory->Get<OutputConsole>();
+    m_consoleWindow = m_memory->Get<ConsoleWindow>();
+    m_inputHandler = m_memory->Get<ConsoleInputHandler>();
+    m_controlServer = m_memory->Get<ControlServer>();
+    m_configManager = m_memory->Get<ConfigManager>();
+    m_font_manager = m_memory->Get<FontManager>();
+    m_styleManager = m_memory->Get<StyleManager>();
+    m_frameArena = m_memory->Get<FrameArena>();
 
     return S_OK;
 }
@@ -52,49 +88,206 @@ int App::Run(_In_ HINSTANCE hInstance) {
     Alloc();
     Initialize(hInstance);
     MainLoop();
-    return 0;
+    Shutdown();
+    return EXIT_SUCCESS;
 }
 
 void App::Initialize(_In_ HINSTANCE hInstance) {
-// Initialize memory management
-
-
-
-m_cmdArgs->Open();
-
-// Connect OutputConsole with ConsoleWindow BEFORE opening console
-// This ensures all messages appear in both consoles
-m_console->SetConsoleWindow(m_consoleWindow);
-
-m_console->Open();
-
-
-m_console->Out << tc::green << "\nHello From console class!\n" << tc::reset;
-
-
-m_console->Out << tc::green << "Memory management initialized" << std::endl;
-m_console->Out << L"=== Application Starting ===" << std::endl << tc::reset;
-
+    using Affinity = StartupGraph::Affinity;
 
     // Initialize DirectX components
-    m_HeapAlloc = m_memory->Get_ExampleDescriptorHeapAllocator();
-    m_window = m_memory->Get_WindowManager();
+    m_HeapAlloc = m_memory->Get<ExampleDescriptorHeapAllocator>();
+    m_window = m_memory->Get<WindowManager>();
     
     // Get DX12 Renderer from memory management (uses smart pointer)
-    m_renderer = m_memory->Get_DX12Renderer();
+    m_renderer = m_memory->Get<DX12Renderer>();
+
+    StyleManager* styleManager = m_styleManager;
+    bool styleLoaded = false; // Written by "style_config.json", read by "style"
+    // Written by the two config steps on a worker; the main-thread steps that
+    // depend on them print it, so nothing touches the console while it reopens
+    std::wostringstream configLog;
+    std::wostringstream styleLog;
+
+    // Steps that own the console, the window, the device or ImGui stay on this
+    // thread; the rest only read and parse files, and overlap with them. All
+    // steps finish inside Run(), so capturing locals by reference is safe.
+    StartupGraph& startup = m_memory->GetStartupGraph();
+
+    startup.Add("command line", {}, Affinity::MainThread, [this]() {
+        m_cmdArgs->Open();
+        return S_OK;
+    });
+
+    startup.Add("native console", {"command line"}, Affinity::MainThread, [this]() {
+        // Connect OutputConsole with ConsoleWindow BEFORE opening console
+        // This ensures all messages appear in both consoles
+        m_console->SetConsoleWindow(m_consoleWindow);
+        m_console->Open();
+
+        m_console->Out << tc::green << "\nHello From console class!\n" << tc::reset;
+        m_console->Out << tc::green << "Memory management initialized" << std::endl;
+        m_console->Out << L"=== Application Starting ===" << std::endl << tc::reset;
+        return S_OK;
+    });
+
+    // Start reading commands from stdin (console or piped file)
+    startup.Add("stdin reader", {"native console"}, Affinity::MainThread, [this]() {
+        m_inputHandler->Open();
+        return S_OK;
+    });
+
+    // Loads the saved settings, including the archived cvars; runs after the
+    // command line so the saved values still win, as they always have
+    startup.Add("config.json", {"command line"}, Affinity::Any, [this, &configLog]() {
+        m_configManager->Open(configLog, configLog);
+        return S_OK;
+    });
+
+    startup.Add("style_config.json", {}, Affinity::Any, [styleManager, &styleLoaded, &styleLog]() {
+        styleLoaded = styleManager->LoadConfiguration(styleLog, styleLog);
+        return S_OK;
+    });
+
+    startup.Add("font files", {}, Affinity::Any, [this]() {
+        m_font_manager->PreloadFontFiles();
+        return S_OK;
+    });
+
+    // Opens the log file named by the 'log_file' cvar, which config.json may set
+    startup.Add("console window", {"native console", "config.json"}, Affinity::MainThread, [this, &configLog]() {
+        m_console->Out << configLog.str();
+        m_consoleWindow->Open();
+        return S_OK;
+    });
+
+    startup.Add("window", {"command line"}, Affinity::MainThread, [this, hInstance]() {
+        OpenWindow(hInstance);
+        return S_OK;
+    });
+
+    startup.Add("d3d device", {"window"}, Affinity::MainThread, [this]() {
+        CreateDevice();
+        return S_OK;
+    });
+
+    startup.Add("imgui", {"window", "font files"}, Affinity::MainThread, [this]() {
+        SetupImGui();
+        return S_OK;
+    });
+
+    startup.Add("imgui backend", {"imgui", "d3d device"}, Affinity::MainThread, [this]() {
+        SetupImGuiBackend();
+        return S_OK;
+    });
+
+    startup.Add("fonts", {"imgui"}, Affinity::MainThread, [this]() {
+        // Load Windows system fonts for variety
+        m_console->Out << tc::cyan << "Loading Windows system fonts..." << tc::reset << std::endl;
+        m_font_manager->LoadFonts();
+        m_console->Out << tc::green << "✓ Loaded " << m_font_manager->GetFontCount() << " fonts" << tc::reset << std::endl;
+
+        // Auto-load ImGui default fonts (built-in, no external files needed)
+        int defaultFontsLoaded = m_font_manager->LoadImGuiDefaultFonts();
+        m_console->Out << tc::cyan << "Loaded " << defaultFontsLoaded << " ImGui default font(s)" << tc::reset << std::endl;
+
+        // Note: Windows fonts can be optionally loaded via:
+        // int winFontsLoaded = m_font_manager->LoadWindowsFonts("C:\\Windows\\Fonts");
+        // Or manually through the Font Manager Window UI
+        return S_OK;
+    });
+
+    // Apply the saved style, then DPI scaling on top of the loaded or default style
+    startup.Add("style", {"imgui", "style_config.json"}, Affinity::MainThread,
+                [this, styleManager, &styleLoaded, &styleLog]() {
+        m_console->Out << styleLog.str();
+        styleManager->FinishOpen(styleLoaded);
+        m_style = &ImGui::GetStyle();
+        m_style->ScaleAllSizes(m_window->get_main_scale());
+        return S_OK;
+    });
+
+    // Start the control endpoint if 'control_endpoint' was saved in the config
+    startup.Add("control server", {"config.json"}, Affinity::MainThread, [this]() {
+        m_controlServer->Open();
+        return S_OK;
+    });
+
+    const HRESULT hr = startup.Run();
+    startup.Finish();
+    if (FAILED(hr)) {
+        char message[64];
+        std::snprintf(message, sizeof(message), "Startup failed (HRESULT 0x%08lX)", static_cast<unsigned long>(hr));
+        throw std::runtime_error(message);
+    }
+
+    m_console->Out << tc::cyan << startup.FormatReport() << tc::reset << std::endl;
+
+    // The clear color and the font size follow the config and the style from
+    // now on; take their current values once
+    EventBus* events = EventBus::Get_EventBus_Singleton();
+    events->Subscribe<ConfigChanged, &App::OnConfigChanged>(this);
+    events->Subscribe<StyleChanged, &App::OnStyleChanged>(this);
+    OnConfigChanged(ConfigChanged{nullptr});
+
+    // Background jobs of the services; the main thread is the last core
+    JobSystem* jobs = JobSystem::Get_JobSystem_Singleton();
+    const uint32_t workers = cvars::JobWorkers.Get() > 0 ? static_cast<uint32_t>(cvars::JobWorkers.Get())
+                                                          : std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    jobs->Start(workers);
+    m_console->Out << tc::cyan << "Job system: " << workers << " worker thread(s)" << tc::reset << std::endl;
+
+    // Commands queued by the stdin reader thread, the control endpoint and later
+    // -single launches (plus this launch's -exec commands on the first frame),
+    // then the events and the lines other threads published and logged
+    m_scheduler.Add("command line", m_cmdArgs, {.phase = TickPhase::PreFrame});
+    m_scheduler.Add("stdin commands", m_inputHandler, {.phase = TickPhase::PreFrame});
+    m_scheduler.Add("control server", m_controlServer, {.phase = TickPhase::PreFrame});
+    m_scheduler.Add<&EventBus::Dispatch>("events", events, {.phase = TickPhase::PreFrame});
+    m_scheduler.Add<&JobSystem::DispatchMainThread>("job continuations", jobs, {.phase = TickPhase::PreFrame});
+    m_scheduler.Add<&CustomOutput::DispatchDeferred>("deferred output", &m_console->Out,
+                                                     {.phase = TickPhase::PreFrame});
+    m_scheduler.Add("memory stats", &PoolAllocator::Sample, {.phase = TickPhase::PreFrame});
+
+    // Panels drawn by RenderUI(), after the console has picked up ImGui's debug log.
+    // The tool windows are created the first time they are shown
+    m_scheduler.Add("console window", m_consoleWindow, {.phase = TickPhase::UI, .priority = -1});
+#if APP_FEATURE_FILE_BROWSER
+    m_scheduler.Add("file browser", &m_fileBrowser,
+                    {.phase = TickPhase::UI, .enabled = &m_memory->m_bShow_FileSys_window});
+#endif
+    m_scheduler.Add("debug window", &m_debugPanel,
+                    {.phase = TickPhase::UI, .enabled = &m_memory->m_bShow_Debug_window});
+#if APP_FEATURE_FONT_MANAGER_UI
+    m_scheduler.Add("font manager window", &m_fontManagerPanel,
+                    {.phase = TickPhase::UI, .enabled = &m_memory->m_bShow_FontManager_window});
+#endif
+
+    m_scheduler.Add<&ConsoleWindow::FlushLogFile>("log file flush", m_consoleWindow,
+                                                  {.phase = TickPhase::PostPresent, .periodCVar = &cvars::LogFlushMs});
 
-    // Open window and initialize DirectX
-    OpenWindow(hInstance);
+    // Frees the tool windows that stayed closed for panel_release_s
+#if APP_FEATURE_FILE_BROWSER
+    m_scheduler.Add<&LazyPanel<WindowClass>::Collect>("file browser release", &m_fileBrowser,
+                                                      {.phase = TickPhase::PostPresent, .periodMs = 1000});
+#endif
+    m_scheduler.Add<&LazyPanel<DebugWindow>::Collect>("debug window release", &m_debugPanel,
+                                                      {.phase = TickPhase::PostPresent, .periodMs = 1000});
+#if APP_FEATURE_FONT_MANAGER_UI
+    m_scheduler.Add<&LazyPanel<FontManagerWindow>::Collect>("font manager window release", &m_fontManagerPanel,
+                                                            {.phase = TickPhase::PostPresent, .periodMs = 1000});
+#endif
 
-    // Setup ImGui
-    SetupImGui();
-    SetupImGuiBackend();
+    m_scheduler.Add("process memory", &DebugWindow::SampleProcessMemory,
+                    {.phase = TickPhase::Background, .periodMs = 1000});
+    m_scheduler.StartBackground();
 }
 
 void App::OpenWindow(_In_ HINSTANCE hInstance) {
     m_window->WMCreateWindow(hInstance, m_cmdArgs);
-    m_consoleWindow->Open();
+}
 
+void App::CreateDevice() {
     // Initialize Direct3D
     if (!m_renderer->CreateDeviceD3D(m_window->GetHWND(), m_HeapAlloc)) {
         m_renderer->CleanupDeviceD3D();
@@ -112,16 +305,17 @@ void App::OpenWindow(_In_ HINSTANCE hInstance) {
     // Show the window
     ::ShowWindow(m_window->GetHWND(), SW_SHOWMAXIMIZED);
     ::UpdateWindow(m_window->GetHWND());
-
-
 }
 
 void App::SetupImGui() {
     // Setup Dear ImGui context
     IMGUI_CHECKVERSION();
+    // wWinMain installs the pooled allocator before anything allocates through ImGui
+    IM_ASSERT(PoolAllocator::IsInstalled());
     ImGui::CreateContext();
     m_io = &ImGui::GetIO();
     m_memory->Set_ImGuiIO(m_io);
+    m_font_manager->GetIo(m_io);
     
     m_io->ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard; // Enable Keyboard Controls
     m_io->ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;  // Enable Gamepad Controls
@@ -140,7 +334,7 @@ void App::SetupImGui() {
     
     // Try to load Arial font from Windows Fonts directory
     const char* arialPath = "C:\\Windows\\Fonts\\arial.ttf";
-    ImFont* font = m_io->Fonts->AddFontFromFileTTF(arialPath, 16.0f, &config);
+    ImFont* font = m_font_manager->AddFontFile(arialPath, 16.0f, &config);
     
     // Add emoji support by merging Segoe UI Emoji font
     ImFontConfig emojiConfig;
@@ -161,7 +355,7 @@ void App::SetupImGui() {
     };
     
     const char* emojiPath = "C:\\Windows\\Fonts\\seguiemj.ttf"; // Segoe UI Emoji
-    ImFont* emojiFont = m_io->Fonts->AddFontFromFileTTF(emojiPath, 16.0f, &emojiConfig, emoji_ranges);
+    ImFont* emojiFont = m_font_manager->AddFontFile(emojiPath, 16.0f, &emojiConfig, emoji_ranges);
     
     // Fallback to default font if Arial cannot be loaded
     if (!font) {
@@ -183,7 +377,10 @@ void App::SetupImGui() {
     // This includes theme selection, scaling, and all visual properties
     // Do NOT set m_style properties here to avoid conflicts with StyleManager
 
+#if APP_FEATURE_IMPLOT
+    MemTagScope implotTag(MemTag::ImPlot);
     ImPlot::CreateContext();
+#endif
 }
 
 void App::SetupImGuiBackend() {
@@ -214,56 +411,12 @@ void App::SetupImGuiBackend() {
 }
 
 void App::MainLoop() {
-    
-m_consoleWindow->Tick();
-// Get font manager and initialize
-m_font_manager->GetIo(m_io);
-
-// Load Windows system fonts for variety
-m_console->Out << tc::cyan << "Loading Windows system fonts..." << tc::reset << std::endl;
-m_font_manager->LoadFonts();
-m_console->Out << tc::green << "✓ Loaded " << m_font_manager->GetFontCount() << " fonts" << tc::reset << std::endl;
-
-// Auto-load ImGui default fonts (built-in, no external files needed)
-int defaultFontsLoaded = m_font_manager->LoadImGuiDefaultFonts();
-m_console->Out << tc::cyan << "Loaded " << defaultFontsLoaded << " ImGui default font(s)" << tc::reset << std::endl;
-
-// Note: Windows fonts can be optionally loaded via:
-// int winFontsLoaded = m_font_manager->LoadWindowsFonts("C:\\Windows\\Fonts");
-// Or manually through the Font Manager Window UI
+    // Saved clear color (or the default), taken by Initialize()
+    m_console->Out << "Loaded clear color: R=" << m_clearColor.x << " G=" << m_clearColor.y
+                   << " B=" << m_clearColor.z << " A=" << m_clearColor.w << "\n";
 
-m_font_manager_window->GetAux(m_window->GetHWND(), m_font_manager);
-
-
-m_debug_window->GetIo(m_io);
-
-    // Initialize ConfigManager and load saved settings
-    m_configManager->Open();
-
-    // Initialize StyleManager and load saved m_style settings
-    // Must be called after ImGui::CreateContext() in SetupImGui()
-    StyleManager* styleManager = m_memory->Get_StyleManager();
-    styleManager->Open();
-
-    // Apply DPI scaling after m_style is loaded
-    // This ensures scaling is applied to the loaded or default m_style
-   
-    m_style = &ImGui::GetStyle();
-    m_style->ScaleAllSizes(m_window->get_main_scale());
-    
-    // Load the saved clear color (or use default)
-    ImVec4 clear_color = m_configManager->GetClearColorAsImVec4();
-
-    m_console->Out << "Loaded clear color: R=" << clear_color.x << " G=" << clear_color.y
-                   << " B=" << clear_color.z << " A=" << clear_color.w << "\n";
-
-    // Create window object for file system browser
-    m_window_obj = m_memory->Get_WindowClass();
-    m_window_obj->Open();
-
-    
-    // Track if color was modified this frame
-    bool colorModified = false;
+    // Deadline used by the 'frame_cap' cvar
+    auto nextFrameTime = std::chrono::steady_clock::now();
 
     // Main loop
     bool done = false;
@@ -277,22 +430,122 @@ m_debug_window->GetIo(m_io);
                 done = true;
             }
         }
-        if (done) break;
+        if (done || s_exitRequested.load(std::memory_order_relaxed)) break;
+
+        // Queued commands, events, job continuations and deferred output (see Initialize())
+        m_scheduler.Run(TickPhase::PreFrame);
 
         // Render frame
-        if (!RenderFrame(clear_color, colorModified)) {
+        if (!RenderFrame()) {
             break;
         }
+
+        m_scheduler.Run(TickPhase::PostPresent);
+
+        // Sleep off the rest of the frame budget when a frame cap is set
+        const int32_t frameCap = cvars::FrameCap.Get();
+        if (frameCap > 0) {
+            const auto now = std::chrono::steady_clock::now();
+            nextFrameTime += std::chrono::nanoseconds(1'000'000'000LL / frameCap);
+            if (nextFrameTime > now) {
+                std::this_thread::sleep_until(nextFrameTime);
+            } else {
+                nextFrameTime = now; // Running behind - don't try to catch up
+            }
+        }
     }
 
-    // Save configuration on exit
-    m_configManager->Close();
-    m_console->Out << tc::green << "Configuration saved on exit\n" << tc::reset;
+}
 
-    
+void App::Shutdown() {
+    using Clock = std::chrono::steady_clock;
+
+    const Clock::time_point start = Clock::now();
+    Clock::time_point phaseStart = start;
+    std::vector<std::pair<const char*, Clock::duration>> phases;
+    auto endPhase = [&](const char* name) {
+        const Clock::time_point now = Clock::now();
+        phases.emplace_back(name, now - phaseStart);
+        phaseStart = now;
+    };
+
+    // Cleanup() clears the member pointers
+    OutputConsole* console = m_console;
+    ConsoleWindow* consoleWindow = m_consoleWindow;
+
+    // 1. Stop producers: background ticks and jobs, remote clients, then the stdin reader (all bounded)
+    m_scheduler.StopBackground();
+    JobSystem::Get_JobSystem_Singleton()->Stop(); // Drops queued jobs; Close() below writes the config
+    EventBus::Get_EventBus_Singleton()->Unsubscribe(this);
+    m_cmdArgs->Close();
+    m_controlServer->Close();
+    m_inputHandler->Close();
+    endPhase("stop producers");
+
+    // 2. Save both config files on worker threads while the console drains here.
+    //    The main loop is gone, so nothing changes ImGui's style or the cvars
+    //    while they are read. The style is read from ImGui here, on the main
+    //    thread; the savers only serialize and write files, so releasing ImGui
+    //    below can never pull the context out from under them.
+    const Clock::time_point deadline = phaseStart + kShutdownFlushTimeout;
+    StyleManager* styleManager = m_styleManager;
+    ConfigManager* configManager = m_configManager;
+    styleManager->CaptureStyleFromImGui();
+    std::future<void> saves[] = {
+        RunDetached([configManager]() { configManager->Close(); }),
+        RunDetached([styleManager]() { styleManager->Close(); }),
+    };
+
+    auto remaining = [&deadline]() {
+        return std::max(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()),
+                        std::chrono::milliseconds(0));
+    };
+    console->Out.Drain(remaining());
+
+    bool saved = true;
+    for (std::future<void>& save : saves) {
+        if (save.wait_until(deadline) != std::future_status::ready) saved = false;
+    }
+    if (saved) {
+        console->Out << tc::green << "Configuration saved on exit" << tc::reset << std::endl;
+    } else {
+        console->Out << tc::yellow << "Configuration save is taking long; finishing it after the GPU is released"
+                     << tc::reset << std::endl;
+    }
+
+    // Lines the savers logged are still deferred for the ImGui console (and its log file)
+    console->Out.Drain(remaining());
+    consoleWindow->FlushLogFile();
+    endPhase("flush writers");
+
+    // 3. Release the GPU, ImGui and the window exactly once
+    Cleanup();
+    endPhase("release GPU");
+
+    // 4. Main() ends the process with quick_exit(), which would cut a writer off.
+    //    The files are written to a temp file and renamed, so the old ones would
+    //    survive, but the settings of this session would be lost; wait for them.
+    if (!saved) {
+        for (std::future<void>& save : saves) save.wait();
+        console->Out << tc::green << "Configuration saved on exit" << tc::reset << std::endl;
+        console->Out.Drain(AsyncConsoleWriter::kStopTimeout);
+        consoleWindow->FlushLogFile();
+        endPhase("finish saves");
+    }
+
+#ifdef _DEBUG
+    const auto toMs = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+    console->Out << tc::cyan << "Shutdown took " << toMs(Clock::now() - start) << " ms" << std::endl;
+    for (const auto& [name, time] : phases) {
+        console->Out << "  " << name << ": " << toMs(time) << " ms" << std::endl;
+    }
+    console->Out << tc::reset;
+    console->Out.Drain(AsyncConsoleWriter::kStopTimeout);
+    consoleWindow->FlushLogFile();
+#endif
 }
 
-bool App::RenderFrame(ImVec4& clear_color, bool& colorModified) {
+bool App::RenderFrame() {
 // Handle window occlusion and minimization
 if ((m_renderer->GetSwapChainOccluded() &&
      m_renderer->GetSwapChain()->Present(0, DXGI_PRESENT_TEST) == DXGI_STATUS_OCCLUDED) ||
@@ -302,13 +555,15 @@ if ((m_renderer->GetSwapChainOccluded() &&
 }
 m_renderer->SetSwapChainOccluded(false);
 
-// Start ImGui frame
+// Start ImGui frame; strings built for the previous frame are still valid
+m_frameArena->BeginFrame();
+MemTagScope frameTag(MemTag::ImGui); // Whatever the UI code below does not tag itself
 ImGui_ImplDX12_NewFrame();
 ImGui_ImplWin32_NewFrame();
 ImGui::NewFrame();
 
 // Render UI
-RenderUI(clear_color, colorModified);
+RenderUI();
 
 // Rendering
 ImGui::Render();
@@ -347,10 +602,10 @@ barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
 
     // Convert ImVec4 to float array with alpha premultiplied
     const float clear_color_with_alpha[4] = {
-        clear_color.x * clear_color.w,
-        clear_color.y * clear_color.w,
-        clear_color.z * clear_color.w,
-        clear_color.w
+        m_clearColor.x * m_clearColor.w,
+        m_clearColor.y * m_clearColor.w,
+        m_clearColor.z * m_clearColor.w,
+        m_clearColor.w
     };
 
     // Clear render target with the configured color
@@ -380,26 +635,24 @@ barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
     m_renderer->GetCommandQueue()->Signal(m_renderer->GetFence(), ++m_renderer->GetFenceLastSignaledValue());
     frameCtx->FenceValue = m_renderer->GetFenceLastSignaledValue();
 
-    // Present
-    HRESULT hr = m_renderer->GetSwapChain()->Present(1, 0);
+    // Present - the 'present_mode' option index is the sync interval (0, 1 or 2)
+    const UINT syncInterval = static_cast<UINT>(cvars::PresentMode.Get());
+    HRESULT hr = m_renderer->GetSwapChain()->Present(syncInterval, 0);
     m_renderer->SetSwapChainOccluded(hr == DXGI_STATUS_OCCLUDED);
     m_renderer->GetFrameIndex()++;
 
     return true;
 }
 
-void App::RenderUI(ImVec4& clear_color, bool& colorModified) {
-// Reset color modification flag for this frame
-colorModified = false;
+void App::RenderUI() {
+// Set when the color picker changed the clear color this frame
+bool colorModified = false;
 
-// Render optional windows
-if (m_memory->m_bShow_FileSys_window) m_window_obj->Tick();
-if (m_memory->m_bShow_Debug_window) m_debug_window->Tick();
-if (m_memory->m_bShow_FontManager_window) m_font_manager_window->Tick();
+// Console bookkeeping and the optional windows
+m_scheduler.Run(TickPhase::UI);
     
 // Show console window
 if (m_memory->m_bShow_Console_window) {
-    m_consoleWindow = m_memory->Get_ConsoleWindow();
     m_consoleWindow->ShowExampleAppConsole(&m_memory->m_bShow_Console_window);
 }
     
@@ -410,8 +663,6 @@ if (m_memory->m_bShow_Console_window) {
         
         // Add custom save/load buttons at the top - Load button first
         // Use StyleManager helper functions for theme-aware colors
-        StyleManager* styleManager = m_memory->Get_StyleManager();
-        
         // Load button with info styling (blue-tinted)
         ImVec4 loadButtonColor = StyleManager::GetInfoButtonColor();
         ImVec4 loadButtonHovered = StyleManager::GetHoveredColor(loadButtonColor);
@@ -421,8 +672,8 @@ if (m_memory->m_bShow_Console_window) {
         ImGui::PushStyleColor(ImGuiCol_ButtonHovered, loadButtonHovered);
         ImGui::PushStyleColor(ImGuiCol_ButtonActive, loadButtonActive);
         if (ImGui::Button("Load Style Configuration", ImVec2(200, 30))) {
-            if (styleManager->LoadConfiguration()) {
-                styleManager->ApplyStyleToImGui();
+            if (m_styleManager->LoadConfiguration()) {
+                m_styleManager->ApplyStyleToImGui();
                 m_console->Out << tc::green << "Style configuration loaded successfully!\n" << tc::reset;
             } else {
                 m_console->Out << tc::red << "Failed to load m_style configuration!\n" << tc::reset;
@@ -441,7 +692,7 @@ if (m_memory->m_bShow_Console_window) {
         ImGui::PushStyleColor(ImGuiCol_ButtonHovered, saveButtonHovered);
         ImGui::PushStyleColor(ImGuiCol_ButtonActive, saveButtonActive);
         if(ImGui::Button("Save Style Configuration", ImVec2(200, 30))) {
-            if(styleManager->SaveConfiguration()) {
+            if(m_styleManager->SaveConfiguration()) {
                 m_console->Out << tc::green << "Style configuration saved successfully!\n" << tc::reset;
             } else {
                 m_console->Out << tc::red << "Failed to save m_style configuration!\n" << tc::reset;
@@ -454,7 +705,7 @@ if (m_memory->m_bShow_Console_window) {
         if (ImGui::IsItemHovered()) {
             ImGui::BeginTooltip();
             ImGui::Text("Style config file location:");
-            ImGui::Text("%ls", styleManager->GetConfigFilePath().c_str());
+            ImGui::Text("%ls", m_styleManager->GetConfigFilePath().c_str());
             ImGui::EndTooltip();
         }
         
@@ -465,22 +716,19 @@ if (m_memory->m_bShow_Console_window) {
         ImGui::SameLine();
         
         if (ImGui::Button("Dark")) {
-            StyleManager* styleManager = m_memory->Get_StyleManager();
-            styleManager->ApplyPresetDark();
+            m_styleManager->ApplyPresetDark();
             m_console->Out << "Applied Dark theme preset\n";
         }
         ImGui::SameLine();
         
         if (ImGui::Button("Light")) {
-            StyleManager* styleManager = m_memory->Get_StyleManager();
-            styleManager->ApplyPresetLight();
+            m_styleManager->ApplyPresetLight();
             m_console->Out << "Applied Light theme preset\n";
         }
         ImGui::SameLine();
         
         if (ImGui::Button("Classic")) {
-            StyleManager* styleManager = m_memory->Get_StyleManager();
-            styleManager->ApplyPresetClassic();
+            m_styleManager->ApplyPresetClassic();
             m_console->Out << "Applied Classic theme preset\n";
         }
         
@@ -489,8 +737,7 @@ if (m_memory->m_bShow_Console_window) {
         
         // Save current m_style button
         if (ImGui::Button("Save Current Style to JSON", ImVec2(250, 0))) {
-            StyleManager* styleManager = m_memory->Get_StyleManager();
-            if (styleManager->SaveConfiguration()) {
+            if (m_styleManager->SaveConfiguration()) {
                 m_console->Out << tc::green << "Style saved to JSON successfully!\n" << tc::reset;
             } else {
                 m_console->Out << tc::red << "Failed to save m_style to JSON!\n" << tc::reset;
@@ -503,8 +750,8 @@ if (m_memory->m_bShow_Console_window) {
         ImGui::Separator();
         ImGui::Spacing();
         
-        // Show the built-in ImGui m_style editor
-        ImGui::ShowStyleEditor(nullptr);
+        // Show the built-in ImGui m_style editor (it lives in imgui_demo.cpp)
+        if constexpr (Features::DemoWindows) ImGui::ShowStyleEditor(nullptr);
         
         ImGui::End();
     }
@@ -512,22 +759,16 @@ if (m_memory->m_bShow_Console_window) {
     // Show demo window
     // Note: The demo window has "Tools > Style Editor" menu that will open the m_style editor
     // To make it work with our flag, we need to detect when it's opened
-    if (m_memory->m_bShow_demo_window) {
+    if (Features::DemoWindows && m_memory->m_bShow_demo_window) {
         ImGui::ShowDemoWindow(&m_memory->m_bShow_demo_window);
         
         // Detect if demo window opened the m_style editor via its menu
-        // When user clicks "Tools > Style Editor" in demo, it creates a window named "Dear ImGui Style Editor"
+        // When user clicks "Tools > Style Editor" in demo, it creates a window named "Dear ImGui Style Editor".
+        // Only the demo window can open it, so there is nothing to look up while it is hidden
         if (!m_memory->m_bShow_styleEditor_window && ImGui::FindWindowByName("Dear ImGui Style Editor")) {
             m_memory->m_bShow_styleEditor_window = true;
         }
     }
-    
-    // If demo window opened the native m_style editor, we need to manage it separately
-    // Close the native one and use our wrapped version instead
-    if (ImGui::FindWindowByName("Dear ImGui Style Editor") && !m_memory->m_bShow_styleEditor_window) {
-        // Demo window opened it, so set our flag to true
-        m_memory->m_bShow_styleEditor_window = true;
-    }
 
     // Main window with color picker and save functionality
     {
@@ -541,21 +782,21 @@ if (m_memory->m_bShow_Console_window) {
         ImGui::Text("Background Color Settings");
         ImGui::Separator();
 
-        // Color picker
-        if (ImGui::ColorEdit3("Background Color", std::bit_cast<float*>(std::ref(clear_color)))) {
+        // Color picker; edits a copy, ConfigManager publishes the change back to m_clearColor
+        ImVec4 clear_color = m_clearColor;
+        if (ImGui::ColorEdit3("Background Color", &clear_color.x)) {
             colorModified = true;
+            m_configManager->SetClearColor(clear_color.x, clear_color.y, clear_color.z, clear_color.w);
         }
 
         // Show current color values
         ImGui::Text("Current color: R=%.2f G=%.2f B=%.2f A=%.2f", 
-                    clear_color.x, clear_color.y, clear_color.z, clear_color.w);
+                    m_clearColor.x, m_clearColor.y, m_clearColor.z, m_clearColor.w);
 
         ImGui::Separator();
 
         // Manual save button
         if (ImGui::Button("Save Color to Config")) {
-            m_configManager->SetClearColor(clear_color.x, clear_color.y, clear_color.z, clear_color.w);
-
             if (m_configManager->SaveConfiguration()) {
                 m_console->Out << tc::green << "Background color saved successfully!\n" << tc::reset;
             } else {
@@ -575,12 +816,11 @@ if (m_memory->m_bShow_Console_window) {
 
         ImGui::Separator();
 
-        // Auto-save when color changes
+        // Auto-save when color changes; the write runs as a job so dragging stays smooth
         if (colorModified) {
-            m_configManager->SetClearColor(clear_color.x, clear_color.y, clear_color.z, clear_color.w);
-            m_configManager->SaveConfiguration();
-            m_console->Out << "Color auto-saved: R=" << clear_color.x 
-                          << " G=" << clear_color.y << " B=" << clear_color.z << "\n";
+            m_configManager->SaveConfigurationAsync();
+            m_console->Out << "Color auto-saved: R=" << m_clearColor.x 
+                          << " G=" << m_clearColor.y << " B=" << m_clearColor.z << "\n";
         }
 
         ImGui::Separator();
@@ -588,15 +828,19 @@ if (m_memory->m_bShow_Console_window) {
         // Other settings
         ImGui::Text("Other Settings");
 
-        ImGui::Checkbox("Demo Window", &m_memory->m_bShow_demo_window);
-        ImGui::Checkbox("Another Window", &m_memory->m_bShow_another_window);
+        if constexpr (Features::DemoWindows) {
+            ImGui::Checkbox("Demo Window", &m_memory->m_bShow_demo_window);
+            ImGui::Checkbox("Another Window", &m_memory->m_bShow_another_window);
+        }
         ImGui::Checkbox("Style Editor", &m_memory->m_bShow_styleEditor_window);
 
         ImGui::Separator();
 
         ImGui::Checkbox("Debug Window", &m_memory->m_bShow_Debug_window);
-        ImGui::Checkbox("Font Manager Window", &m_memory->m_bShow_FontManager_window);
-        ImGui::Checkbox("File System Window", &m_memory->m_bShow_FileSys_window);
+        if constexpr (Features::FontManagerUI)
+            ImGui::Checkbox("Font Manager Window", &m_memory->m_bShow_FontManager_window);
+        if constexpr (Features::FileBrowser)
+            ImGui::Checkbox("File System Window", &m_memory->m_bShow_FileSys_window);
         ImGui::Checkbox("Console Window", &m_memory->m_bShow_Console_window);
 
         ImGui::Separator();
@@ -615,7 +859,7 @@ if (m_memory->m_bShow_Console_window) {
     }
 
     // Another window example
-    if (m_memory->m_bShow_another_window) {
+    if (Features::DemoWindows && m_memory->m_bShow_another_window) {
         ImGui::Begin("Another Window", &m_memory->m_bShow_another_window);
         ImGui::Text("Hello from another window!");
         if (ImGui::Button("Close Me")) {
@@ -625,6 +869,19 @@ if (m_memory->m_bShow_Console_window) {
     }
 }
 
+void App::OnConfigChanged(const ConfigChanged& event) {
+    // nullptr: a reload or the clear color; otherwise only the one cvar changed
+    if (!event.cvar) m_clearColor = m_configManager->GetClearColorAsImVec4();
+
+    // Apply the 'font_size' cvar (dynamic fonts rebuild glyphs on demand)
+    if (!event.cvar || event.cvar == &cvars::FontSize) ImGui::GetStyle().FontSizeBase = cvars::FontSize.Get();
+}
+
+void App::OnStyleChanged(const StyleChanged& event) {
+    // A style read from the file comes with unscaled sizes; scale them as at startup
+    if (event.sizesReset) ImGui::GetStyle().ScaleAllSizes(m_window->get_main_scale());
+}
+
 void App::Cleanup() {
 // Wait for GPU to finish
 if (m_renderer) {
@@ -643,10 +900,12 @@ if (ImGui::GetCurrentContext() != nullptr) {
     ImGui::DestroyContext();
 }
     
+#if APP_FEATURE_IMPLOT
 // Shutdown ImPlot (only if initialized)
 if (ImPlot::GetCurrentContext() != nullptr) {
     ImPlot::DestroyContext();
 }
+#endif
 
     // Cleanup renderer (managed by MemoryManagement's smart pointer - don't delete)
     if (m_renderer) {
@@ -666,10 +925,7 @@ if (ImPlot::GetCurrentContext() != nullptr) {
     m_cmdArgs = nullptr;
     m_window = nullptr;
     m_font_manager = nullptr;
-    m_font_manager_window = nullptr;
-    m_debug_window = nullptr;
     m_configManager = nullptr;
-    m_window_obj = nullptr;
 }
 
 
@@ -721,6 +977,11 @@ LRESULT WINAPI App::WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) {
         }
         break;
         
+    case WM_CLOSE:
+        // Keep the window until Shutdown() has released the swap chain
+        RequestExit();
+        return 0;
+
     case WM_DESTROY:
         ::PostQuitMessage(0);
         return 0;
@@ -0,0 +1,295 @@
+// AsyncConsoleWriter.cpp
+// Implementation of the background native console writer
+
+#include "PCH.hpp"
+#include "AsyncConsoleWriter.hpp"
+#include "Utf.hpp"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+namespace app {
+
+AsyncConsoleWriter::AsyncConsoleWriter(WriteFn write) :
+m_state(std::make_shared<State>()),
+m_thread() {
+	State& state		 = *m_state;
+	state.lastLineStart	 = std::string::npos;
+	state.writing		 = false;
+	state.shouldStop	 = false;
+	state.capacity		 = 1024 * 1024;
+	state.overflow		 = Overflow::Merge;
+	state.droppedLines	 = 0;
+	state.pendingDropped = 0;
+	state.pendingRepeats = 0;
+	state.writeCalls	 = 0;
+	state.bytesWritten	 = 0;
+	state.write			 = write ? std::move(write) : WriteFn(&AsyncConsoleWriter::WriteStdout);
+	state.pending.reserve(64 * 1024);
+
+	m_thread = std::thread(&AsyncConsoleWriter::ThreadFunction, m_state);
+}
+
+AsyncConsoleWriter::~AsyncConsoleWriter() {
+	State& state = *m_state;
+	bool   drained;
+	{
+		std::unique_lock<std::mutex> lock(state.mutex);
+		state.shouldStop = true;
+		state.wake.notify_one();
+		state.space.notify_all();
+		drained = state.idle.wait_for(lock, kStopTimeout, [&state]() {
+			return state.pending.empty() && !state.writing;
+		});
+	}
+
+	if (!m_thread.joinable()) return;
+	if (drained) {
+		m_thread.join();
+	} else {
+		// Stuck in a write to a stalled device; it keeps its own reference to the state
+		m_thread.detach();
+	}
+}
+
+/**
+ * @brief Queues one line; applies the overflow policy when the batch is full
+ *
+ * The writer is only notified when the batch goes from empty to non-empty:
+ * while it is busy, further lines just accumulate into the next write.
+ */
+void AsyncConsoleWriter::Write(std::string_view line) {
+	State&						 state = *m_state;
+	std::unique_lock<std::mutex> lock(state.mutex);
+
+	const size_t needed = line.size() + 1;
+	if (!state.pending.empty() && state.pending.size() + needed > state.capacity) {
+		switch (state.overflow) {
+		case Overflow::Block:
+			state.space.wait(lock, [&state, needed]() {
+				return state.shouldStop || state.pending.empty() ||
+					   state.pending.size() + needed <= state.capacity;
+			});
+			break;
+
+		case Overflow::Merge:
+			if (state.lastLineStart != std::string::npos) {
+				const std::string_view last = std::string_view(state.pending).substr(
+					state.lastLineStart, state.pending.size() - 1 - state.lastLineStart);
+				if (last == line) {
+					state.pendingRepeats++;
+					return;
+				}
+			}
+			[[fallthrough]];
+
+		case Overflow::Drop:
+			state.droppedLines++;
+			state.pendingDropped++;
+			return;
+		}
+	}
+
+	const bool wasEmpty = state.pending.empty();
+	AppendNoticesLocked(state);
+	state.lastLineStart = state.pending.size();
+	state.pending.append(line);
+	state.pending.push_back('\n');
+	if (wasEmpty) state.wake.notify_one();
+}
+
+bool AsyncConsoleWriter::WaitIdle(std::chrono::milliseconds timeout) {
+	State&						 state = *m_state;
+	std::unique_lock<std::mutex> lock(state.mutex);
+	state.wake.notify_one();
+	return state.idle.wait_for(lock, timeout, [&state]() {
+		return state.pending.empty() && !state.writing;
+	});
+}
+
+void AsyncConsoleWriter::SetCapacity(size_t bytes) {
+	std::lock_guard<std::mutex> lock(m_state->mutex);
+	m_state->capacity = std::max<size_t>(bytes, 1024);
+	m_state->space.notify_all();
+}
+
+void AsyncConsoleWriter::SetOverflow(Overflow overflow) {
+	std::lock_guard<std::mutex> lock(m_state->mutex);
+	m_state->overflow = overflow;
+	m_state->space.notify_all();
+}
+
+uint64_t AsyncConsoleWriter::GetDroppedLines() const {
+	std::lock_guard<std::mutex> lock(m_state->mutex);
+	return m_state->droppedLines;
+}
+
+uint64_t AsyncConsoleWriter::GetWriteCalls() const {
+	std::lock_guard<std::mutex> lock(m_state->mutex);
+	return m_state->writeCalls;
+}
+
+uint64_t AsyncConsoleWriter::GetBytesWritten() const {
+	std::lock_guard<std::mutex> lock(m_state->mutex);
+	return m_state->bytesWritten;
+}
+
+void AsyncConsoleWriter::AppendNoticesLocked(State& state) {
+	if (state.pendingRepeats) {
+		state.pending += "(previous line repeated " + std::to_string(state.pendingRepeats) +
+						 " more times)\n";
+		state.pendingRepeats = 0;
+		state.lastLineStart	 = std::string::npos;
+	}
+	if (state.pendingDropped) {
+		state.pending += "[warning] " + std::to_string(state.pendingDropped) +
+						 " lines dropped: the console could not keep up (see console_overflow)\n";
+		state.pendingDropped = 0;
+		state.lastLineStart	 = std::string::npos;
+	}
+}
+
+/**
+ * @brief Writer thread: swaps the pending batch out and writes it in one call
+ *
+ * Exits once asked to stop and nothing is left to write.
+ */
+void AsyncConsoleWriter::ThreadFunction(std::shared_ptr<State> statePtr) {
+	State&						 state = *statePtr;
+	std::string					 batch;
+	std::unique_lock<std::mutex> lock(state.mutex);
+
+	for (;;) {
+		state.wake.wait(lock, [&state]() {
+			return state.shouldStop || !state.pending.empty() || state.pendingDropped ||
+				   state.pendingRepeats;
+		});
+
+		AppendNoticesLocked(state);
+		if (state.pending.empty()) {
+			if (state.shouldStop) break;
+			continue;
+		}
+
+		// The old batch's capacity is handed back to the callers
+		batch.swap(state.pending);
+		state.lastLineStart = std::string::npos;
+		state.writing		= true;
+		lock.unlock();
+		state.space.notify_all();
+
+		state.write(batch);
+
+		lock.lock();
+		state.writing = false;
+		state.writeCalls++;
+		state.bytesWritten += batch.size();
+		batch.clear();
+		if (state.pending.empty()) state.idle.notify_all();
+	}
+
+	state.idle.notify_all();
+}
+
+void AsyncConsoleWriter::WriteStdout(std::string_view bytes) {
+#ifdef _WIN32
+	// Looked up per batch: OutputConsole redirects stdout after we are created
+	HANDLE out = GetStdHandle(STD_OUTPUT_HANDLE);
+	if (out == nullptr || out == INVALID_HANDLE_VALUE) return;
+
+	DWORD mode = 0;
+	if (GetConsoleMode(out, &mode)) {
+		// Console: UTF-16, so the result does not depend on the console code page
+		static thread_local std::wstring wide;
+		wide.resize(utf::WideLengthFromUtf8<wchar_t>(bytes.data(), bytes.size()));
+		utf::Utf8ToWide(bytes.data(), bytes.size(), wide.data(), wide.size());
+
+		// Older console hosts reject very large buffers
+		constexpr size_t kChunk = 16 * 1024;
+		for (size_t offset = 0; offset < wide.size();) {
+			size_t chunk = std::min(kChunk, wide.size() - offset);
+			if (offset + chunk < wide.size() && IS_HIGH_SURROGATE(wide[offset + chunk - 1])) chunk--;
+
+			DWORD written = 0;
+			if (!WriteConsoleW(out, wide.data() + offset, static_cast<DWORD>(chunk), &written,
+							   nullptr) ||
+				written == 0)
+				return;
+			offset += written;
+		}
+		return;
+	}
+
+	// File or pipe: raw UTF-8
+	for (size_t offset = 0; offset < bytes.size();) {
+		DWORD written = 0;
+		if (!WriteFile(out, bytes.data() + offset,
+					   static_cast<DWORD>(std::min<size_t>(bytes.size() - offset, 1u << 30)), &written,
+					   nullptr) ||
+			written == 0)
+			return;
+		offset += written;
+	}
+#else
+	for (size_t offset = 0; offset < bytes.size();) {
+		const ssize_t written = ::write(STDOUT_FILENO, bytes.data() + offset, bytes.size() - offset);
+		if (written < 0) {
+			if (errno == EINTR) continue;
+			return;
+		}
+		offset += static_cast<size_t>(written);
+	}
+#endif
+}
+
+BenchResult AsyncConsoleWriter::MeasureThrottled(uint32_t iterations, bool async) {
+	using clock = std::chrono::steady_clock;
+
+	iterations			  = std::max(iterations, 1u);
+	const uint32_t warmup = std::clamp(iterations / 10, 1u, 1000u);
+
+	// Busy-wait: sleep_for is far too coarse for microsecond costs
+	std::atomic<uint64_t> received{0};
+	const WriteFn		  device = [&received](std::string_view bytes) {
+		const auto until = clock::now() + std::chrono::microseconds(kThrottleCallUs) +
+						   std::chrono::nanoseconds(uint64_t(kThrottleByteNs) * bytes.size());
+		while (clock::now() < until) std::this_thread::yield();
+		received.fetch_add(bytes.size(), std::memory_order_relaxed);
+	};
+
+	AsyncConsoleWriter writer(device);
+	writer.SetCapacity(size_t(64) << 20);
+	writer.SetOverflow(Overflow::Block); // Nothing may be lost while measuring
+
+	std::vector<double> samples;
+	samples.reserve(iterations);
+	uint64_t sent = 0;
+
+	for (uint32_t i = 0; i < warmup + iterations; i++) {
+		char	  line[96];
+		const int length = std::snprintf(line, sizeof(line), "[info] frame %u took 16.667 ms\n", i);
+		const std::string_view text(line, static_cast<size_t>(length));
+
+		const auto start = clock::now();
+		if (async) {
+			writer.Write(text.substr(0, text.size() - 1));
+		} else {
+			device(text); // What a synchronous std::cout << ... << std::endl costs
+		}
+		const auto end = clock::now();
+
+		sent += text.size();
+		if (i >= warmup) samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+	}
+
+	if (async && !writer.WaitIdle(std::chrono::seconds(30)))
+		throw std::runtime_error("console writer did not drain");
+	if (received.load(std::memory_order_relaxed) != sent)
+		throw std::runtime_error("console writer lost output");
+
+	return Benchmark::FromSamples(async ? "console_async" : "console_sync", samples, warmup, 0, 0);
+}
+
+} // namespace app
@@ -0,0 +1,208 @@
+// Benchmark.cpp
+// Implementation of the in-process micro-benchmark runner
+
+#include "PCH.hpp"
+#include "Benchmark.hpp"
+
+// ============================================================================
+// ALLOCATION COUNTING
+// ============================================================================
+
+// Per-thread counters so a benchmark only sees its own allocations
+static thread_local uint64_t t_allocCount = 0;
+static thread_local uint64_t t_allocBytes = 0;
+
+// Replacing the global scalar forms is enough: the default array and nothrow
+// forms forward to these.
+void* operator new(std::size_t size) {
+	++t_allocCount;
+	t_allocBytes += size;
+	if (void* p = std::malloc(size ? size : 1)) return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace app {
+
+namespace {
+
+// ImGui allocator wrapper installed while a benchmark runs
+struct ImGuiAllocHook {
+	ImGuiMemAllocFunc prevAlloc;
+	ImGuiMemFreeFunc  prevFree;
+	void*			  prevUserData;
+};
+
+void* CountingImGuiAlloc(size_t size, void* user_data) {
+	auto* hook = static_cast<ImGuiAllocHook*>(user_data);
+	++t_allocCount;
+	t_allocBytes += size;
+	return hook->prevAlloc(size, hook->prevUserData);
+}
+
+void CountingImGuiFree(void* ptr, void* user_data) {
+	auto* hook = static_cast<ImGuiAllocHook*>(user_data);
+	hook->prevFree(ptr, hook->prevUserData);
+}
+
+} // namespace
+
+Benchmark::Benchmark() : m_targets(), m_results() {}
+
+Benchmark::~Benchmark() {}
+
+uint64_t Benchmark::GetThreadAllocCount() { return t_allocCount; }
+
+uint64_t Benchmark::GetThreadAllocBytes() { return t_allocBytes; }
+
+void Benchmark::AddTarget(const std::string& name, const std::string& description,
+						  uint32_t defaultIterations, Body body) {
+	m_targets[name] = Target{description, defaultIterations, std::move(body), Runner(), 0};
+}
+
+void Benchmark::AddCustomTarget(const std::string& name, const std::string& description,
+								uint32_t defaultIterations, Runner runner) {
+	m_targets[name] = Target{description, defaultIterations, Body(), std::move(runner), 0};
+}
+
+void Benchmark::SetThroughput(const std::string& name, uint64_t bytesPerIteration) {
+	auto it = m_targets.find(name);
+	if (it == m_targets.end()) throw std::runtime_error("Unknown benchmark target: " + name);
+	it->second.throughputBytes = bytesPerIteration;
+}
+
+const Benchmark::Target* Benchmark::FindTarget(const std::string& name) const {
+	auto it = m_targets.find(name);
+	return it != m_targets.end() ? &it->second : nullptr;
+}
+
+BenchResult Benchmark::Run(const std::string& name, uint32_t iterations) {
+	const Target* target = FindTarget(name);
+	if (!target) throw std::runtime_error("Unknown benchmark target: " + name);
+
+	if (!iterations) iterations = target->defaultIterations;
+	BenchResult result =
+		target->runner ? target->runner(iterations) : Measure(name, iterations, target->body);
+	result.target = name;
+	if (target->throughputBytes && result.median_us > 0.0) // bytes per ns == GB/s
+		result.throughput_gbps = static_cast<double>(target->throughputBytes) / (result.median_us * 1000.0);
+	m_results.push_back(result);
+	return result;
+}
+
+BenchResult Benchmark::RunOnce(const std::string& name, uint32_t iterations, const Body& body) {
+	BenchResult result = Measure(name, iterations, body);
+	m_results.push_back(result);
+	return result;
+}
+
+/**
+ * @brief Runs warmup + timed iterations and computes the statistics
+ *
+ * Warmup is 10% of the iterations (at least 1, at most 1000).
+ */
+BenchResult Benchmark::Measure(const std::string& name, uint32_t iterations, const Body& body) {
+	using clock = std::chrono::steady_clock;
+
+	iterations			  = std::max(iterations, 1u);
+	const uint32_t warmup = std::clamp(iterations / 10, 1u, 1000u);
+
+	for (uint32_t i = 0; i < warmup; i++) body(i);
+
+	// Count ImGui::MemAlloc calls too - most console strings go through it
+	ImGuiAllocHook hook{};
+	ImGui::GetAllocatorFunctions(&hook.prevAlloc, &hook.prevFree, &hook.prevUserData);
+	ImGui::SetAllocatorFunctions(CountingImGuiAlloc, CountingImGuiFree, &hook);
+
+	std::vector<double> samples;
+	samples.reserve(iterations);
+
+	const uint64_t allocsBefore = t_allocCount;
+	const uint64_t bytesBefore	= t_allocBytes;
+
+	try {
+		for (uint32_t i = 0; i < iterations; i++) {
+			const auto start = clock::now();
+			body(i);
+			const auto end = clock::now();
+			samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+		}
+	} catch (...) {
+		// The hook lives on this stack frame - never leave it installed
+		ImGui::SetAllocatorFunctions(hook.prevAlloc, hook.prevFree, hook.prevUserData);
+		throw;
+	}
+
+	const uint64_t allocs = t_allocCount - allocsBefore;
+	const uint64_t bytes  = t_allocBytes - bytesBefore;
+
+	ImGui::SetAllocatorFunctions(hook.prevAlloc, hook.prevFree, hook.prevUserData);
+
+	return FromSamples(name, samples, warmup, allocs, bytes);
+}
+
+/**
+ * @brief Reduces raw samples to the reported statistics
+ *
+ * Samples above Q3 + 3 * IQR are treated as outliers (preemption, page
+ * faults) and dropped; only the upper fence is used because latency
+ * distributions are bounded below.
+ */
+BenchResult Benchmark::FromSamples(const std::string& name, std::vector<double>& samples,
+								   uint32_t warmup, uint64_t allocs, uint64_t bytes) {
+	BenchResult result{};
+	result.target = name;
+	result.warmup = warmup;
+	if (samples.empty()) return result;
+
+	std::sort(samples.begin(), samples.end());
+
+	// Upper Tukey fence
+	const size_t n		= samples.size();
+	const double q1		= samples[n / 4];
+	const double q3		= samples[(n * 3) / 4];
+	const double fence	= q3 + 3.0 * (q3 - q1);
+	const auto	 keepIt = std::upper_bound(samples.begin(), samples.end(), fence);
+	const size_t kept	= std::max<size_t>(1, keepIt - samples.begin());
+
+	result.iterations = static_cast<uint32_t>(kept);
+	result.outliers	  = static_cast<uint32_t>(n - kept);
+	result.min_us	  = samples.front();
+	result.median_us  = samples[kept / 2];
+	result.p99_us	  = samples[std::min(kept - 1, (kept * 99 + 99) / 100 - 1)];
+	result.max_us	  = samples[kept - 1];
+	double sum		  = 0.0;
+	for (size_t i = 0; i < kept; i++) sum += samples[i];
+	result.mean_us		   = sum / static_cast<double>(kept);
+	result.allocs_per_iter = static_cast<double>(allocs) / n;
+	result.bytes_per_iter  = static_cast<double>(bytes) / n;
+	return result;
+}
+
+bool Benchmark::ExportJson(const std::wstring& path) const {
+	BenchReport report{};
+
+	char  machine[MAX_COMPUTERNAME_LENGTH + 1] = {};
+	DWORD machineLen						   = IM_ARRAYSIZE(machine);
+	if (GetComputerNameA(machine, &machineLen)) report.machine = machine;
+	report.hardware_threads = std::thread::hardware_concurrency();
+
+	auto	  now  = std::chrono::system_clock::now();
+	auto	  time = std::chrono::system_clock::to_time_t(now);
+	struct tm timeinfo;
+	localtime_s(&timeinfo, &time);
+	char stamp[32];
+	std::strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%S", &timeinfo);
+	report.timestamp = stamp;
+	report.results	 = m_results;
+
+	std::ofstream file(fs::path(path), std::ios::out | std::ios::trunc | std::ios::binary);
+	if (!file.is_open()) return false;
+	file << rfl::json::write(report);
+	return file.good();
+}
+
+} // namespace app
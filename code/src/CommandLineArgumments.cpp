@@ -3,16 +3,69 @@
 
 namespace app {
 
+namespace {
+
+// Held from the first -single launch until the process exits (the OS releases it)
+constexpr wchar_t kInstanceMutexName[] = L"Local\\ImGuiCouse.SingleInstance";
+HANDLE			  g_instanceMutex	   = nullptr;
+
+// How long a later launch waits for a starting owner to open its endpoint
+constexpr auto kForwardTimeout = std::chrono::seconds(5);
+
+bool IsExecArgument(const wchar_t* arg) {
+	return utf::EqualsNoCase(arg, L"-exec") || utf::EqualsNoCase(arg, L"--exec");
+}
+
+bool IsSingleArgument(const wchar_t* arg) {
+	return utf::EqualsNoCase(arg, L"-single") || utf::EqualsNoCase(arg, L"-single-instance");
+}
+
+// Quotes arg so CommandLineToArgvW gives it back unchanged
+void AppendQuoted(std::wstring& out, const wchar_t* arg) {
+	if (!out.empty()) out.push_back(L' ');
+	if (*arg && !wcspbrk(arg, L" \t\"")) {
+		out += arg;
+		return;
+	}
+
+	out.push_back(L'"');
+	size_t backslashes = 0;
+	for (const wchar_t* c = arg; *c; c++) {
+		if (*c == L'\\') {
+			backslashes++;
+			continue;
+		}
+		// Backslashes are only special right before a quote
+		out.append(*c == L'"' ? backslashes * 2 + 1 : backslashes, L'\\');
+		backslashes = 0;
+		out.push_back(*c);
+	}
+	out.append(backslashes * 2, L'\\');
+	out.push_back(L'"');
+}
+
+} // namespace
+
 CommandLineArguments::CommandLineArguments()
-: Args{}, szArgList(nullptr), argCount(0), bConsoleLaunched(false), m_memory(nullptr){
+: Args{}, szArgList(nullptr), argCount(0), bConsoleLaunched(false), m_memory(nullptr),
+  m_instanceServer(nullptr), m_pendingExec(){
 
-    m_memory = MemoryManagement::Get_MemoryManagement_Singleton(); //m_cmd = m_memory->Get_OutputConsole();
+    m_memory = MemoryManagement::Get_MemoryManagement_Singleton(); //m_cmd = m_memory->Get<OutputConsole>();
 }
 
 CommandLineArguments::~CommandLineArguments() { LocalFree(szArgList); }
 
 void CommandLineArguments::Open() {
 	GetInitArgs();
+	m_pendingExec = CollectExecCommands();
+
+	// ForwardToRunningInstance() made us the owner: accept later launches
+	if (g_instanceMutex && !m_instanceServer) {
+		m_instanceServer = std::make_unique<ControlServer>(false);
+		m_instanceServer->Alloc();
+		if (!m_instanceServer->Start(kInstanceEndpoint)) m_instanceServer.reset();
+	}
+
 	if (HasArgument(L"-cmd")) m_bShowCmd = true;
 	if (m_bShowCmd && (HasArgument(L"-help"))) m_bShowHelp = true;
 	if (m_bShowCmd && (HasArgument(L"-Args"))) m_bShowArgs = true;
@@ -24,9 +77,20 @@ void CommandLineArguments::Open() {
 	//if (m_bShowCmd) ShowCmd();
 }
 
-void CommandLineArguments::Tick() {}
+void CommandLineArguments::Tick() {
+	if (!m_pendingExec.empty()) {
+		ConsoleWindow* console = m_memory->Get<ConsoleWindow>();
+		std::string	   output;
+		for (const std::string& command : m_pendingExec) console->ExecRemoteCommand(command, output);
+		m_pendingExec.clear();
+	}
 
-void CommandLineArguments::Close() { }
+	if (m_instanceServer) m_instanceServer->Tick();
+}
+
+void CommandLineArguments::Close() {
+	if (m_instanceServer) m_instanceServer->Close();
+}
 
 /**
  * Checks if a specific argument exists in the command line
@@ -34,17 +98,14 @@ void CommandLineArguments::Close() { }
  * Example usage:
  *   if (m_cmdArgs->HasArgument(L"-maximized")) { ... }
  * 
- * @param arg The argument to check (automatically converted to lowercase)
+ * @param arg The argument to check (case-insensitive)
  * @return true if the argument was found, false otherwise
  */
 bool CommandLineArguments::HasArgument(const std::wstring& arg) {
 
-	// Convert argument to lowercase for case-insensitive comparison
-	std::wstring lowerArg = Helpers::strtoLowerW(arg);
-
-	// Check if the argument exists in the Args map
+	// Check if the argument exists in the Args map (its comparator ignores case)
 	// find() returns an iterator; if it equals end(), the argument wasn't found
-	return Args.find(lowerArg) != Args.end();
+	return Args.find(arg) != Args.end();
 }
 /**
  * Gets the value following a command line argument
@@ -61,11 +122,8 @@ bool CommandLineArguments::HasArgument(const std::wstring& arg) {
 std::wstring CommandLineArguments::GetArgumentValue(const std::wstring& arg,
 													const std::wstring& defaultValue) {
 
-	// Convert argument to lowercase
-	std::wstring lowerArg = Helpers::strtoLowerW(arg);
-
-	// Try to find the argument in the map
-	auto it = Args.find(lowerArg);
+	// Try to find the argument in the map (case-insensitive)
+	auto it = Args.find(arg);
 
 	// If argument not found, return default value
 	if (it == Args.end()) { return defaultValue; }
@@ -86,9 +144,7 @@ std::wstring CommandLineArguments::GetArgumentValue(const std::wstring& arg,
 
 int CommandLineArguments::GetInitArgs() {
 
-	szArgList = CommandLineToArgvW(GetCommandLine(), &argCount);
-
-	if (szArgList == NULL) {
+	if (ParseArgs(GetCommandLineW()) != 0) {
 		MessageBox(NULL, L"Unable to parse command line", L"Error", MB_OK);
 		throw std::runtime_error("Unable to parse command line");
 		return EXIT_FAILURE;
@@ -96,12 +152,116 @@ int CommandLineArguments::GetInitArgs() {
 
 	std::cout << "arguments passed: " << argCount;
 
-	for (int i = 0; i < argCount; i++) { Args.insert(std::make_pair(Helpers::strtoLowerW(szArgList[i]), i)); }
+	return 0;
+}
+
+int CommandLineArguments::ParseArgs(LPCWSTR commandLine) {
+	LocalFree(szArgList);
+	Args.clear();
+	argCount = 0;
 
+	szArgList = CommandLineToArgvW(commandLine, &argCount);
+	if (szArgList == NULL) return EXIT_FAILURE;
 
+	for (int i = 0; i < argCount; i++) { Args.emplace(szArgList[i], i); }
 	return 0;
 }
 
+std::vector<std::string> CommandLineArguments::CollectExecCommands() const {
+	std::vector<std::string> commands;
+	for (int i = 1; i + 1 < argCount; i++) {
+		if (IsExecArgument(szArgList[i])) commands.push_back(utf::ToUtf8(szArgList[++i]));
+	}
+	return commands;
+}
+
+std::wstring CommandLineArguments::JoinForwardedArguments() const {
+	std::wstring joined;
+	for (int i = 1; i < argCount; i++) {
+		if (IsExecArgument(szArgList[i])) {
+			i++; // Sent as its own command
+		} else if (!IsSingleArgument(szArgList[i])) {
+			AppendQuoted(joined, szArgList[i]);
+		}
+	}
+	return joined;
+}
+
+bool CommandLineArguments::ForwardToRunningInstance() {
+	CommandLineArguments args;
+	if (args.ParseArgs(GetCommandLineW()) != 0) return false;
+	if (!args.HasArgument(L"-single") && !args.HasArgument(L"-single-instance")) return false;
+
+	HANDLE mutex = CreateMutexW(nullptr, FALSE, kInstanceMutexName);
+	if (!mutex) return false;
+	if (GetLastError() != ERROR_ALREADY_EXISTS) {
+		g_instanceMutex = mutex; // First instance: start normally and listen in Open()
+		return false;
+	}
+	CloseHandle(mutex);
+
+	// Let the owner bring its window to the front when it handles 'activate'
+	AllowSetForegroundWindow(ASFW_ANY);
+
+	// The owner takes the mutex before its endpoint exists; wait out its startup
+	ControlClient client;
+	const auto	  deadline = std::chrono::steady_clock::now() + kForwardTimeout;
+	while (!client.Connect(kInstanceEndpoint, 100)) {
+		if (std::chrono::steady_clock::now() >= deadline) return false; // Owner is stuck: start anyway
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	}
+
+	// The protocol is line based: a stray newline would split a command
+	auto line = [](std::string text) {
+		std::replace_if(text.begin(), text.end(), [](char c) { return c == '\r' || c == '\n'; }, ' ');
+		return text;
+	};
+
+	bool sent = client.Post(line("activate " + utf::ToUtf8(args.JoinForwardedArguments())));
+	for (const std::string& command : args.CollectExecCommands()) sent = sent && client.Post(line(command));
+	client.Flush();
+	return sent;
+}
+
+void CommandLineArguments::ApplyForwardedArguments(const std::wstring& commandLine) {
+	// CommandLineToArgvW treats the first token as the program name
+	CommandLineArguments args;
+	if (args.ParseArgs((L"app " + commandLine).c_str()) != 0) return;
+
+	WindowManager* window = m_memory->Get<WindowManager>();
+	const HWND	   hwnd	  = window->GetHWND();
+	if (!hwnd) return;
+
+	if (window->ShouldStartFullscreen(&args)) {
+		SetWindowLongPtrW(hwnd, GWL_STYLE, WS_POPUP | WS_VISIBLE);
+		SetWindowPos(hwnd, HWND_TOP, 0, 0, window->GetMonitorWidth(), window->GetMonitorHeight(),
+					 SWP_FRAMECHANGED);
+	} else if (window->ShouldStartMaximized(&args)) {
+		ShowWindow(hwnd, SW_MAXIMIZE);
+	} else if (window->ShouldStartWindowed(&args) || window->HasAnyWindowArguments(&args)) {
+		if (GetWindowLongPtrW(hwnd, GWL_STYLE) & WS_POPUP)
+			SetWindowLongPtrW(hwnd, GWL_STYLE, WS_OVERLAPPEDWINDOW | WS_VISIBLE);
+		ShowWindow(hwnd, SW_RESTORE);
+
+		// Only what was given changes; the rest keeps the current placement
+		RECT rect;
+		::GetWindowRect(hwnd, &rect);
+		const int x		 = args.GetArgumentValueInt(L"-x", rect.left);
+		const int y		 = args.GetArgumentValueInt(L"-y", rect.top);
+		const int width	 = args.HasArgument(L"-width") || args.HasArgument(L"-w") ? window->GetWindowWidth(&args)
+																				   : rect.right - rect.left;
+		const int height = args.HasArgument(L"-height") || args.HasArgument(L"-h") ? window->GetWindowHeight(&args)
+																					: rect.bottom - rect.top;
+		SetWindowPos(hwnd, nullptr, x, y, width, height, SWP_NOZORDER | SWP_FRAMECHANGED);
+	} else if (IsIconic(hwnd)) {
+		ShowWindow(hwnd, SW_RESTORE);
+	}
+
+	if (args.HasArgument(L"-cmd")) m_memory->Get<ConsoleWindow>()->CommandShowCmd();
+
+	SetForegroundWindow(hwnd);
+}
+
 /**
  * Gets an integer value from a command line argument
  * 
@@ -144,7 +304,7 @@ void CommandLineArguments::PrintHelp() {
     if(!m_bShowCmd) return;
 
 
-	OutputConsole* cmd = m_memory->Get_OutputConsole();
+	OutputConsole* cmd = m_memory->Get<OutputConsole>();
 	// Print header
 	cmd->Out << tc::bright_blue;
 	cmd->Out << L"\n=== Command Line Arguments ===" << std::endl;
@@ -167,6 +327,9 @@ void CommandLineArguments::PrintHelp() {
 	cmd->Out << L"\nOther Options:" << std::endl;
 	cmd->Out << L"  -cmd                              : Show m_console m_window" << std::endl;
 	cmd->Out << L"  -help                       : Show this help message" << std::endl;
+	cmd->Out << L"  -exec <command>                   : Run a console command once started (repeatable)" << std::endl;
+	cmd->Out << L"  -single                           : Single instance: later launches forward their" << std::endl;
+	cmd->Out << L"                                      arguments and -exec commands to the first one" << std::endl;
 
 	// Print examples
 	cmd->Out << L"\nExamples:" << std::endl;
@@ -174,6 +337,7 @@ void CommandLineArguments::PrintHelp() {
 	cmd->Out << L"  program.exe -width 1920 -height 1080" << std::endl;
 	cmd->Out << L"  program.exe -fullscreen" << std::endl;
 	cmd->Out << L"  program.exe -x 100 -y 100 -width 800 -height 600" << std::endl;
+	cmd->Out << L"  program.exe -single -exec \"log info build finished\"" << std::endl;
 
 	cmd->Out << L"\n==============================\n" << std::endl;
 
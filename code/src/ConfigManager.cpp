@@ -21,7 +21,12 @@ namespace app {
 ConfigManager::ConfigManager()
 : m_config(),						// Initialize config struct
   m_configFilePath(L"config.json"), // Configuration file name (wide string)
-  m_bConfigLoaded(false)			// No config loaded yet
+  m_bConfigLoaded(false),			// No config loaded yet
+  m_bClosed(false),					// Close() not called yet
+  m_pendingMutex(),
+  m_pendingJson(),
+  m_bWriteScheduled(false),			// No write job in flight
+  m_fileMutex()
 {
 	// Set default clear color values
 	// These values represent a dark gray background
@@ -34,13 +39,12 @@ ConfigManager::ConfigManager()
 /**
  * @brief Destructor - Cleans up resources
  * 
- * Automatically saves configuration before destruction to ensure
- * any changes are persisted to disk.
+ * Saves the configuration if Close() was never called, so changes are
+ * persisted without writing the file twice on a normal shutdown.
  */
 ConfigManager::~ConfigManager() {
-	// Save configuration on destruction
-	// This ensures any changes are written to disk
-	SaveConfiguration();
+	// Close() already wrote the file on a normal shutdown
+	if (!m_bClosed) SaveConfiguration();
 
 	// Reset the loaded flag
 	m_bConfigLoaded = false;
@@ -56,15 +60,28 @@ ConfigManager::~ConfigManager() {
  * @override Master::Open()
  */
 void ConfigManager::Open() {
+	Open(std::wcout, std::wcerr);
+}
+
+/**
+ * @brief Opens the configuration manager, reporting to the given streams
+ *
+ * Startup runs this on a worker while the main thread may be reopening the
+ * console streams, so it writes to buffers the main thread prints later.
+ *
+ * @param out Receives progress messages
+ * @param err Receives error messages
+ */
+void ConfigManager::Open(std::wostream& out, std::wostream& err) {
 	// Try to load configuration from disk
 	// If loading fails, we'll use the default values set in constructor
-	if (!LoadConfiguration()) {
+	if (!LoadConfiguration(out, err)) {
 		// Loading failed - print message to m_console
 		// Convert wide string to narrow string for m_console output
-		std::wcout << L"Using default configuration values" << std::endl;
+		out << L"Using default configuration values" << std::endl;
 	} else {
 		// Loading succeeded - print confirmation with file path
-		std::wcout << L"Configuration loaded successfully from " << m_configFilePath << std::endl;
+		out << L"Configuration loaded successfully from " << m_configFilePath << std::endl;
 	}
 }
 
@@ -95,6 +112,7 @@ void ConfigManager::Close() {
 	// Save configuration before closing
 	// This ensures any unsaved changes are written to disk
 	SaveConfiguration();
+	m_bClosed = true;
 
 	// Print confirmation message
 	std::wcout << L"ConfigManager closed and configuration saved" << std::endl;
@@ -118,9 +136,11 @@ void ConfigManager::Close() {
  * - Reads file as UTF-8 encoded text
  * - reflectcpp handles UTF-8 JSON parsing
  * 
+ * @param out Receives progress messages
+ * @param err Receives error messages
  * @return true if configuration loaded successfully, false otherwise
  */
-bool ConfigManager::LoadConfiguration() {
+bool ConfigManager::LoadConfiguration(std::wostream& out, std::wostream& err) {
 	// Try-catch block to handle any file or parsing errors
 	try {
 		// Create a filesystem path object from the wide string config file path
@@ -132,7 +152,7 @@ bool ConfigManager::LoadConfiguration() {
 		if (!std::filesystem::exists(configPath)) {
 			// File doesn't exist - this is not an error on first run
 			// Return false to indicate we should use default values
-			std::wcout << L"Configuration file not found: " << m_configFilePath << std::endl;
+			out << L"Configuration file not found: " << m_configFilePath << std::endl;
 			return false;
 		}
 
@@ -145,7 +165,7 @@ bool ConfigManager::LoadConfiguration() {
 		// is_open() returns true if the file stream is ready to read
 		if (!configFile.is_open()) {
 			// File exists but couldn't be opened (permission issue, etc.)
-			std::wcerr << L"Failed to open configuration file: " << m_configFilePath << std::endl;
+			err << L"Failed to open configuration file: " << m_configFilePath << std::endl;
 			return false;
 		}
 
@@ -183,9 +203,17 @@ bool ConfigManager::LoadConfiguration() {
 			// value() returns the deserialized AppConfiguration struct
 			m_config = result.value();
 
+			// Hand archived console variables to the registry
+			if (m_config.cvars) {
+				CVarRegistry::Get_CVarRegistry_Singleton()->LoadArchived(*m_config.cvars);
+			}
+
 			// Set the loaded flag to true
 			m_bConfigLoaded = true;
 
+			// Clear color and cvars changed all at once; usually published from a startup worker
+			EventBus::Get_EventBus_Singleton()->Publish(ConfigChanged{nullptr});
+
 			// Return success
 			return true;
 		} else {
@@ -194,7 +222,7 @@ bool ConfigManager::LoadConfiguration() {
 			// Convert error message to wide string for m_console output
 			std::string	 errorMsg = result.error().what();
 			std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-			std::wcerr << L"Failed to parse configuration JSON: " << wErrorMsg << std::endl;
+			err << L"Failed to parse configuration JSON: " << wErrorMsg << std::endl;
 			return false;
 		}
 
@@ -205,7 +233,7 @@ bool ConfigManager::LoadConfiguration() {
 		// Convert error message to wide string for m_console output
 		std::string	 errorMsg = e.what();
 		std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-		std::wcerr << L"Exception while loading configuration: " << wErrorMsg << std::endl;
+		err << L"Exception while loading configuration: " << wErrorMsg << std::endl;
 		return false;
 	}
 }
@@ -230,8 +258,11 @@ bool ConfigManager::LoadConfiguration() {
  * @return true if configuration saved successfully, false otherwise
  */
 bool ConfigManager::SaveConfiguration() {
-	// Try-catch block to handle any serialization or file errors
+	// Try-catch block to handle any serialization errors
 	try {
+		// Snapshot the current console variable values so they are written too
+		m_config.cvars = CVarRegistry::Get_CVarRegistry_Singleton()->SaveArchived();
+
 		// Use reflectcpp to serialize the configuration struct to UTF-8 JSON
 		// rfl::json::write is a template function that:
 		// 1. Inspects the struct members using reflection
@@ -240,48 +271,94 @@ bool ConfigManager::SaveConfiguration() {
 		// 4. Returns a formatted UTF-8 JSON string
 		std::string jsonContent = rfl::json::write(m_config);
 
-		// Create a filesystem path object from wide string
-		std::filesystem::path configPath(m_configFilePath);
+		return WriteJson(jsonContent);
 
-		// Open the file for writing with binary mode
-		// std::ofstream is an output file stream
-		// std::ios::out - open for writing (default for ofstream)
-		// std::ios::trunc - truncate file if it exists (overwrite)
-		// std::ios::binary - write in binary mode (no text conversions)
-		// Binary mode ensures UTF-8 is written exactly as-is
-		std::ofstream configFile(configPath, std::ios::out | std::ios::trunc | std::ios::binary);
+	} catch (const std::exception& e) {
+		// Catch any exceptions during serialization
+		// Convert error message to wide string for m_console output
+		std::string	 errorMsg = e.what();
+		std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+		std::wcerr << L"Exception while saving configuration: " << wErrorMsg << std::endl;
+		return false;
+	}
+}
 
-		// Check if file was opened successfully
-		if (!configFile.is_open()) {
-			// Failed to open file for writing (permission issue, disk full, etc.)
-			std::wcerr << L"Failed to open configuration file for writing: " << m_configFilePath
-					   << std::endl;
-			return false;
+/**
+ * @brief Saves the configuration without waiting for the disk
+ *
+ * The JSON is built here, from the caller's thread, and written by a job.
+ * Saves made while a write is in flight replace each other, so dragging the
+ * color picker writes the file as often as the disk keeps up and ends with the
+ * last color. Falls back to SaveConfiguration() when the job system is not
+ * running.
+ */
+void ConfigManager::SaveConfigurationAsync() {
+	JobSystem* jobs = JobSystem::Get_JobSystem_Singleton();
+	if (!jobs->IsRunning()) {
+		SaveConfiguration();
+		return;
+	}
+
+	std::string jsonContent;
+	try {
+		m_config.cvars = CVarRegistry::Get_CVarRegistry_Singleton()->SaveArchived();
+		jsonContent	   = rfl::json::write(m_config);
+	} catch (const std::exception& e) {
+		std::string	 errorMsg = e.what();
+		std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+		std::wcerr << L"Exception while saving configuration: " << wErrorMsg << std::endl;
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_pendingMutex);
+		m_pendingJson = std::move(jsonContent);
+		if (m_bWriteScheduled) return; // The write in flight picks it up
+		m_bWriteScheduled = true;
+	}
+	jobs->Schedule([this]() { WritePending(); });
+}
+
+/**
+ * @brief Job of SaveConfigurationAsync(): writes the newest JSON until none is left
+ */
+void ConfigManager::WritePending() {
+	for (;;) {
+		std::string jsonContent;
+		{
+			std::lock_guard<std::mutex> lock(m_pendingMutex);
+			if (m_pendingJson.empty()) {
+				m_bWriteScheduled = false;
+				return;
+			}
+			jsonContent.swap(m_pendingJson);
 		}
+		WriteJson(jsonContent);
+	}
+}
 
-		// Write the UTF-8 JSON content to the file
-		// The << operator writes the string to the file stream
-		// Since we opened in binary mode, UTF-8 bytes are written directly
-		// No character set conversion is performed
-		configFile << jsonContent;
-
-		// Flush the buffer to ensure all data is written
-		// This forces any buffered data to be written to disk immediately
-		configFile.flush();
-
-		// Check if write operation succeeded
-		// good() returns true if no errors occurred during writing
-		if (!configFile.good()) {
-			std::wcerr << L"Error occurred while writing configuration file" << std::endl;
-			configFile.close();
+/**
+ * @brief Writes serialized configuration to the file
+ *
+ * Called by SaveConfiguration() on the caller's thread and by the job of
+ * SaveConfigurationAsync(); the two never write the file at the same time.
+ *
+ * @param jsonContent UTF-8 JSON produced by rfl::json::write()
+ * @return true if the file was written
+ */
+bool ConfigManager::WriteJson(const std::string& jsonContent) {
+	std::lock_guard<std::mutex> fileLock(m_fileMutex);
+
+	// Try-catch block to handle any file errors
+	try {
+		// Written next to the file and renamed over it, so an exit in the middle
+		// of the write (see App::Shutdown) never leaves a truncated config.json
+		if (!Helpers::WriteFileAtomic(m_configFilePath, jsonContent)) {
+			// Permission issue, disk full, etc.
+			std::wcerr << L"Failed to write configuration file: " << m_configFilePath << std::endl;
 			return false;
 		}
 
-		// Close the file
-		// This flushes any remaining buffered data and releases the file handle
-		// Good practice to explicitly close files
-		configFile.close();
-
 		// Print confirmation message with file path
 		std::wcout << L"Configuration saved to " << m_configFilePath << std::endl;
 
@@ -289,7 +366,7 @@ bool ConfigManager::SaveConfiguration() {
 		return true;
 
 	} catch (const std::exception& e) {
-		// Catch any exceptions during serialization or file writing
+		// Catch any exceptions during file writing
 		// Convert error message to wide string for m_console output
 		std::string	 errorMsg = e.what();
 		std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
@@ -303,6 +380,7 @@ bool ConfigManager::SaveConfiguration() {
  * 
  * Updates the clear color in the configuration struct.
  * Call SaveConfiguration() after this to persist changes.
+ * Publishes ConfigChanged, which is how App picks up the new color.
  * 
  * @param r Red component (0.0 to 1.0)
  * @param g Green component (0.0 to 1.0)
@@ -315,6 +393,9 @@ void ConfigManager::SetClearColor(float r, float g, float b, float a) {
 	m_config.clearColorG = g; // Green component
 	m_config.clearColorB = b; // Blue component
 	m_config.clearColorA = a; // Alpha component (opacity)
+
+	// App draws with the new color from this frame on
+	EventBus::Get_EventBus_Singleton()->Publish(ConfigChanged{nullptr});
 }
 
 /**
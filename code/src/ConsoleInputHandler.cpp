@@ -6,27 +6,44 @@
 #include "ConsoleInputHandler.hpp"
 #include "App.hpp"
 #include "DX12Renderer.hpp"
+#include "PoolAllocator.hpp"
+#include "Utf.hpp"
 #include <psapi.h>
 #include <iomanip>
 #include <dxgi1_4.h>
+#ifndef _WIN32
+#include <poll.h>
+#include <unistd.h>
+#endif
 namespace app {
+
+// Bytes (or UTF-16 units for the console) read from stdin per system call
+static constexpr size_t kInputChunkSize = 64 * 1024;
+
+// Upper bound for StopInputThread() to get the reader out of a blocking read
+static constexpr auto kInputStopTimeout = std::chrono::milliseconds(250);
+
 /**
  * @brief Default constructor - Initializes all member variables
  * 
  * Sets up the initial state:
  * - No input thread running
  * - Flags set to false (not running, not stopping)
- * - Empty command queue
+ * - Empty command ring (in the heap allocated reader state)
  * - Initializes command descriptions map
  */
 ConsoleInputHandler::ConsoleInputHandler()
 : m_inputThread(),
-  m_bIsRunning(false),
-  m_bShouldStop(false),
-  m_commandMutex(),
-  m_commandQueue(),
+  m_reader(std::make_shared<ReaderState>()),
+  m_batch(),
+  m_commandsProcessed(0),
+  m_lastLatencyUs(0.0),
+  m_maxLatencyUs(0.0),
   m_commandDescriptions() {
 
+	// Reserve once so draining a full ring never reallocates
+	m_batch.reserve(CommandRing::GetCapacity());
+
 	// Initialize the command descriptions map
 	// This map stores command names as keys and their descriptions as values
 	// Used for the help system to display available commands
@@ -43,29 +60,36 @@ ConsoleInputHandler::ConsoleInputHandler()
  * @brief Destructor - Ensures proper cleanup of resources
  * 
  * This destructor:
- * 1. Signals the input thread to stop via m_bShouldStop flag
+ * 1. Signals the input thread to stop via the shouldStop flag of the reader state
  * 2. Waits for the thread to finish if it's joinable
  * 3. Cleans up the command queue
  * 
  * Thread safety: Uses atomic flag to safely signal thread termination
  */
 ConsoleInputHandler::~ConsoleInputHandler() {
-	// Signal the input thread to stop
-	// This is an atomic operation, so it's thread-safe
-	m_bShouldStop = true;
+	// Wake the reader out of its blocking read and join it (bounded time);
+	// a detached reader keeps its own reference to the state
+	StopInputThread();
+}
 
-	// Check if the thread is joinable (i.e., it's running and can be joined)
-	// A thread is joinable if it has been started and not yet joined or detached
-	if (m_inputThread.joinable()) {
-		// Wait for the thread to finish its execution
-		// This blocks until the thread terminates
-		// Important: Always join or detach threads before destruction
-		m_inputThread.join();
-	}
+ConsoleInputHandler::ReaderState::ReaderState() :
+isRunning(false),
+shouldStop(false),
+readerExited(true),
+#ifdef _WIN32
+wideChunk(),
+#else
+wakePipe{-1, -1},
+#endif
+commandRing() {
+}
 
-	// Set running flag to false
-	// This indicates that the handler is no longer active
-	m_bIsRunning = false;
+ConsoleInputHandler::ReaderState::~ReaderState() {
+#ifndef _WIN32
+	// Release the wakeup pipe created in Open(), once the reader is gone too
+	if (wakePipe[0] >= 0) close(wakePipe[0]);
+	if (wakePipe[1] >= 0) close(wakePipe[1]);
+#endif
 }
 
 /**
@@ -83,21 +107,34 @@ ConsoleInputHandler::~ConsoleInputHandler() {
  * Thread safety: Uses atomic flags for thread synchronization
  */
 void ConsoleInputHandler::Open() {
+	// A reader detached by an earlier stop may still hold the old state
+	if (!m_reader->readerExited) m_reader = std::make_shared<ReaderState>();
+	ReaderState& reader = *m_reader;
+
 	// Set the running flag to true
 	// This atomic operation is thread-safe
 	// Indicates that the handler is now active
-	m_bIsRunning = true;
+	reader.isRunning = true;
 
 	// Reset the stop flag to false
 	// Ensures the thread will run (not be told to stop immediately)
-	m_bShouldStop = false;
+	reader.shouldStop = false;
+
+	// The reader has not started yet; StopInputThread() waits for this to flip
+	reader.readerExited = false;
+
+#ifndef _WIN32
+	// Self-pipe used to wake poll() when the handler is stopped
+	if (reader.wakePipe[0] < 0 && pipe(reader.wakePipe) != 0) {
+		reader.wakePipe[0] = reader.wakePipe[1] = -1;
+		throw std::runtime_error("ConsoleInputHandler: cannot create wakeup pipe");
+	}
+#endif
 
 	// Create and start a new thread
-	// std::thread constructor takes a function pointer and optional arguments
-	// &ConsoleInputHandler::InputThreadFunction: pointer to member function
-	// this: pointer to the current object (needed for member function call)
-	// The thread will start executing InputThreadFunction immediately
-	m_inputThread = std::thread(&ConsoleInputHandler::InputThreadFunction, this);
+	// The thread gets its own reference to the reader state, never `this`,
+	// so it may outlive the handler if StopInputThread() has to detach it
+	m_inputThread = std::thread(&ConsoleInputHandler::InputThreadFunction, m_reader);
 
 	// Print welcome message to m_console
 	// std::cout is thread-safe for individual operations
@@ -113,42 +150,99 @@ void ConsoleInputHandler::Open() {
  * This method is called repeatedly from the main application loop.
  * It processes all commands that have been queued by the input thread.
  * 
- * Process flow:
- * 1. Lock the command mutex to ensure thread-safe access to the queue
- * 2. Process all commands currently in the queue
- * 3. Remove each command from the queue after processing
- * 4. Unlock the mutex automatically when scope ends
+ * Process flow (swap-and-process):
+ * 1. Drain the lock-free ring into the local m_batch vector
+ * 2. Run every command in the batch - no lock is held, so a slow command
+ *    (e.g. 'status') never blocks the input thread from enqueueing
+ * 3. Record the input-to-execution latency of each command
  * 
- * Thread safety: Uses std::lock_guard for automatic mutex management
- * Performance: Processes all queued commands in one Tick() call
+ * Thread safety: The ring is single-producer (input thread) /
+ * single-consumer (this method), so no mutex is needed
  */
 void ConsoleInputHandler::Tick() {
-	// Create a lock guard to automatically lock and unlock the mutex
-	// std::lock_guard locks the mutex in its constructor
-	// It automatically unlocks the mutex when it goes out of scope (RAII)
-	// This ensures the mutex is always unlocked, even if an exception occurs
-	std::lock_guard<std::mutex> lock(m_commandMutex);
-
-	// Process all commands currently in the queue
-	// We continue looping while the queue is not empty
-	while (!m_commandQueue.empty()) {
-		// Get the first command from the front of the queue
-		// std::queue is FIFO (First In, First Out)
-		// front() returns a reference to the first element
-		std::string command = m_commandQueue.front();
-
-		// Remove the first command from the queue
-		// pop() removes the front element
-		// We must call pop() after getting the value with front()
-		m_commandQueue.pop();
-
-		// Process the command
-		// This calls ProcessCommand which executes the command logic
-		ProcessCommand(command);
+	DrainRing(m_reader->commandRing, m_batch);
+
+	for (const QueuedCommand& command : m_batch) {
+		// Latency from the moment the line was queued until it starts executing
+		const double latencyUs = std::chrono::duration<double, std::micro>(
+									 std::chrono::steady_clock::now() - command.enqueued)
+									 .count();
+		m_lastLatencyUs = latencyUs;
+		m_maxLatencyUs	= std::max(m_maxLatencyUs, latencyUs);
+		m_commandsProcessed++;
+
+		if (!command.bProbe) ProcessCommand(command.text);
 	}
 
-	// The lock_guard automatically unlocks the mutex here
-	// when it goes out of scope at the end of the function
+	// clear() keeps the capacity for the next frame
+	m_batch.clear();
+}
+
+/**
+ * @brief Moves every command currently in the ring into batch
+ * 
+ * Consumer side of the SPSC ring; only one thread may call this per ring.
+ * 
+ * @param ring Ring to drain
+ * @param batch Destination, appended to
+ */
+void ConsoleInputHandler::DrainRing(CommandRing& ring, std::vector<QueuedCommand>& batch) {
+	QueuedCommand command;
+	while (ring.TryPop(command)) batch.push_back(std::move(command));
+}
+
+/**
+ * @brief Measures hand-off latency from a producer thread to this thread
+ * 
+ * A private producer thread sends one timestamped probe at a time and waits
+ * until the consumer has picked it up before sending the next, so each
+ * sample is the one-way latency through an idle ring rather than queueing
+ * delay. The consumer spins on DrainRing() just like Tick() does.
+ * 
+ * @param iterations Number of probes to time (a 10% warmup is added)
+ * @return Latency statistics in microseconds
+ */
+BenchResult ConsoleInputHandler::MeasureQueueLatency(uint32_t iterations) {
+	using clock = std::chrono::steady_clock;
+
+	iterations			  = std::max(iterations, 1u);
+	const uint32_t warmup = std::clamp(iterations / 10, 1u, 1000u);
+	const uint32_t total  = warmup + iterations;
+
+	auto					   ring = std::make_unique<CommandRing>();
+	std::atomic<uint32_t>	   consumed{0};
+	std::vector<QueuedCommand> batch;
+	batch.reserve(CommandRing::GetCapacity());
+
+	std::thread producer([&]() {
+		for (uint32_t i = 0; i < total; i++) {
+			QueuedCommand probe{std::string(), clock::now(), true};
+			while (!ring->TryPush(std::move(probe))) std::this_thread::yield();
+
+			// Wait for the consumer so the next probe finds an empty ring
+			while (consumed.load(std::memory_order_acquire) <= i) std::this_thread::yield();
+		}
+	});
+
+	std::vector<double> samples;
+	samples.reserve(iterations);
+
+	uint32_t received = 0;
+	while (received < total) {
+		DrainRing(*ring, batch);
+		const auto now = clock::now();
+		for (const QueuedCommand& probe : batch) {
+			if (received++ >= warmup) {
+				samples.push_back(
+					std::chrono::duration<double, std::micro>(now - probe.enqueued).count());
+			}
+		}
+		batch.clear();
+		consumed.store(received, std::memory_order_release);
+	}
+
+	producer.join();
+	return Benchmark::FromSamples("input_queue", samples, warmup, 0, 0);
 }
 
 /**
@@ -178,160 +272,250 @@ void ConsoleInputHandler::Close() {
  * 
  * This method:
  * 1. Sets the stop flag to signal the thread
- * 2. Checks if the thread is joinable
- * 3. Waits for the thread to finish
+ * 2. Wakes the thread if it is blocked reading stdin
+ * 3. Waits (bounded) for the thread to finish
  * 4. Sets the running flag to false
  * 
- * This is a helper method that can be called from multiple places.
+ * Waking the reader:
+ * - Windows: stdin may be a console, an anonymous pipe or a file, none of
+ *   which can be waited on together with an event, so the pending
+ *   ReadConsoleW/ReadFile is cancelled with CancelSynchronousIo(). The call
+ *   is repeated until the thread reports it has left the read, because the
+ *   cancel is lost if it lands just before the read starts.
+ * - POSIX: a byte is written to the self-pipe the reader polls alongside
+ *   stdin.
  * 
- * Thread safety: Uses atomic operations and proper synchronization
+ * If the reader has still not exited after kInputStopTimeout it is detached
+ * so shutdown never hangs on user input.
+ * 
+ * This is a helper method that can be called from multiple places.
  */
 void ConsoleInputHandler::StopInputThread() {
+	ReaderState& reader = *m_reader;
+
 	// Signal the thread to stop by setting the atomic flag
 	// The input thread checks this flag in its loop
-	m_bShouldStop = true;
+	reader.shouldStop = true;
 
-	// Check if the thread is joinable (running and not yet joined)
 	if (m_inputThread.joinable()) {
-		// Wait for the thread to finish
-		// join() blocks until the thread terminates
-		// This ensures proper cleanup before continuing
-		m_inputThread.join();
+		const auto deadline = std::chrono::steady_clock::now() + kInputStopTimeout;
+
+#ifdef _WIN32
+		HANDLE hThread = static_cast<HANDLE>(m_inputThread.native_handle());
+		while (!reader.readerExited && std::chrono::steady_clock::now() < deadline) {
+			CancelSynchronousIo(hThread);
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+#else
+		if (reader.wakePipe[1] >= 0) {
+			const char wake = 1;
+			(void)write(reader.wakePipe[1], &wake, 1);
+		}
+		while (!reader.readerExited && std::chrono::steady_clock::now() < deadline) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+#endif
+
+		if (reader.readerExited) {
+			m_inputThread.join();
+		} else {
+			// Read could not be cancelled - don't let stdin hold shutdown hostage;
+			// the thread owns a reference to the reader state, so nothing it touches is freed
+			std::cerr << "Console input thread did not stop in time; detaching" << std::endl;
+			m_inputThread.detach();
+		}
 	}
 
 	// Mark the handler as not running
 	// This atomic operation is thread-safe
-	m_bIsRunning = false;
+	reader.isRunning = false;
 }
 
 /**
  * @brief Input thread function - Runs in a separate thread
  * 
- * This function continuously reads input from the m_console.
- * It runs in its own thread, separate from the main application thread.
+ * Reads stdin in large chunks and splits them into lines, so piped input
+ * (app < commands.txt) is consumed at full speed instead of one getline()
+ * per line. Interactive consoles still deliver one line per read.
  * 
  * Process flow:
- * 1. Display a prompt (">")
- * 2. Wait for user to type a line and press Enter
- * 3. Add the command to the queue (thread-safe)
- * 4. Check if we should stop
- * 5. Repeat
- * 
- * Thread lifetime:
- * - Starts when the thread is created in Open()
- * - Runs until m_bShouldStop is set to true
- * - Exits cleanly, allowing the thread to be joined
- * 
- * Thread safety: Uses mutex to protect the command queue
+ * 1. Display a prompt (">") when reading from an interactive console
+ * 2. Read whatever is available (blocking, but cancellable - see
+ *    StopInputThread())
+ * 3. Split the chunk into lines; a trailing partial line is kept for the
+ *    next read
+ * 4. Queue each line for the main thread
+ * 5. Repeat until EOF, error, 'exit'/'quit' or shouldStop
+ * 
+ * Thread safety: Producer side of the SPSC command ring. Touches nothing but
+ * the shared reader state, which it keeps alive.
  */
-void ConsoleInputHandler::InputThreadFunction() {
+void ConsoleInputHandler::InputThreadFunction(std::shared_ptr<ReaderState> statePtr) {
+	ReaderState& state = *statePtr;
+
 	// Print initial message indicating thread has started
 	std::cout << "Console input thread started. Waiting for commands..." << std::endl;
 
-	// Main input loop - continues until m_bShouldStop becomes true
-	// m_bShouldStop is an atomic bool, so this check is thread-safe
-	while (!m_bShouldStop) {
-		// Display the command prompt
-		// std::cout << ">" means "print > without a newline"
-		// std::flush ensures the prompt is displayed immediately (flushes buffer)
-		std::cout << "> " << std::flush;
-
-		// String to store the user's input
-		std::string input;
-
-		// Read a line of input from the m_console
-		// std::getline reads from std::cin until a newline character
-		// It stores the result in 'input' (excluding the newline)
-		// This call blocks (waits) until the user presses Enter
-		std::getline(std::cin, input);
-
-		// Check if input stream is in a good state
-		// std::cin.good() returns false if:
-		// - End of file was reached (Ctrl+D on Unix, Ctrl+Z on Windows)
-		// - An error occurred
-		// - The stream is in a bad state
-		if (!std::cin.good()) {
-			// Stream is not good, break out of the loop
-			// This handles cases like EOF or stream errors
-			break;
-		}
+	std::string pending; // Partial line carried over between reads
+	std::string chunk;	 // Reused read buffer (UTF-8)
+	chunk.reserve(kInputChunkSize);
 
-		// Trim whitespace from both ends of the input string
-		// This removes leading and trailing spaces, tabs, etc.
+	const bool bInteractive = IsInteractiveInput();
 
-		// Find the first non-whitespace character from the beginning
-		// std::string::find_first_not_of returns the index of the first character
-		// that is NOT in the specified set (spaces and tabs)
-		// Returns std::string::npos if only whitespace is found
-		size_t start = input.find_first_not_of(" \t");
+	// Main input loop - continues until shouldStop becomes true
+	while (!state.shouldStop) {
+		if (bInteractive) std::cout << "> " << std::flush;
 
-		// Find the last non-whitespace character from the end
-		// std::string::find_last_not_of searches from the end backwards
-		size_t end = input.find_last_not_of(" \t");
+		// Blocks until input, EOF, error or cancellation
+		if (!ReadInputChunk(state, chunk)) break;
 
-		// Check if the string contains any non-whitespace characters
-		// If start == std::string::npos, the string is all whitespace
-		if (start == std::string::npos) {
-			// Empty or whitespace-only input, skip to next iteration
-			continue;
-		}
+		if (!ConsumeInputChunk(state, chunk, pending)) break;
+	}
 
-		// Extract the trimmed substring
-		// substr(start, length) extracts a substring
-		// end - start + 1 calculates the length of the non-whitespace portion
-		input = input.substr(start, end - start + 1);
-
-		// Convert the command to lowercase for case-insensitive comparison
-		// This allows users to type "HELP", "help", or "Help" and get the same result
-		std::string lowerInput = input;
-
-		// std::transform applies a function to each character
-		// Parameters:
-		// 1. lowerInput.begin(): start of the range to transform
-		// 2. lowerInput.end(): end of the range
-		// 3. lowerInput.begin(): where to store the result (same string)
-		// 4. ::tolower: function to apply to each character (convert to lowercase)
-		std::transform(lowerInput.begin(), lowerInput.end(), lowerInput.begin(),
-					   [](unsigned char c) { return std::tolower(c); });
-
-		// Check for exit commands
-		// If user types "exit" or "quit", signal the application to stop
-		if (lowerInput == "exit" || lowerInput == "quit") {
-			// Print exit message
-			std::cout << "Exit command received. Shutting down..." << std::endl;
+	// A final line without a trailing newline (end of a piped file)
+	if (!state.shouldStop && !pending.empty()) {
+		pending.push_back('\n');
+		std::string empty;
+		ConsumeInputChunk(state, pending, empty);
+	}
 
-			// Set the stop flag to true
-			// This will cause this loop to exit on the next iteration
-			m_bShouldStop = true;
+	// Print message when thread is exiting
+	std::cout << "Console input thread exiting..." << std::endl;
 
-			// Also set running flag to false
-			m_bIsRunning = false;
+	// Lets StopInputThread() stop cancelling and join
+	state.readerExited = true;
+}
 
-			// Break out of the loop immediately
-			break;
-		}
+/**
+ * @brief Checks whether stdin is an interactive console (vs. pipe or file)
+ * @return true for a console / terminal
+ */
+bool ConsoleInputHandler::IsInteractiveInput() {
+#ifdef _WIN32
+	DWORD mode = 0;
+	return GetConsoleMode(GetStdHandle(STD_INPUT_HANDLE), &mode) != 0;
+#else
+	return isatty(STDIN_FILENO) != 0;
+#endif
+}
 
-		// Add the command to the queue for processing in the main thread
-		// We need to lock the mutex because multiple threads access the queue
+/**
+ * @brief Reads the next chunk of stdin as UTF-8
+ * 
+ * Windows: ReadConsoleW for consoles (converted from UTF-16), ReadFile
+ * otherwise. POSIX: poll() on stdin and the wakeup pipe, then read().
+ * 
+ * @param state Reader state; holds the reused console buffer on Windows and
+ *              the wakeup pipe that ends the poll on POSIX
+ * @param out Receives the bytes read (replaced, not appended)
+ * @return false on EOF, error or when the read was cancelled for shutdown
+ */
+bool ConsoleInputHandler::ReadInputChunk(ReaderState& state, std::string& out) {
+	out.clear();
 
-		// Create a lock guard to automatically manage the mutex
-		// The mutex protects the command queue from concurrent access
-		// Lock is acquired here
-		{
-			std::lock_guard<std::mutex> lock(m_commandMutex);
+#ifdef _WIN32
+	HANDLE hInput = GetStdHandle(STD_INPUT_HANDLE);
+	if (hInput == nullptr || hInput == INVALID_HANDLE_VALUE) return false;
+
+	DWORD mode = 0;
+	if (GetConsoleMode(hInput, &mode)) {
+		// Console: cooked mode returns one edited line per call
+		std::vector<wchar_t>& wbuf = state.wideChunk;
+		if (wbuf.empty()) wbuf.resize(kInputChunkSize);
+		DWORD read = 0;
+		if (!ReadConsoleW(hInput, wbuf.data(), static_cast<DWORD>(wbuf.size()), &read, nullptr))
+			return false; // ERROR_OPERATION_ABORTED after CancelSynchronousIo
+		if (read == 0) return false;
+
+		utf::AppendUtf8(out, std::wstring_view(wbuf.data(), read));
+		return true;
+	}
 
-			// Add the command to the back of the queue
-			// push() adds an element to the end of the queue
-			m_commandQueue.push(input);
+	// Pipe or file: read as much as is available
+	out.resize(kInputChunkSize);
+	DWORD read = 0;
+	if (!ReadFile(hInput, out.data(), static_cast<DWORD>(out.size()), &read, nullptr) ||
+		read == 0) {
+		out.clear();
+		return false; // EOF, broken pipe or cancelled
+	}
+	out.resize(read);
+	return true;
+#else
+	pollfd fds[2] = {{STDIN_FILENO, POLLIN, 0}, {state.wakePipe[0], POLLIN, 0}};
+	for (;;) {
+		if (poll(fds, 2, -1) < 0) {
+			if (errno == EINTR) continue;
+			return false;
+		}
+		if (fds[1].revents) return false; // Woken for shutdown
+		break;
+	}
+
+	out.resize(kInputChunkSize);
+	const ssize_t read_bytes = read(STDIN_FILENO, out.data(), out.size());
+	if (read_bytes <= 0) {
+		out.clear();
+		return false;
+	}
+	out.resize(static_cast<size_t>(read_bytes));
+	return true;
+#endif
+}
+
+/**
+ * @brief Splits a chunk into lines and queues them for the main thread
+ * 
+ * @param state Reader state the lines are queued to
+ * @param chunk Bytes just read
+ * @param pending Partial line from the previous chunk; updated with the new
+ *                trailing partial line
+ * @return false if an exit command was read and the reader should stop
+ */
+bool ConsoleInputHandler::ConsumeInputChunk(ReaderState& state, const std::string& chunk, std::string& pending) {
+	size_t lineStart = 0;
+	for (;;) {
+		const size_t newline = chunk.find('\n', lineStart);
+		if (newline == std::string::npos) break;
+
+		// Complete line: previous partial line + this piece
+		pending.append(chunk, lineStart, newline - lineStart);
+		lineStart = newline + 1;
+
+		// Trim whitespace (and the '\r' of CRLF) from both ends
+		const size_t start = pending.find_first_not_of(" \t\r");
+		if (start == std::string::npos) {
+			pending.clear();
+			continue;
+		}
+		const size_t end = pending.find_last_not_of(" \t\r");
+		std::string	 line = pending.substr(start, end - start + 1);
+		pending.clear();
 
-			// The lock is automatically released here when lock goes out of scope
+		// Check for exit commands (case-insensitive)
+		// If user types "exit" or "quit", signal the input thread to stop
+		if (utf::EqualsNoCase(line, "exit") || utf::EqualsNoCase(line, "quit")) {
+			std::cout << "Exit command received. Shutting down..." << std::endl;
+			state.shouldStop = true;
+			state.isRunning	 = false;
+			return false;
 		}
 
-		// Loop continues, displaying the prompt again
+		// Hand the command to the main thread through the lock-free ring
+		// This thread is the only producer, Tick() the only consumer
+		QueuedCommand command{std::move(line), std::chrono::steady_clock::now(), false};
+
+		// The ring only fills up if the main thread stalls (or a large file is
+		// piped in); wait for room instead of dropping input
+		while (!state.commandRing.TryPush(std::move(command))) {
+			if (state.shouldStop) return false;
+			std::this_thread::yield();
+		}
 	}
 
-	// Print message when thread is exiting
-	std::cout << "Console input thread exiting..." << std::endl;
+	// Keep the unterminated tail for the next chunk
+	pending.append(chunk, lineStart, std::string::npos);
+	return true;
 }
 
 /**
@@ -356,36 +540,31 @@ void ConsoleInputHandler::InputThreadFunction() {
  * @param command The command string to process
  */
 void ConsoleInputHandler::ProcessCommand(const std::string& command) {
-	// Convert command to lowercase for case-insensitive comparison
-	// This allows "HELP" and "help" to work the same way
-	std::string lowerCommand = command;
-
-	// Transform each character to lowercase
-	std::transform(lowerCommand.begin(), lowerCommand.end(), lowerCommand.begin(),
-				   [](unsigned char c) { return std::tolower(c); });
+	// Commands are case-insensitive: "HELP" and "help" work the same way
+	using utf::EqualsNoCase;
 
 	// Check for "help" command
-	if (lowerCommand == "help") {
+	if (EqualsNoCase(command, "help")) {
 		// Display the help message
 		PrintHelp();
 	}
 	// Check for "list" command
-	else if (lowerCommand == "list") {
+	else if (EqualsNoCase(command, "list")) {
 		// List all available commands
 		ListCommands();
 	}
 	// Check for "clear" command
-	else if (lowerCommand == "clear" || lowerCommand == "cls") {
+	else if (EqualsNoCase(command, "clear") || EqualsNoCase(command, "cls")) {
 		// Clear the m_console screen
 		ClearConsole();
 	}
 	// Check for "status" command
-	else if (lowerCommand == "status") {
+	else if (EqualsNoCase(command, "status")) {
 		// Display comprehensive application status
 		ShowStatus();
 	}
 	// Check for "echo" command (echoes back the text)
-	else if (lowerCommand.substr(0, 5) == "echo ") {
+	else if (utf::StartsWithNoCase(command, "echo ")) {
 		// Extract the text after "echo "
 		// substr(5) gets everything from index 5 to the end
 		std::string echoText = command.substr(5);
@@ -394,7 +573,7 @@ void ConsoleInputHandler::ProcessCommand(const std::string& command) {
 		std::cout << "Echo: " << echoText << std::endl;
 	}
 	// Check for empty command
-	else if (lowerCommand.empty()) {
+	else if (command.empty()) {
 		// Empty command, do nothing
 		// Just return without printing anything
 		return;
@@ -488,25 +667,29 @@ void ConsoleInputHandler::ListCommands() {
 void ConsoleInputHandler::ShowStatus() {
 	auto app = app::App::GetInstance();
 	if (!app) {
-		std::cout << "\n[ERROR] Application instance not available!\n" << std::endl;
+		std::cout << "\n[ERROR] Application instance not available!\n" << '\n';
 		return;
 	}
 
-	std::cout << "\n" << std::string(60, '=') << std::endl;
-	std::cout << "           APPLICATION STATUS REPORT" << std::endl;
-	std::cout << std::string(60, '=') << std::endl;
+	std::cout << "\n" << std::string(60, '=') << '\n';
+	std::cout << "           APPLICATION STATUS REPORT" << '\n';
+	std::cout << std::string(60, '=') << '\n';
 
 	// Console Input Handler Status
-	std::cout << "\n[CONSOLE INPUT HANDLER]" << std::endl;
-	std::cout << "  Status: " << (m_bIsRunning ? "\033[32mRunning\033[0m" : "\033[31mStopped\033[0m") << std::endl;
-	std::cout << "  Commands in Queue: " << m_commandQueue.size() << std::endl;
-	std::cout << "  Input Thread: " << (m_inputThread.joinable() ? "Active" : "Inactive") << std::endl;
+	std::cout << "\n[CONSOLE INPUT HANDLER]" << '\n';
+	std::cout << "  Status: " << (m_reader->isRunning ? "\033[32mRunning\033[0m" : "\033[31mStopped\033[0m") << '\n';
+	std::cout << "  Commands in Queue: " << m_reader->commandRing.SizeApprox() << "/"
+			  << CommandRing::GetCapacity() << '\n';
+	std::cout << "  Commands Processed: " << m_commandsProcessed << '\n';
+	std::cout << "  Input Latency (last/max): " << std::fixed << std::setprecision(1)
+			  << m_lastLatencyUs << " / " << m_maxLatencyUs << " us" << '\n';
+	std::cout << "  Input Thread: " << (m_inputThread.joinable() ? "Active" : "Inactive") << '\n';
 
 	// DirectX 12 Renderer Status
-	std::cout << "\n[DIRECTX 12 RENDERER]" << std::endl;
+	std::cout << "\n[DIRECTX 12 RENDERER]" << '\n';
 	auto renderer = app->GetRenderer();
 	if (renderer && renderer->GetDevice()) {
-		std::cout << "  Device: \033[32mInitialized\033[0m" << std::endl;
+		std::cout << "  Device: \033[32mInitialized\033[0m" << '\n';
 		
 		// Get adapter information
 		ComPtr<IDXGIFactory4> factory;
@@ -518,14 +701,16 @@ void ConsoleInputHandler::ShowStatus() {
 				
 				// Convert wide string to string for console output
 				std::wstring wAdapterName(desc.Description);
-				std::wcout << "  GPU: " << wAdapterName << std::endl;
+				// wcout has its own buffer - flush both sides to keep the lines in order
+				std::cout << std::flush;
+				std::wcout << "  GPU: " << wAdapterName << L'\n' << std::flush;
 				
 				// Video Memory
-				std::cout << "  Dedicated Video Memory: " << (desc.DedicatedVideoMemory / (1024 * 1024)) << " MB" << std::endl;
-				std::cout << "  Dedicated System Memory: " << (desc.DedicatedSystemMemory / (1024 * 1024)) << " MB" << std::endl;
-				std::cout << "  Shared System Memory: " << (desc.SharedSystemMemory / (1024 * 1024)) << " MB" << std::endl;
-				std::cout << "  Vendor ID: 0x" << std::hex << std::uppercase << desc.VendorId << std::dec << std::endl;
-				std::cout << "  Device ID: 0x" << std::hex << std::uppercase << desc.DeviceId << std::dec << std::endl;
+				std::cout << "  Dedicated Video Memory: " << (desc.DedicatedVideoMemory / (1024 * 1024)) << " MB" << '\n';
+				std::cout << "  Dedicated System Memory: " << (desc.DedicatedSystemMemory / (1024 * 1024)) << " MB" << '\n';
+				std::cout << "  Shared System Memory: " << (desc.SharedSystemMemory / (1024 * 1024)) << " MB" << '\n';
+				std::cout << "  Vendor ID: 0x" << std::hex << std::uppercase << desc.VendorId << std::dec << '\n';
+				std::cout << "  Device ID: 0x" << std::hex << std::uppercase << desc.DeviceId << std::dec << '\n';
 			}
 		}
 		
@@ -534,32 +719,32 @@ void ConsoleInputHandler::ShowStatus() {
 			DXGI_SWAP_CHAIN_DESC1 swapChainDesc;
 			renderer->GetSwapChain()->GetDesc1(&swapChainDesc);
 			
-			std::cout << "  Swap Chain Format: " << swapChainDesc.Format << std::endl;
-			std::cout << "  Swap Chain Buffers: " << swapChainDesc.BufferCount << std::endl;
-			std::cout << "  Swap Chain Size: " << swapChainDesc.Width << "x" << swapChainDesc.Height << std::endl;
-			std::cout << "  Tearing Support: " << (renderer->GetSwapChainTearingSupport() ? "Yes" : "No") << std::endl;
-			std::cout << "  Occluded: " << (renderer->GetSwapChainOccluded() ? "Yes" : "No") << std::endl;
+			std::cout << "  Swap Chain Format: " << swapChainDesc.Format << '\n';
+			std::cout << "  Swap Chain Buffers: " << swapChainDesc.BufferCount << '\n';
+			std::cout << "  Swap Chain Size: " << swapChainDesc.Width << "x" << swapChainDesc.Height << '\n';
+			std::cout << "  Tearing Support: " << (renderer->GetSwapChainTearingSupport() ? "Yes" : "No") << '\n';
+			std::cout << "  Occluded: " << (renderer->GetSwapChainOccluded() ? "Yes" : "No") << '\n';
 		}
 		
 		// Frame sync info
-		std::cout << "  Frame Index: " << renderer->GetFrameIndex() << std::endl;
-		std::cout << "  Fence Value: " << renderer->GetFenceLastSignaledValue() << std::endl;
+		std::cout << "  Frame Index: " << renderer->GetFrameIndex() << '\n';
+		std::cout << "  Fence Value: " << renderer->GetFenceLastSignaledValue() << '\n';
 		
 		// Command Queue
 		if (renderer->GetCommandQueue()) {
-			std::cout << "  Command Queue: \033[32mActive\033[0m" << std::endl;
+			std::cout << "  Command Queue: \033[32mActive\033[0m" << '\n';
 		}
 		
 		// Command List
 		if (renderer->GetCommandList()) {
-			std::cout << "  Command List: \033[32mActive\033[0m" << std::endl;
+			std::cout << "  Command List: \033[32mActive\033[0m" << '\n';
 		}
 		
 		// Descriptor Heaps
 		if (renderer->GetSrvDescHeap()) {
 			D3D12_DESCRIPTOR_HEAP_DESC heapDesc = renderer->GetSrvDescHeap()->GetDesc();
-			std::cout << "  SRV Heap Descriptors: " << heapDesc.NumDescriptors << std::endl;
-			std::cout << "  SRV Heap Type: " << heapDesc.Type << std::endl;
+			std::cout << "  SRV Heap Descriptors: " << heapDesc.NumDescriptors << '\n';
+			std::cout << "  SRV Heap Type: " << heapDesc.Type << '\n';
 		}
 		
 		// Render Targets
@@ -569,60 +754,83 @@ void ConsoleInputHandler::ShowStatus() {
 				validRenderTargets++;
 			}
 		}
-		std::cout << "  Render Targets: " << validRenderTargets << "/" << APP_NUM_BACK_BUFFERS << std::endl;
+		std::cout << "  Render Targets: " << validRenderTargets << "/" << APP_NUM_BACK_BUFFERS << '\n';
 		
 	} else {
-		std::cout << "  Device: \033[31mNot Initialized\033[0m" << std::endl;
+		std::cout << "  Device: \033[31mNot Initialized\033[0m" << '\n';
 	}
 
 	// ImGui Status
-	std::cout << "\n[IMGUI CONTEXT]" << std::endl;
+	std::cout << "\n[IMGUI CONTEXT]" << '\n';
 	if (ImGui::GetCurrentContext()) {
 		ImGuiIO& io = ImGui::GetIO();
-		std::cout << "  Context: \033[32mInitialized\033[0m" << std::endl;
-		std::cout << "  Frame Count: " << ImGui::GetFrameCount() << std::endl;
-		std::cout << "  FPS: " << std::fixed << std::setprecision(1) << io.Framerate << std::endl;
-		std::cout << "  Delta Time: " << std::fixed << std::setprecision(4) << io.DeltaTime << "s" << std::endl;
-		std::cout << "  Display Size: " << (int)io.DisplaySize.x << "x" << (int)io.DisplaySize.y << std::endl;
-		std::cout << "  Mouse Position: (" << (int)io.MousePos.x << ", " << (int)io.MousePos.y << ")" << std::endl;
-		std::cout << "  Config Flags: 0x" << std::hex << io.ConfigFlags << std::dec << std::endl;
-		std::cout << "  Backend Platform: " << (io.BackendPlatformName ? io.BackendPlatformName : "None") << std::endl;
-		std::cout << "  Backend Renderer: " << (io.BackendRendererName ? io.BackendRendererName : "None") << std::endl;
-		std::cout << "  Fonts Loaded: " << io.Fonts->Fonts.Size << std::endl;
+		std::cout << "  Context: \033[32mInitialized\033[0m" << '\n';
+		std::cout << "  Frame Count: " << ImGui::GetFrameCount() << '\n';
+		std::cout << "  FPS: " << std::fixed << std::setprecision(1) << io.Framerate << '\n';
+		std::cout << "  Delta Time: " << std::fixed << std::setprecision(4) << io.DeltaTime << "s" << '\n';
+		std::cout << "  Display Size: " << (int)io.DisplaySize.x << "x" << (int)io.DisplaySize.y << '\n';
+		std::cout << "  Mouse Position: (" << (int)io.MousePos.x << ", " << (int)io.MousePos.y << ")" << '\n';
+		std::cout << "  Config Flags: 0x" << std::hex << io.ConfigFlags << std::dec << '\n';
+		std::cout << "  Backend Platform: " << (io.BackendPlatformName ? io.BackendPlatformName : "None") << '\n';
+		std::cout << "  Backend Renderer: " << (io.BackendRendererName ? io.BackendRendererName : "None") << '\n';
+		std::cout << "  Fonts Loaded: " << io.Fonts->Fonts.Size << '\n';
 	} else {
-		std::cout << "  Context: \033[31mNot Initialized\033[0m" << std::endl;
+		std::cout << "  Context: \033[31mNot Initialized\033[0m" << '\n';
 	}
 
 	// ImPlot Status
-	std::cout << "\n[IMPLOT CONTEXT]" << std::endl;
+	std::cout << "\n[IMPLOT CONTEXT]" << '\n';
+#if APP_FEATURE_IMPLOT
 	if (ImPlot::GetCurrentContext()) {
-		std::cout << "  Context: \033[32mInitialized\033[0m" << std::endl;
+		std::cout << "  Context: \033[32mInitialized\033[0m" << '\n';
 	} else {
-		std::cout << "  Context: \033[31mNot Initialized\033[0m" << std::endl;
+		std::cout << "  Context: \033[31mNot Initialized\033[0m" << '\n';
 	}
+#else
+	std::cout << "  Context: Not compiled in" << '\n';
+#endif
 
 	// Memory Info
-	std::cout << "\n[MEMORY STATUS]" << std::endl;
+	std::cout << "\n[MEMORY STATUS]" << '\n';
 	MEMORYSTATUSEX memInfo;
 	memInfo.dwLength = sizeof(MEMORYSTATUSEX);
 	if (GlobalMemoryStatusEx(&memInfo)) {
-		std::cout << "  Physical Memory Usage: " << memInfo.dwMemoryLoad << "%" << std::endl;
-		std::cout << "  Total Physical: " << (memInfo.ullTotalPhys / (1024 * 1024)) << " MB" << std::endl;
-		std::cout << "  Available Physical: " << (memInfo.ullAvailPhys / (1024 * 1024)) << " MB" << std::endl;
-		std::cout << "  Total Virtual: " << (memInfo.ullTotalVirtual / (1024 * 1024)) << " MB" << std::endl;
-		std::cout << "  Available Virtual: " << (memInfo.ullAvailVirtual / (1024 * 1024)) << " MB" << std::endl;
+		std::cout << "  Physical Memory Usage: " << memInfo.dwMemoryLoad << "%" << '\n';
+		std::cout << "  Total Physical: " << (memInfo.ullTotalPhys / (1024 * 1024)) << " MB" << '\n';
+		std::cout << "  Available Physical: " << (memInfo.ullAvailPhys / (1024 * 1024)) << " MB" << '\n';
+		std::cout << "  Total Virtual: " << (memInfo.ullTotalVirtual / (1024 * 1024)) << " MB" << '\n';
+		std::cout << "  Available Virtual: " << (memInfo.ullAvailVirtual / (1024 * 1024)) << " MB" << '\n';
 	}
 
 	// Process Memory
 	PROCESS_MEMORY_COUNTERS_EX pmc;
 	if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc, sizeof(pmc))) {
-		std::cout << "  Process Working Set: " << (pmc.WorkingSetSize / (1024 * 1024)) << " MB" << std::endl;
-		std::cout << "  Process Private Bytes: " << (pmc.PrivateUsage / (1024 * 1024)) << " MB" << std::endl;
-		std::cout << "  Page Fault Count: " << pmc.PageFaultCount << std::endl;
+		std::cout << "  Process Working Set: " << (pmc.WorkingSetSize / (1024 * 1024)) << " MB" << '\n';
+		std::cout << "  Process Private Bytes: " << (pmc.PrivateUsage / (1024 * 1024)) << " MB" << '\n';
+		std::cout << "  Page Fault Count: " << pmc.PageFaultCount << '\n';
+	}
+
+#if APP_MEMORY_TAGS
+	// ImGui allocator by subsystem, largest first
+	if (PoolAllocator::IsInstalled()) {
+		const PoolAllocator::Snapshot snapshot = PoolAllocator::GetSnapshot();
+		const SizeClassPool::Stats&	  stats	   = snapshot.totals;
+		std::cout << "\n[MEMORY BY SUBSYSTEM]" << '\n';
+
+		uint32_t order[kMemTagCount];
+		for (uint32_t i = 0; i < kMemTagCount; i++) order[i] = i;
+		std::sort(order, order + kMemTagCount,
+				  [&stats](uint32_t a, uint32_t b) { return stats.tagBytes[a] > stats.tagBytes[b]; });
+		for (uint32_t i : order) {
+			std::cout << "  " << std::left << std::setw(14) << MemTagName(MemTag(i)) << std::right << std::fixed
+					  << std::setprecision(1) << std::setw(10) << stats.tagBytes[i] / 1024.0 << " KiB in "
+					  << stats.tagBlocks[i] << " blocks" << '\n';
+		}
 	}
+#endif
 
 	// System Time
-	std::cout << "\n[SYSTEM INFORMATION]" << std::endl;
+	std::cout << "\n[SYSTEM INFORMATION]" << '\n';
 	auto now = std::chrono::system_clock::now();
 	auto time = std::chrono::system_clock::to_time_t(now);
 	std::cout << "  Current Time: " << std::ctime(&time);
@@ -630,15 +838,18 @@ void ConsoleInputHandler::ShowStatus() {
 	// CPU Info
 	SYSTEM_INFO sysInfo;
 	GetSystemInfo(&sysInfo);
-	std::cout << "  Processor Count: " << sysInfo.dwNumberOfProcessors << std::endl;
-	std::cout << "  Page Size: " << (sysInfo.dwPageSize / 1024) << " KB" << std::endl;
+	std::cout << "  Processor Count: " << sysInfo.dwNumberOfProcessors << '\n';
+	std::cout << "  Page Size: " << (sysInfo.dwPageSize / 1024) << " KB" << '\n';
 
 	// Thread Count
-	std::cout << "  Hardware Concurrency: " << std::thread::hardware_concurrency() << std::endl;
+	std::cout << "  Hardware Concurrency: " << std::thread::hardware_concurrency() << '\n';
+
+	std::cout << "\n" << std::string(60, '=') << '\n';
+	std::cout << "           END OF STATUS REPORT" << '\n';
+	std::cout << std::string(60, '=') << "\n" << '\n';
 
-	std::cout << "\n" << std::string(60, '=') << std::endl;
-	std::cout << "           END OF STATUS REPORT" << std::endl;
-	std::cout << std::string(60, '=') << "\n" << std::endl;
+	// Single flush for the whole report instead of one per line
+	std::cout << std::flush;
 }
 
 /**
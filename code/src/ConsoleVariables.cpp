@@ -0,0 +1,271 @@
+// ConsoleVariables.cpp
+// Implementation of the console variable types and their registry
+
+#include "PCH.hpp"
+#include "ConsoleVariables.hpp"
+
+namespace app {
+
+using utf::EqualsNoCase; // Option names and boolean keywords
+
+// ============================================================================
+// CVar
+// ============================================================================
+
+CVar::CVar(const char* name, const char* description, CVarType type, uint32_t flags) :
+m_name(name),
+m_description(description),
+m_type(type),
+m_flags(flags),
+m_modCount(0) {}
+
+const char* CVar::GetTypeName() const {
+	switch (m_type) {
+		case CVarType::Bool: return "bool";
+		case CVarType::Int: return "int";
+		case CVarType::Float: return "float";
+		case CVarType::Enum: return "enum";
+		case CVarType::String: return "string";
+	}
+	return "?";
+}
+
+// ============================================================================
+// CVarBool
+// ============================================================================
+
+CVarBool::CVarBool(const char* name, bool defaultValue, const char* description, uint32_t flags) :
+CVar(name, description, CVarType::Bool, flags),
+m_value(defaultValue),
+m_default(defaultValue) {
+	CVarRegistry::Get_CVarRegistry_Singleton()->Register(this);
+}
+
+CVarBool::~CVarBool() { CVarRegistry::Get_CVarRegistry_Singleton()->Unregister(this); }
+
+void CVarBool::Set(bool value) {
+	m_value.store(value, std::memory_order_relaxed);
+	MarkModified();
+}
+
+bool CVarBool::FromString(std::string_view value) {
+	if (EqualsNoCase(value, "true") || EqualsNoCase(value, "on") || EqualsNoCase(value, "yes") ||
+		value == "1") {
+		Set(true);
+		return true;
+	}
+	if (EqualsNoCase(value, "false") || EqualsNoCase(value, "off") || EqualsNoCase(value, "no") ||
+		value == "0") {
+		Set(false);
+		return true;
+	}
+	return false;
+}
+
+std::string CVarBool::ToString() const { return Get() ? "on" : "off"; }
+
+std::string CVarBool::DefaultToString() const { return m_default ? "on" : "off"; }
+
+// ============================================================================
+// CVarEnum
+// ============================================================================
+
+CVarEnum::CVarEnum(const char* name, std::initializer_list<const char*> options,
+				   int32_t defaultIndex, const char* description, uint32_t flags) :
+CVar(name, description, CVarType::Enum, flags),
+m_options(options),
+m_index(0),
+m_default(0) {
+	IM_ASSERT(!m_options.empty());
+	m_default = std::clamp(defaultIndex, 0, static_cast<int32_t>(m_options.size()) - 1);
+	m_index.store(m_default, std::memory_order_relaxed);
+	CVarRegistry::Get_CVarRegistry_Singleton()->Register(this);
+}
+
+CVarEnum::~CVarEnum() { CVarRegistry::Get_CVarRegistry_Singleton()->Unregister(this); }
+
+void CVarEnum::Set(int32_t index) {
+	if (index < 0 || index >= static_cast<int32_t>(m_options.size())) return;
+	m_index.store(index, std::memory_order_relaxed);
+	MarkModified();
+}
+
+bool CVarEnum::FromString(std::string_view value) {
+	// Accept the option name first...
+	for (size_t i = 0; i < m_options.size(); i++) {
+		if (EqualsNoCase(value, m_options[i])) {
+			Set(static_cast<int32_t>(i));
+			return true;
+		}
+	}
+
+	// ...then a plain index
+	int32_t index  = -1;
+	auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), index);
+	if (ec != std::errc() || ptr != value.data() + value.size()) return false;
+	if (index < 0 || index >= static_cast<int32_t>(m_options.size())) return false;
+	Set(index);
+	return true;
+}
+
+std::string CVarEnum::ToString() const { return GetOptionName(); }
+
+std::string CVarEnum::DefaultToString() const {
+	return m_options[static_cast<size_t>(m_default)];
+}
+
+std::string CVarEnum::DescribeDomain() const {
+	std::string domain;
+	for (size_t i = 0; i < m_options.size(); i++) {
+		if (i > 0) domain += '|';
+		domain += m_options[i];
+	}
+	return domain;
+}
+
+// ============================================================================
+// CVarString
+// ============================================================================
+
+CVarString::CVarString(const char* name, const char* defaultValue, const char* description,
+					   uint32_t flags) :
+CVar(name, description, CVarType::String, flags),
+m_mutex(),
+m_value(defaultValue),
+m_default(defaultValue) {
+	CVarRegistry::Get_CVarRegistry_Singleton()->Register(this);
+}
+
+CVarString::~CVarString() { CVarRegistry::Get_CVarRegistry_Singleton()->Unregister(this); }
+
+std::string CVarString::Get() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_value;
+}
+
+void CVarString::Set(std::string_view value) {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_value.assign(value);
+	}
+	MarkModified();
+}
+
+bool CVarString::FromString(std::string_view value) {
+	Set(value);
+	return true;
+}
+
+// ============================================================================
+// CVarRegistry
+// ============================================================================
+
+/**
+ * @brief Returns the registry instance
+ *
+ * Function-local static so that console variables defined as globals in any
+ * translation unit can register during static initialisation.
+ */
+CVarRegistry* CVarRegistry::Get_CVarRegistry_Singleton() {
+	static CVarRegistry instance;
+	return &instance;
+}
+
+void CVarRegistry::Register(CVar* cvar) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	IM_ASSERT(m_cvars.find(cvar->GetName()) == m_cvars.end() && "Duplicate console variable");
+	m_cvars[cvar->GetName()] = cvar;
+
+	// Apply a value that was loaded from disk before this variable existed
+	auto pending = m_pending.find(cvar->GetName());
+	if (pending != m_pending.end()) {
+		cvar->FromString(pending->second);
+		m_pending.erase(pending);
+	}
+}
+
+void CVarRegistry::Unregister(CVar* cvar) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_cvars.find(cvar->GetName());
+	if (it == m_cvars.end() || it->second != cvar) return;
+
+	// Keep the value around so it survives a save while the owner is gone
+	if (cvar->GetFlags() & CVarFlags_Archive) m_pending[it->first] = cvar->ToString();
+	m_cvars.erase(it);
+}
+
+CVar* CVarRegistry::Find(std::string_view name) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_cvars.find(name);
+	return it != m_cvars.end() ? it->second : nullptr;
+}
+
+void CVarRegistry::LoadArchived(const std::map<std::string, std::string>& values) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	for (const auto& [name, value] : values) {
+		auto it = m_cvars.find(name);
+		if (it == m_cvars.end()) {
+			m_pending[name] = value;
+			continue;
+		}
+		if (it->second->GetFlags() & CVarFlags_Archive) it->second->FromString(value);
+	}
+}
+
+std::map<std::string, std::string> CVarRegistry::SaveArchived() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::map<std::string, std::string> values(m_pending.begin(), m_pending.end());
+	for (const auto& [name, cvar] : m_cvars) {
+		if (cvar->GetFlags() & CVarFlags_Archive) values[name] = cvar->ToString();
+	}
+	return values;
+}
+
+// ============================================================================
+// Shared application knobs
+// ============================================================================
+
+namespace cvars {
+
+CVarInt FrameCap("frame_cap", 0, 0, 1000, "Maximum frames per second (0 = unlimited)");
+
+CVarEnum PresentMode("present_mode", {"immediate", "vsync", "half_vsync"}, 1,
+					 "Swap chain sync interval used by Present()");
+
+CVarFloat FontSize("font_size", 16.0f, 6.0f, 72.0f, "Base font size in pixels");
+
+CVarInt LogCapacity("log_capacity", 5000, 100, 1000000,
+					"Maximum number of lines kept in the console window");
+
+CVarInt LogFlushMs("log_flush_ms", 1000, 10, 60000, "Milliseconds between console log file flushes");
+
+CVarInt PanelReleaseSeconds("panel_release_s", 60, 0, 3600,
+							"Seconds a closed tool window is kept before it is freed (0 = keep)");
+
+CVarInt JobWorkers("job_workers", 0, 0, 64,
+				   "Job system worker threads, read at startup (0 = one per core but the main thread)");
+
+CVarBool ConsoleAutoScroll("autoscroll", true, "Scroll the console to new output");
+
+CVarBool ConsoleFileLogging("logging", true, "Mirror console output to the log file");
+
+CVarString ConsoleLogFile("log_file", "console_log.txt", "Path of the console log file");
+
+CVarString ControlEndpoint("control_endpoint", "",
+						   "Named pipe / socket for remote console commands (empty = off)");
+
+CVarInt ConsoleQueueKb("console_queue_kb", 1024, 16, 65536,
+					   "KiB of output queued for the native console before console_overflow applies");
+
+// Order matches AsyncConsoleWriter::Overflow
+CVarEnum ConsoleOverflow("console_overflow", {"drop", "merge", "block"}, 1,
+						 "Full native console queue: drop new lines, merge repeats, or block");
+
+} // namespace cvars
+
+} // namespace app
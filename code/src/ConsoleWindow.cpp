@@ -17,9 +17,89 @@
 #include "PCH.hpp"
 #include "Classes.hpp"
 #include "ConsoleWindow.hpp"
+#include "ImGuiTermcolor.hpp"
 
 namespace app {
 
+/**
+ * @brief About 64 KiB of console-like UTF-8 for the transcoding benchmarks
+ *
+ * Mostly ASCII log lines mixed with the accents, CJK, box drawing and emoji the
+ * console prints.
+ */
+static std::string MakeTranscodeCorpus() {
+	static const char* const lines[] = {
+		"[info] frame 1024 took 16.667 ms (60 fps)\n",
+		"[warning] ⚠️ swap chain resized to 1920x1080\n",
+		"[success] ✅ Loaded font 'Consolas' at 16 px\n",
+		"[info] bench line 4096 done in 0.125 us\n",
+		"[history] 📌  12: set console_overflow merge\n",
+		"[info] Café, naïve, Ünïcödé, 日本語, Ελληνικά\n",
+		"[grey] ├── textures/ui/atlas_0.png  256 KiB\n",
+		"[error] ❌ Unknown command 'hlep' - type HELP\n",
+	};
+
+	std::string corpus;
+	for (size_t i = 0; corpus.size() < 64 * 1024; i++) corpus += lines[i % std::size(lines)];
+	return corpus;
+}
+
+/**
+ * @brief Length of s capped at n units, never reading past the terminator or n
+ */
+template <typename Char>
+static size_t BoundedLength(const Char* s, int n) {
+	size_t len = 0;
+	while ((int)len < n && s[len]) len++;
+	return len;
+}
+
+// Command types - using variant for type-safe command representation
+struct SimpleCommand {
+	std::function<void(ConsoleWindow*)> handler;
+};
+
+struct ParameterizedCommand {
+	std::function<void(ConsoleWindow*, const std::string&)> handler;
+};
+
+using CommandVariant = std::variant<SimpleCommand, ParameterizedCommand>;
+
+/**
+ * @brief Command dispatch table using variant for extensibility and type safety.
+ *
+ *
+ * Shared by ExecMyCommand() and the 'bench' command, which can time any entry.
+ */
+using CommandTable = std::unordered_map<std::string, CommandVariant, utf::NoCaseHash, utf::NoCaseEqual>;
+
+static const CommandTable& GetCommandHandlers() {
+	static const CommandTable commandHandlers = {
+		// Simple commands (no arguments)
+		{"exit", SimpleCommand{&ConsoleWindow::CommandExit}},
+		{"quit", SimpleCommand{&ConsoleWindow::CommandQuit}},
+		{"demo", SimpleCommand{&ConsoleWindow::CommandDemo}},
+		{"show", SimpleCommand{&ConsoleWindow::CommandShowCmd}},
+		{"hide", SimpleCommand{&ConsoleWindow::CommandHideCmd}},
+		{"commands", SimpleCommand{&ConsoleWindow::CommandList}},
+		{"clear", SimpleCommand{&ConsoleWindow::CommandClear}},
+		{"cls", SimpleCommand{&ConsoleWindow::CommandClear}},
+		{"help", SimpleCommand{&ConsoleWindow::CommandHelp}},
+		{"history", SimpleCommand{&ConsoleWindow::CommandHistory}},
+		{"status", SimpleCommand{&ConsoleWindow::CommandStatus}},
+		{"break", SimpleCommand{&ConsoleWindow::CommandBreak}},
+		{"fonts", SimpleCommand{&ConsoleWindow::CommandFonts}},
+		{"sizes", SimpleCommand{&ConsoleWindow::CommandSizes}},
+
+		// Parameterized commands (with arguments)
+		{"echo", ParameterizedCommand{&ConsoleWindow::CommandEcho}},
+		{"set", ParameterizedCommand{&ConsoleWindow::CommandSet}},
+		{"log", ParameterizedCommand{&ConsoleWindow::CommandLog}},
+		{"bench", ParameterizedCommand{&ConsoleWindow::CommandBench}},
+		{"activate", ParameterizedCommand{&ConsoleWindow::CommandActivate}}};
+	return commandHandlers;
+}
+
 /**
  * @brief Default constructor for ConsoleWindow.
  *
@@ -35,29 +115,36 @@ Commands(),
 History(),
 HistoryPos(),
 Filter(),
-AutoScroll(),
 ScrollToBottom(),
 m_MyCommmands{},
 m_LastDebugLogPos(),
 m_bEnableFileLogging(),
 m_logFile(),
 m_logFilePath(),
+m_logFileCVarVersion(0),
+m_bench(),
+m_benchNotes(),
+m_pCapture(nullptr),
+m_ansi(),
+m_tagColor(0),
+m_itemText(),
+m_itemSpans(),
+m_plainText(),
 m_memory(nullptr),
 m_cmd(nullptr),
 m_cmdArgs(nullptr),
 m_window(nullptr),
 m_font_manager(nullptr),
-m_font_manager_window(nullptr),
-m_debug_window(nullptr),
 m_configManager(nullptr),
-m_window_obj(nullptr),
 m_App(nullptr),
 m_ConsoleInputHandler(nullptr),
 m_ConfigManager(nullptr),
 m_StyleManager(nullptr),
 m_DxDemos(nullptr),
 m_DX12Renderer(nullptr),
-m_FrameContext(nullptr)
+m_FrameContext(nullptr),
+m_ControlServer(nullptr),
+m_frameArena(nullptr)
 
 {}
 
@@ -70,11 +157,8 @@ m_FrameContext(nullptr)
  * safety.
  */
 ConsoleWindow::~ConsoleWindow() {
+	EventBus::Get_EventBus_Singleton()->Unsubscribe(this);
 	ClearLog();
-	for (int i = 0; i < History.Size; i++) ImGui::MemFree(History[i]);
-	for (int i = 0; i < Commands.Size; i++) {
-		if (Commands[i]) ImGui::MemFree((void*)Commands[i]);
-	}
 
 	// Close log file
 	if (m_logFile.is_open()) {
@@ -86,53 +170,36 @@ ConsoleWindow::~ConsoleWindow() {
 	m_cmdArgs			  = nullptr;
 	m_configManager		  = nullptr;
 	m_font_manager		  = nullptr;
-	m_font_manager_window = nullptr;
-	m_debug_window		  = nullptr;
 	m_window			  = nullptr;
-	m_window_obj		  = nullptr;
 	m_App				  = nullptr;
 	m_ConsoleInputHandler = nullptr;
+	m_ControlServer		  = nullptr;
 	m_ConfigManager		  = nullptr;
 	m_StyleManager		  = nullptr;
 	m_DX12Renderer		  = nullptr;
 }
 
 /**
- * @brief Allocates and retrieves all required dependencies from MemoryManagement.
+ * @brief Retrieves all required dependencies from MemoryManagement.
  *
+ * Caches pointers to all necessary subsystems (OutputConsole, ConfigManager,
+ * FontManager, etc.) so the per-frame code does not look them up again.
  *
- * Retrieves pointers to all necessary subsystems (OutputConsole, ConfigManager,
- * FontManager,
- * etc.) from the MemoryManagement singleton. If any required object
- * is not available, logs an
- * error and returns E_FAIL.
- *
- * @return S_OK on success, E_FAIL if any dependency cannot be
- * allocated.
- * @throws std::runtime_error if a required object is not found in MemoryManagement.
-
+ * @return S_OK
  */
 HRESULT ConsoleWindow::Alloc() {
-	// Retrieve all required objects from MemoryManagement singleton
-	try {
-		m_cmd				  = m_memory->Get_OutputConsole();
-		m_cmdArgs			  = m_memory->Get_CommandLineArguments();
-		m_configManager		  = m_memory->Get_ConfigManager();
-		m_font_manager		  = m_memory->Get_FontManager();
-		m_font_manager_window = m_memory->Get_FontManagerWindow();
-		m_debug_window		  = m_memory->Get_DebugWindow();
-		m_window			  = m_memory->Get_WindowManager();
-		m_window_obj		  = m_memory->Get_WindowClass();
-		m_App				  = m_memory->Get_App();
-		m_ConsoleInputHandler = m_memory->Get_ConsoleInputHandler();
-		m_ConfigManager		  = m_memory->Get_ConfigManager();
-		m_StyleManager		  = m_memory->Get_StyleManager();
-		m_DX12Renderer		  = m_memory->Get_DX12Renderer();
-	} catch (const std::runtime_error& e) {
-		// Log error if any object is not allocated
-		AddLog("[error] ❌ Failed to allocate ConsoleWindow dependencies: %s\n", e.what());
-		return E_FAIL;
-	}
+	m_cmd				  = m_memory->Get<OutputConsole>();
+	m_cmdArgs			  = m_memory->Get<CommandLineArguments>();
+	m_configManager		  = m_memory->Get<ConfigManager>();
+	m_font_manager		  = m_memory->Get<FontManager>();
+	m_window			  = m_memory->Get<WindowManager>();
+	m_App				  = m_memory->Get<App>();
+	m_ConsoleInputHandler = m_memory->Get<ConsoleInputHandler>();
+	m_ControlServer		  = m_memory->Get<ControlServer>();
+	m_ConfigManager		  = m_memory->Get<ConfigManager>();
+	m_StyleManager		  = m_memory->Get<StyleManager>();
+	m_DX12Renderer		  = m_memory->Get<DX12Renderer>();
+	m_frameArena		  = m_memory->Get<FrameArena>();
 
 	return S_OK;
 }
@@ -159,15 +226,13 @@ void ConsoleWindow::Start() {
 	memset(InputBuf, 0, sizeof(InputBuf));
 	HistoryPos = -1;
 
-	// Initialize file logging
-	EnableFileLogging(true);
+	// Initialize file logging from the 'log_file' / 'logging' cvars
+	m_logFilePath		 = utf::ToWide(cvars::ConsoleLogFile.Get());
+	m_logFileCVarVersion = cvars::ConsoleLogFile.GetModificationCount();
+	EnableFileLogging(cvars::ConsoleFileLogging.Get());
 
-	// Built-in commands for tab completion - convert to ImWchar
-	auto AddCommand = [this](const char* cmd) {
-		ImWchar wcmd[64];
-		ImTextStrFromUtf8(wcmd, IM_ARRAYSIZE(wcmd), cmd, nullptr);
-		Commands.push_back(Wcsdup(wcmd));
-	};
+	// Built-in commands for tab completion - interned, so completion never copies them
+	auto AddCommand = [this](const char* cmd) { Commands.push_back(StrId(cmd)); };
 
 	AddCommand("HELP");
 	AddCommand("HISTORY");
@@ -184,8 +249,9 @@ void ConsoleWindow::Start() {
 	AddCommand("HIDE");
 	AddCommand("BREAK");
 	AddCommand("FONTS");
+	AddCommand("BENCH");
+	AddCommand("ACTIVATE");
 
-	AutoScroll	   = true;
 	ScrollToBottom = false;
 	AddLog("[success] ✨ Welcome to Dear ImGui Console! 🎮\n");
 	AddLog("[info] 📋 Type 'help' or 'commands' to get started.\n");
@@ -206,38 +272,31 @@ void ConsoleWindow::Start() {
 void ConsoleWindow::Open() {
 	Start();
 	Alloc();
+	RegisterBenchTargets();
 
-	// Helper to convert UTF-8 string to wstring
-	auto Utf8ToWstring = [](const std::string& str) -> std::wstring {
-		if (str.empty()) return std::wstring();
-		int size_needed = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), (int)str.size(), nullptr, 0);
-		std::wstring wstr(size_needed, 0);
-		MultiByteToWideChar(CP_UTF8, 0, str.c_str(), (int)str.size(), &wstr[0], size_needed);
-		return wstr;
-	};
+	EventBus::Get_EventBus_Singleton()->Subscribe<ConfigChanged, &ConsoleWindow::OnConfigChanged>(this);
 
 	std::vector<std::wstring> Commands{L"exit",		L"quit",   L"show", L"hide",	L"demo",
 									   L"commands", L"status", L"HELP", L"HISTORY", L"CLEAR",
-									   L"echo",		L"set",	   L"log",	L"break",	L"fonts"};
+									   L"echo",		L"set",	   L"log",	L"break",	L"fonts",
+									   L"bench",	L"activate", L"sizes"};
 	std::sort(Commands.begin(), Commands.end());
 
 	for (uint64_t i = 0; i < Commands.size(); i++) {
-		// Convert to lowercase for storage
-		std::wstring lower_cmd = Commands.at(i);
-		std::transform(lower_cmd.begin(), lower_cmd.end(), lower_cmd.begin(), ::towlower);
-		m_MyCommmands.insert(std::make_pair(lower_cmd, i));
+		// Stored folded so the map is ordered and keyed case-insensitively
+		utf::FoldCase(Commands[i]);
+		m_MyCommmands.insert(std::make_pair(std::move(Commands[i]), i));
 	}
 }
 
 /**
  * @brief Per-frame update method for the console window.
  *
- * Called every frame to:
- * -
- * Update debug logs from ImGui context
- * - Track new log entries for auto-scroll behavior
- * -
- * Periodically flush the log file to ensure data persistence
+ * Called every frame, inside the ImGui frame, to update debug logs from the
+ * ImGui context.
+ *
+ * The log file is flushed on its own schedule, see FlushLogFile(), and the
+ * logging cvars are applied when they are set, see OnConfigChanged().
  *
  * @note This is an override of the
  * Master class virtual method.
@@ -245,21 +304,25 @@ void ConsoleWindow::Open() {
 void ConsoleWindow::Tick() {
 	// Update debug logs from ImGui context (capture logs every frame)
 	UpdateDebugLog();
+}
 
-	// Track new log entries for auto-scroll
-	static int last_item_count = 0;
-	if (Items.Size > last_item_count) {
-		if (AutoScroll) { ScrollToBottom = true; }
-		last_item_count = Items.Size;
-	}
+/**
+ * @brief Applies the 'log_file' / 'logging' cvars as soon as they change.
+ *
+ * Delivered from 'set' and from a config reload (cvar == nullptr), so the log
+ * file follows the cvars without depending on the console window being ticked.
+ *
+ * @param event The cvar that was set, or nullptr when any may have changed.
+ */
+void ConsoleWindow::OnConfigChanged(const ConfigChanged& event) {
+	if (event.cvar && event.cvar != &cvars::ConsoleLogFile && event.cvar != &cvars::ConsoleFileLogging) return;
 
-	// Periodically flush log file to ensure data persistence
-	static int flush_counter = 0;
-	if (m_bEnableFileLogging && m_logFile.is_open()) {
-		if (++flush_counter >= 60) { // Once per second at 60 FPS
-			m_logFile.flush();
-			flush_counter = 0;
-		}
+	if (cvars::ConsoleLogFile.GetModificationCount() != m_logFileCVarVersion) {
+		m_logFileCVarVersion = cvars::ConsoleLogFile.GetModificationCount();
+		SetLogFilePath(utf::ToWide(cvars::ConsoleLogFile.Get()));
+	}
+	if (cvars::ConsoleFileLogging.Get() != m_bEnableFileLogging) {
+		EnableFileLogging(cvars::ConsoleFileLogging.Get());
 	}
 }
 
@@ -317,10 +380,125 @@ ImWchar* ConsoleWindow::Wcsdup(const ImWchar* s) {
  * This operation cannot be undone.
  */
 void ConsoleWindow::ClearLog() {
-	for (int i = 0; i < Items.Size; i++) ImGui::MemFree(Items[i]);
+	for (int i = 0; i < Items.Size; i++) FreeItem(Items[i]);
 	Items.clear();
 }
 
+/**
+ * @brief Releases the text and color spans of one log item.
+ */
+void ConsoleWindow::FreeItem(ConsoleItem& item) {
+	ImGui::MemFree(item.Text);
+	if (item.Spans) ImGui::MemFree(item.Spans);
+	item = ConsoleItem{};
+}
+
+/**
+ * @brief Appends a line to the log, dropping the oldest lines past capacity.
+ *
+ * The
+ * capacity comes from the 'log_capacity' cvar. Lines are dropped in batches of
+ * one eighth
+ * of the capacity so the front erase is not paid on every call.
+ *
+ * @param item Line built by
+ * AppendItem(); ownership moves to Items.
+ */
+void ConsoleWindow::PushItem(ConsoleItem item) {
+	Items.push_back(item);
+
+	const int capacity = cvars::LogCapacity.Get();
+	if (Items.Size > capacity) {
+		const int drop = ImMin(Items.Size, Items.Size - capacity + capacity / 8);
+		for (int i = 0; i < drop; i++) FreeItem(Items[i]);
+		Items.erase(Items.begin(), Items.begin() + drop);
+	}
+
+	if (cvars::ConsoleAutoScroll.Get()) ScrollToBottom = true;
+}
+
+/**
+ * @brief Parses one UTF-8 line into a log item and appends it.
+ *
+ * ANSI color
+ * sequences are turned into color spans while the text is decoded straight
+ * into the item
+ * buffer; the parser state carries over to the next line like on a
+ * terminal. A line with a
+ * [tag] (see ImGuiTermcolor::FindLineTag) sets the color of
+ * uncolored text from that line on,
+ * until a [reset] line.
+ *
+ * The plain text also goes to
+ * the log file and, while ExecRemoteCommand() runs, to
+ * the capture buffer.
+ *
+ * @param utf8 Line;
+ * one trailing line break is dropped.
+ */
+void ConsoleWindow::AppendItem(std::string_view utf8) {
+	MemTagScope tag(MemTag::Console); // Line buffers, the item and Items growth in PushItem()
+
+	if (!utf8.empty() && utf8.back() == '\n') utf8.remove_suffix(1);
+	if (!utf8.empty() && utf8.back() == '\r') utf8.remove_suffix(1);
+
+	m_itemText.resize(0);
+	m_itemSpans.resize(0);
+	m_plainText.clear();
+
+	ImU32 color = m_ansi.GetColor();
+	m_ansi.Feed(
+		utf8,
+		[this, &color](std::string_view text) {
+			const int begin = m_itemText.Size;
+			if (m_itemSpans.empty() || m_itemSpans.back().Color != color)
+				m_itemSpans.push_back(ConsoleSpan{begin, color});
+
+			const size_t chars = utf::WideLengthFromUtf8<ImWchar>(text.data(), text.size());
+			m_itemText.resize(begin + static_cast<int>(chars));
+			utf::Utf8ToWide(text.data(), text.size(), m_itemText.Data + begin, chars);
+
+			m_plainText.append(text);
+		},
+		[&color](ImU32 newColor) { color = newColor; });
+	const int length = m_itemText.Size;
+	m_itemText.push_back(0);
+
+	ImVec4 tagColor;
+	bool   reset = false;
+	if (ImGuiTermcolor::FindLineTag(m_plainText.c_str(), tagColor, reset))
+		m_tagColor = reset ? 0 : ImGui::ColorConvertFloat4ToU32(tagColor);
+
+	// Uncolored runs take the tag color; merge runs that end up equal
+	int spanCount = 0;
+	for (const ConsoleSpan& span : m_itemSpans) {
+		const ImU32 spanColor = span.Color ? span.Color : m_tagColor;
+		if (spanCount && m_itemSpans[spanCount - 1].Color == spanColor) continue;
+		m_itemSpans[spanCount++] = ConsoleSpan{span.Begin, spanColor};
+	}
+
+	ConsoleItem item{};
+	item.Length = length;
+	item.Text	= static_cast<ImWchar*>(ImGui::MemAlloc(m_itemText.size_in_bytes()));
+	memcpy(item.Text, m_itemText.Data, m_itemText.size_in_bytes());
+	if (spanCount > 1) {
+		item.Spans = static_cast<ConsoleSpan*>(ImGui::MemAlloc(spanCount * sizeof(ConsoleSpan)));
+		memcpy(item.Spans, m_itemSpans.Data, spanCount * sizeof(ConsoleSpan));
+		item.SpanCount = spanCount;
+	} else {
+		item.Color = spanCount ? m_itemSpans[0].Color : m_tagColor;
+	}
+	PushItem(item);
+
+	// Mirror the line to a remote client while ExecRemoteCommand() runs
+	if (m_pCapture) {
+		m_pCapture->append(m_plainText);
+		m_pCapture->push_back('\n');
+	}
+
+	WriteLogFile(m_plainText, true);
+}
+
 /**
  * @brief Executes a console command.
  *
@@ -342,98 +520,111 @@ void ConsoleWindow::ClearLog() {
 void ConsoleWindow::ExecMyCommand(const ImWchar* command_line) {
 	// Convert ImWchar to UTF-8 for processing
 	char utf8_buf[256];
-	ImTextStrToUtf8(utf8_buf, sizeof(utf8_buf), command_line, nullptr);
+	utf::WideToUtf8Cstr(command_line, utf8_buf, sizeof(utf8_buf));
 	AddLog("# %s\n", utf8_buf);
 
 	// Insert into history. First find match and delete it so it can be pushed to the back.
 	// This isn't trying to be smart or optimal.
 	HistoryPos = -1;
-	for (int i = History.Size - 1; i >= 0; i--)
+	for (int i = (int)History.size() - 1; i >= 0; i--)
 		if (Wcsicmp(History[i], command_line) == 0) {
-			ImGui::MemFree(History[i]);
 			History.erase(History.begin() + i);
 			break;
 		}
-	History.push_back(Wcsdup(command_line));
+	History.emplace_back(command_line);
 
-	// Parse command and arguments
-	std::string full_command = utf8_buf;
-	std::string command_name;
-	std::string args;
+	RunCommandLine(utf8_buf);
 
-	// Split command and arguments
-	size_t first_space = full_command.find_first_of(" \t");
-	if (first_space != std::string::npos) {
-		command_name	 = full_command.substr(0, first_space);
-		args			 = full_command.substr(first_space + 1);
-		// Trim leading whitespace from args
-		size_t arg_start = args.find_first_not_of(" \t");
-		if (arg_start != std::string::npos) {
-			args = args.substr(arg_start);
-		} else {
-			args.clear();
-		}
-	} else {
-		command_name = full_command;
-	}
+	// On command input, we scroll to bottom even if AutoScroll==false
+	ScrollToBottom = true;
+}
 
-	// Convert command to lowercase for case-insensitive comparison
-	std::string command_lower = command_name;
-	std::transform(command_lower.begin(), command_lower.end(), command_lower.begin(), ::tolower);
+/**
+ * @brief Executes a command received through the control endpoint.
+ *
+ * Runs through the
+ * same dispatch table as typed commands but is not added to the history.
+ * Every line logged
+ * while the command runs is also appended to @p output.
+ *
+ * @param command_line UTF-8 command line
+ * without the trailing newline.
+ * @param output Receives the command's output, one '\n'
+ * terminated line per log entry.
+ *
+ * Commands that would end the process, break into the debugger or run the
+ * benchmarks (whose 'ipc' target waits on the endpoint that is running this
+ * very request) are refused.
+ */
+void ConsoleWindow::ExecRemoteCommand(const std::string& command_line, std::string& output) {
+	AddLog("[cmd] ⇄ %s\n", command_line.c_str());
 
-	// Command types - using variant for type-safe command representation
-	struct SimpleCommand {
-		std::function<void(ConsoleWindow*)> handler;
-	};
+	std::string* previous = m_pCapture;
+	m_pCapture			  = &output;
 
-	struct ParameterizedCommand {
-		std::function<void(ConsoleWindow*, const std::string&)> handler;
-	};
+	static const char* const excluded[] = {"exit", "quit", "break", "bench"};
 
-	using CommandVariant = std::variant<SimpleCommand, ParameterizedCommand>;
+	const std::string_view command_name =
+		std::string_view(command_line).substr(0, command_line.find_first_of(" \t"));
+	if (std::any_of(std::begin(excluded), std::end(excluded),
+					[&](const char* e) { return utf::EqualsNoCase(command_name, e); })) {
+		AddLog("[error] ❌ '%.*s' is not available to remote clients\n", (int)command_name.size(),
+			   command_name.data());
+	} else {
+		RunCommandLine(command_line);
+	}
+	m_pCapture = previous;
+}
 
-	// Command dispatch table using variant for extensibility and type safety
-	static const std::unordered_map<std::string, CommandVariant> commandHandlers = {
-		// Simple commands (no arguments)
-		{"exit", SimpleCommand{&ConsoleWindow::CommandExit}},
-		{"quit", SimpleCommand{&ConsoleWindow::CommandQuit}},
-		{"demo", SimpleCommand{&ConsoleWindow::CommandDemo}},
-		{"show", SimpleCommand{&ConsoleWindow::CommandShowCmd}},
-		{"hide", SimpleCommand{&ConsoleWindow::CommandHideCmd}},
-		{"commands", SimpleCommand{&ConsoleWindow::CommandList}},
-		{"clear", SimpleCommand{&ConsoleWindow::CommandClear}},
-		{"cls", SimpleCommand{&ConsoleWindow::CommandClear}},
-		{"help", SimpleCommand{&ConsoleWindow::CommandHelp}},
-		{"history", SimpleCommand{&ConsoleWindow::CommandHistory}},
-		{"status", SimpleCommand{&ConsoleWindow::CommandStatus}},
-		{"break", SimpleCommand{&ConsoleWindow::CommandBreak}},
-		{"fonts", SimpleCommand{&ConsoleWindow::CommandFonts}},
+/**
+ * @brief Splits a command line into name and arguments and dispatches it.
+ *
+ *
+ * @param full_command UTF-8 command line.
+ */
+void ConsoleWindow::RunCommandLine(const std::string& full_command) {
+	// Split command and arguments; the name is only looked up, so it stays a view
+	const size_t			first_space	 = full_command.find_first_of(" \t");
+	const std::string_view command_name = std::string_view(full_command).substr(0, first_space);
+	std::string			args;
+	if (first_space != std::string::npos) {
+		// Trim leading whitespace from args
+		const size_t arg_start = full_command.find_first_not_of(" \t", first_space);
+		if (arg_start != std::string::npos) args = full_command.substr(arg_start);
+	}
 
-		// Parameterized commands (with arguments)
-		{"echo", ParameterizedCommand{&ConsoleWindow::CommandEcho}},
-		{"set", ParameterizedCommand{&ConsoleWindow::CommandSet}},
-		{"log", ParameterizedCommand{&ConsoleWindow::CommandLog}}};
-
-
-	// Look up and execute command - O(1) hash lookup with variant visitation
-	auto it = commandHandlers.find(command_lower);
-	if (it != commandHandlers.end()) {
-		std::visit(
-			[this, &args](auto&& cmd) {
-				using T = std::decay_t<decltype(cmd)>;
-				if constexpr (std::is_same_v<T, SimpleCommand>) {
-					cmd.handler(this);
-				} else if constexpr (std::is_same_v<T, ParameterizedCommand>) {
-					cmd.handler(this, args);
-				}
-			},
-			it->second);
-	} else {
-		AddLog("[error] ❌ Unknown command: '%s'\n", command_name.c_str());
+	// Look up and execute command - O(1) case-insensitive hash lookup with variant visitation
+	if (!DispatchCommand(command_name, args)) {
+		AddLog("[error] ❌ Unknown command: '%.*s'\n", (int)command_name.size(), command_name.data());
 	}
+}
 
-	// On command input, we scroll to bottom even if AutoScroll==false
-	ScrollToBottom = true;
+/**
+ * @brief Runs a command handler from the dispatch table.
+ *
+ * @param command Command name in
+ * any case.
+ * @param args Arguments passed to parameterized commands.
+ * @return false if no
+ * command with that name exists.
+ */
+bool ConsoleWindow::DispatchCommand(std::string_view command, const std::string& args) {
+	const auto& commandHandlers = GetCommandHandlers();
+
+	auto it = commandHandlers.find(command);
+	if (it == commandHandlers.end()) return false;
+
+	std::visit(
+		[this, &args](auto&& cmd) {
+			using T = std::decay_t<decltype(cmd)>;
+			if constexpr (std::is_same_v<T, SimpleCommand>) {
+				cmd.handler(this);
+			} else if constexpr (std::is_same_v<T, ParameterizedCommand>) {
+				cmd.handler(this, args);
+			}
+		},
+		it->second);
+	return true;
 }
 
 // Command handler implementations
@@ -441,25 +632,24 @@ void ConsoleWindow::ExecMyCommand(const ImWchar* command_line) {
 /**
  * @brief Handler for the 'exit' command.
  *
- * Logs an exit message and terminates the
- * application with EXIT_SUCCESS.
+ * Logs an exit message and asks the main loop
+ * to shut down after the current frame (App::RequestExit()).
  */
 void ConsoleWindow::CommandExit() {
 	AddLog("[warning] 👋 Exiting application...\n");
-	std::exit(EXIT_SUCCESS);
+	App::RequestExit();
 }
 
 /**
  * @brief Handler for the 'quit' command.
  *
- * Logs a quit message and terminates the
- * application with EXIT_SUCCESS.
+ * Logs a quit message and asks the main loop
+ * to shut down after the current frame.
  * Functionally equivalent to CommandExit().
  */
 void ConsoleWindow::CommandQuit() {
 	AddLog("[warning] 👋 Quitting application...\n");
-	std::exit(EXIT_SUCCESS);
-	// blah blah
+	App::RequestExit();
 }
 
 /**
@@ -468,6 +658,10 @@ void ConsoleWindow::CommandQuit() {
  * Toggles the ImGui demo window visibility.
  */
 void ConsoleWindow::CommandDemo() {
+	if constexpr (!Features::DemoWindows) {
+		AddLog("[warning] ⚠️ Demo windows are not compiled into this build\n");
+		return;
+	}
 	m_memory->m_bShow_demo_window = !m_memory->m_bShow_demo_window;
 	AddLog("[success] 🎪 Demo window %s\n",
 		   m_memory->m_bShow_demo_window ? "✅ enabled" : "❌ disabled");
@@ -481,7 +675,7 @@ void ConsoleWindow::CommandDemo() {
  */
 void ConsoleWindow::CommandShowCmd() {
 	m_memory->m_bShowCmd = true;
-	m_cmd->ShowConsole(true);
+	EventBus::Get_EventBus_Singleton()->Publish(ConsoleVisibilityChanged{true});
 	AddLog("[success] 👁️ Console window shown\n");
 }
 
@@ -493,7 +687,7 @@ void ConsoleWindow::CommandShowCmd() {
  */
 void ConsoleWindow::CommandHideCmd() {
 	m_memory->m_bShowCmd = false;
-	m_cmd->ShowConsole(false);
+	EventBus::Get_EventBus_Singleton()->Publish(ConsoleVisibilityChanged{false});
 	AddLog("[success] 🙈 Console window hidden\n");
 }
 
@@ -540,10 +734,10 @@ void ConsoleWindow::CommandHelp() {
  */
 void ConsoleWindow::CommandHistory() {
 	AddLog("[info] 📚 Command History:\n");
-	int first = History.Size - 10;
-	for (int i = first > 0 ? first : 0; i < History.Size; i++) {
+	int first = (int)History.size() - 10;
+	for (int i = first > 0 ? first : 0; i < (int)History.size(); i++) {
 		char hist_utf8[256];
-		ImTextStrToUtf8(hist_utf8, sizeof(hist_utf8), History[i], nullptr);
+		utf::WideToUtf8Cstr(History[i], hist_utf8, sizeof(hist_utf8));
 		AddLog("[history] 📌 %3d: %s\n", i, hist_utf8);
 	}
 }
@@ -601,6 +795,44 @@ void ConsoleWindow::CommandFonts() {
 	}
 }
 
+/**
+ * @brief Handler for the 'sizes' command.
+ *
+ * Lists sizeof() of every service compiled in and the optional features
+ * (see Features.hpp). The panels used to derive from MemoryManagement, which
+ * put a whole service table, startup graph and the UI flags inside each of
+ * them; the last lines show what that cost and which panels exist right now.
+ */
+void ConsoleWindow::CommandSizes() {
+	AddLog("[info] 📏 Service sizes:\n");
+	auto report = [this]<typename... Ts>(ServiceRegistry<Ts...>*) {
+		(AddLog("[cmd]   ▸ %-32.*s %6zu bytes\n", static_cast<int>(ServiceRegistry<Ts...>::template Name<Ts>().size()),
+				ServiceRegistry<Ts...>::template Name<Ts>().data(), sizeof(Ts)),
+		 ...);
+	};
+	report(static_cast<MemoryManagement::Services*>(nullptr));
+
+	auto onOff = [](bool enabled) { return enabled ? "on" : "off"; };
+	AddLog("[info] Features: file browser %s, process launcher %s, font manager UI %s, ImPlot %s, demo windows %s\n",
+		   onOff(Features::FileBrowser), onOff(Features::ProcessLauncher), onOff(Features::FontManagerUI),
+		   onOff(Features::ImPlot), onOff(Features::DemoWindows));
+
+	// What each panel compiled in embedded before
+	constexpr size_t kPanels  = 1 + Features::FileBrowser + Features::FontManagerUI;
+	const size_t	 embedded = sizeof(MemoryManagement) - sizeof(Master);
+	AddLog("[info] Panels no longer embed a MemoryManagement: %zu bytes each, %zu in total\n", embedded,
+		   embedded * kPanels);
+
+	// Created while shown and for panel_release_s after being closed
+	AddLog("[info] DebugWindow created: %s\n", m_memory->Find<DebugWindow>() ? "yes" : "no");
+#if APP_FEATURE_FILE_BROWSER
+	AddLog("[info] WindowClass created: %s\n", m_memory->Find<WindowClass>() ? "yes" : "no");
+#endif
+#if APP_FEATURE_FONT_MANAGER_UI
+	AddLog("[info] FontManagerWindow created: %s\n", m_memory->Find<FontManagerWindow>() ? "yes" : "no");
+#endif
+}
+
 // Parameterized command implementations
 
 /**
@@ -622,54 +854,561 @@ void ConsoleWindow::CommandEcho(const std::string& args) {
 /**
  * @brief Handler for the 'set' command.
  *
- * Sets configuration values. Currently supports:
+ * Inspects and changes console variables (see
+ * ConsoleVariables.hpp).
+ * - 'set' lists every variable with its current value
+ * - 'set <name>'
+ * shows value, default, accepted values and description
+ * - 'set <name> <value>' parses and
+ * stores a new value
  *
- * - 'autoscroll' (true/false/on/off/1/0)
- * - 'logging' (true/false/on/off/1/0)
+ * Archived variables are written to config.json right away.
  *
- * @param args
- * The key-value pair in format "<key> <value>".
+ *
+ * @param args Empty, "<name>" or "<name> <value>".
  */
 void ConsoleWindow::CommandSet(const std::string& args) {
+	CVarRegistry* registry = CVarRegistry::Get_CVarRegistry_Singleton();
+
 	if (args.empty()) {
-		AddLog("[warning] ⚠️ Usage: set <key> <value>\n");
+		AddLog("[info] ⚙️ Console variables:\n");
+		registry->ForEach([this](const CVar& cvar) {
+			AddLog("[cmd]   ▸ %-20s = %-16s (%s) %s\n", cvar.GetName().c_str(),
+				   cvar.ToString().c_str(), cvar.GetTypeName(), cvar.GetDescription().c_str());
+		});
+		AddLog("[info] Usage: set <name> <value>\n");
 		return;
 	}
 
-	// Parse key and value
-	size_t space_pos = args.find_first_of(" \t");
-	if (space_pos == std::string::npos) {
-		AddLog("[error] ❌ Missing value. Usage: set <key> <value>\n");
+	// Parse name and (optional) value
+	std::string key = args;
+	std::string value;
+	size_t		space_pos = args.find_first_of(" \t");
+	if (space_pos != std::string::npos) {
+		key	  = args.substr(0, space_pos);
+		value = args.substr(space_pos + 1);
+
+		// Trim leading whitespace from value
+		size_t val_start = value.find_first_not_of(" \t");
+		value			 = val_start != std::string::npos ? value.substr(val_start) : std::string();
+	}
+	CVar* cvar = registry->Find(key); // Case-insensitive
+	if (!cvar) {
+		AddLog("[error] ❌ Unknown variable: '%s' (type 'set' to list them)\n", key.c_str());
+		return;
+	}
+
+	// 'set <name>' - describe the variable
+	if (value.empty()) {
+		const std::string domain = cvar->DescribeDomain();
+		AddLog("[info] %s = %s (%s, default %s%s%s)\n", cvar->GetName().c_str(),
+			   cvar->ToString().c_str(), cvar->GetTypeName(), cvar->DefaultToString().c_str(),
+			   domain.empty() ? "" : ", ", domain.c_str());
+		AddLog("[grey]   %s\n", cvar->GetDescription().c_str());
 		return;
 	}
 
-	std::string key	  = args.substr(0, space_pos);
-	std::string value = args.substr(space_pos + 1);
+	if (cvar->GetFlags() & CVarFlags_ReadOnly) {
+		AddLog("[error] ❌ '%s' is read-only\n", key.c_str());
+		return;
+	}
 
-	// Trim leading whitespace from value
-	size_t val_start = value.find_first_not_of(" \t");
-	if (val_start != std::string::npos) { value = value.substr(val_start); }
+	if (!cvar->FromString(value)) {
+		AddLog("[error] ❌ Invalid value '%s' for '%s' (expected %s)\n", value.c_str(), key.c_str(),
+			   cvar->DescribeDomain().empty() ? cvar->GetTypeName()
+											  : cvar->DescribeDomain().c_str());
+		return;
+	}
 
-	AddLog("[success] ✅ Set '%s' = '%s'\n", key.c_str(), value.c_str());
+	AddLog("[success] ✅ Set '%s' = '%s'\n", key.c_str(), cvar->ToString().c_str());
+	EventBus::Get_EventBus_Singleton()->Publish(ConfigChanged{cvar});
 
-	// Example: Handle specific settings
-	if (key == "autoscroll") {
-		if (value == "true" || value == "1" || value == "on") {
-			AutoScroll = true;
-			AddLog("[info] Auto-scroll enabled\n");
-		} else if (value == "false" || value == "0" || value == "off") {
-			AutoScroll = false;
-			AddLog("[info] Auto-scroll disabled\n");
+	// Persist immediately so the value survives a crash or forced exit
+	if ((cvar->GetFlags() & CVarFlags_Archive) && m_configManager) {
+		m_configManager->SaveConfiguration();
+	}
+}
+
+/**
+ * @brief Registers the built-in targets for the 'bench' command.
+ *
+ * Each target exercises
+ * one hot path exactly as the UI does. Console commands
+ * from the dispatch table can be benchmarked
+ * by name as well (see CommandBench()).
+ */
+void ConsoleWindow::RegisterBenchTargets() {
+	m_bench.AddTarget("log", "AddLog() of one formatted line", 10000, [this](uint32_t i) {
+		AddLog("[info] bench line %u\n", i);
+	});
+
+	m_bench.AddTarget("filter", "UTF-8 conversion + filter pass over the whole log (one frame)", 200,
+					  [this](uint32_t) {
+						  char item_utf8[1024];
+						  for (int i = 0; i < Items.Size; i++) {
+							  const ConsoleItem& item  = Items[i];
+							  const size_t	   bytes = utf::WideToUtf8(item.Text, item.Length, item_utf8,
+																 sizeof(item_utf8));
+							  Filter.PassFilter(item_utf8, item_utf8 + bytes);
+						  }
+					  });
+
+	m_bench.AddTarget("completion", "Tab-completion candidates for \"s\"", 10000, [this](uint32_t) {
+		static const char word[] = "s";
+		ImVector<const char*> candidates;
+		CollectCompletions(word, word + 1, candidates);
+	});
+
+	// One command's worth of strings: 32 history-length lines (too long to be inline)
+	static const char* const kLongLine = "set console_overflow merge # keep repeats";
+	m_bench.AddTarget("imstr_heap", "32 ImStr of 41 chars on the ImGui heap", 10000, [](uint32_t) {
+		for (int i = 0; i < 32; i++) ImStr line(kLongLine);
+	});
+	auto arena = std::make_shared<ImStrArena>();
+	m_bench.AddTarget("imstr_arena", "Same 32 ImStr from an ImStrArena, then Reset()", 10000,
+					  [arena](uint32_t) {
+						  for (int i = 0; i < 32; i++) ImStr line(kLongLine, arena.get());
+						  arena->Reset();
+					  });
+	m_bench.AddTarget("imstr_short", "ImStr of a command name (stored inline)", 100000,
+					  [](uint32_t) { ImStr name("HISTORY"); });
+	m_bench.AddTarget("intern", "StrId of an already interned tag + id compare", 100000,
+					  [](uint32_t) {
+						  if (StrId("[warning]") == StrId("[error]"))
+							  throw std::runtime_error("distinct strings share an id");
+					  });
+
+	m_bench.AddTarget("config_save", "ConfigManager::SaveConfiguration() (disk write)", 50,
+					  [this](uint32_t) {
+						  if (m_configManager) m_configManager->SaveConfiguration();
+					  });
+
+	m_bench.AddTarget("style_apply", "StyleManager::ApplyStyleToImGui()", 1000, [this](uint32_t) {
+		if (m_StyleManager) m_StyleManager->ApplyStyleToImGui();
+	});
+
+	m_bench.AddTarget("font_lookup", "FontManager::GetFontByName()", 100000, [this](uint32_t) {
+		if (m_font_manager) m_font_manager->GetFontByName("Consolas");
+	});
+
+	// Formatting cost alone: a private CustomOutput whose only sink counts bytes
+	auto formatOut	 = std::make_shared<CustomOutput>();
+	auto formatBytes = std::make_shared<uint64_t>(0);
+	formatOut->AddSink(std::make_unique<CallbackSink>(
+		[formatBytes](std::string_view line) { *formatBytes += line.size(); }));
+	m_bench.AddTarget("out_format", "Out << text << int << float << std::endl (counting sink only)",
+					  100000, [formatOut](uint32_t i) {
+						  *formatOut << tc::green << "[info] frame " << i << " took " << 16.6667f
+									 << " ms" << tc::reset << std::endl;
+					  });
+
+	m_bench.AddTarget("out_endl", "Out << ... << std::endl through every registered sink", 2000,
+					  [this](uint32_t i) {
+						  if (m_cmd) m_cmd->Out << "[info] bench line " << i << std::endl;
+					  });
+
+	m_bench.AddCustomTarget("out_threads",
+							"Per-line cost of Out << ... << std::endl with every core logging at once",
+							20000, [](uint32_t iterations) {
+								return CustomOutput::MeasureConcurrentLines(iterations);
+							});
+
+	m_bench.AddCustomTarget("console_sync", "Line written straight to a throttled console stand-in",
+							2000, [](uint32_t iterations) {
+								return AsyncConsoleWriter::MeasureThrottled(iterations, false);
+							});
+
+	m_bench.AddCustomTarget("console_async",
+							"Line queued to AsyncConsoleWriter over the same throttled device",
+							2000, [](uint32_t iterations) {
+								return AsyncConsoleWriter::MeasureThrottled(iterations, true);
+							});
+
+	// Transcoding over one corpus: utf:: against the ImGui and Win32 routines it
+	// replaced. Throughput counts UTF-8 bytes of text in both directions.
+	struct TranscodeData {
+		std::string			 utf8;
+		std::vector<ImWchar> wide;
+		std::wstring		 wideWin32;
+		std::vector<ImWchar> wideOut;
+		std::string			 utf8Out;
+	};
+	auto text  = std::make_shared<TranscodeData>();
+	text->utf8 = MakeTranscodeCorpus();
+	text->wide.resize(utf::WideLengthFromUtf8<ImWchar>(text->utf8.data(), text->utf8.size()));
+	utf::Utf8ToWide(text->utf8.data(), text->utf8.size(), text->wide.data(), text->wide.size());
+	text->wideWin32 = utf::ToWide(text->utf8);
+	text->wideOut.resize(text->wide.size() + 1); // ImGui terminates its output
+	text->utf8Out.resize(text->utf8.size() + 1);
+
+	m_bench.AddTarget("utf8_to_16", "utf::Utf8ToWide() over 64 KiB of console text", 2000,
+					  [text](uint32_t) {
+						  utf::Utf8ToWide(text->utf8.data(), text->utf8.size(), text->wideOut.data(),
+										  text->wideOut.size());
+					  });
+	m_bench.AddTarget("utf8_to_16_imgui", "ImTextStrFromUtf8() over the same text", 2000,
+					  [text](uint32_t) {
+						  ImTextStrFromUtf8(text->wideOut.data(), static_cast<int>(text->wideOut.size()),
+											text->utf8.data(), text->utf8.data() + text->utf8.size());
+					  });
+	m_bench.AddTarget("utf8_to_16_win32", "MultiByteToWideChar() (size query + convert)", 2000,
+					  [text](uint32_t) {
+						  const int count = MultiByteToWideChar(
+							  CP_UTF8, 0, text->utf8.data(), static_cast<int>(text->utf8.size()), nullptr, 0);
+						  text->wideWin32.resize(static_cast<size_t>(count));
+						  MultiByteToWideChar(CP_UTF8, 0, text->utf8.data(),
+											  static_cast<int>(text->utf8.size()), text->wideWin32.data(),
+											  count);
+					  });
+
+	m_bench.AddTarget("utf16_to_8", "utf::WideToUtf8() over the same text", 2000, [text](uint32_t) {
+		utf::WideToUtf8(text->wide.data(), text->wide.size(), text->utf8Out.data(),
+						text->utf8Out.size());
+	});
+	m_bench.AddTarget("utf16_to_8_imgui", "ImTextStrToUtf8() over the same text", 2000,
+					  [text](uint32_t) {
+						  ImTextStrToUtf8(text->utf8Out.data(), static_cast<int>(text->utf8Out.size()),
+										  text->wide.data(), text->wide.data() + text->wide.size());
+					  });
+	m_bench.AddTarget("utf16_to_8_win32", "WideCharToMultiByte() (size query + convert)", 2000,
+					  [text](uint32_t) {
+						  const int length = static_cast<int>(text->wideWin32.size());
+						  const int bytes	 = WideCharToMultiByte(CP_UTF8, 0, text->wideWin32.data(),
+																 length, nullptr, 0, nullptr, nullptr);
+						  WideCharToMultiByte(CP_UTF8, 0, text->wideWin32.data(), length,
+											  text->utf8Out.data(), bytes, nullptr, nullptr);
+					  });
+
+	m_bench.AddTarget("utf8_validate", "utf::IsValidUtf8() over the same text", 2000,
+					  [text](uint32_t) {
+						  if (!utf::IsValidUtf8(text->utf8.data(), text->utf8.size()))
+							  throw std::runtime_error("corpus is not valid UTF-8");
+					  });
+	m_bench.AddTarget("utf8_validate_win32", "MultiByteToWideChar(MB_ERR_INVALID_CHARS) size query",
+					  2000, [text](uint32_t) {
+						  if (MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, text->utf8.data(),
+												  static_cast<int>(text->utf8.size()), nullptr, 0) <= 0)
+							  throw std::runtime_error("corpus is not valid UTF-8");
+					  });
+
+	for (const char* name : {"utf8_to_16", "utf8_to_16_imgui", "utf8_to_16_win32", "utf16_to_8",
+							 "utf16_to_8_imgui", "utf16_to_8_win32", "utf8_validate",
+							 "utf8_validate_win32"})
+		m_bench.SetThroughput(name, text->utf8.size());
+
+	// Case folding and case-insensitive compare over the same corpus, against the
+	// per-character CRT loops they replaced (Helpers::strtoLower, Stricmp)
+	struct CaseData {
+		std::string upper; // Corpus with ASCII letters uppercased
+		std::string out;
+	};
+	auto cased	 = std::make_shared<CaseData>();
+	cased->upper = text->utf8;
+	for (char& c : cased->upper) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+	cased->out.resize(text->utf8.size());
+
+	m_bench.AddTarget("fold_case", "utf::FoldCase() of 64 KiB of console text into a buffer", 2000,
+					  [cased](uint32_t) {
+						  utf::FoldCase(cased->upper, cased->out.data(), cased->out.size());
+					  });
+	m_bench.AddTarget("fold_case_crt", "std::transform(::tolower) of the same text", 2000,
+					  [cased](uint32_t) {
+						  std::transform(cased->upper.begin(), cased->upper.end(), cased->out.begin(),
+										 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+					  });
+	m_bench.AddTarget("nocase_cmp", "utf::EqualsNoCase() of the text against its uppercase copy",
+					  2000, [text, cased](uint32_t) {
+						  if (!utf::EqualsNoCase(text->utf8, cased->upper))
+							  throw std::runtime_error("case-insensitive compare failed");
+					  });
+	m_bench.AddTarget("nocase_cmp_crt", "toupper() loop (the old Stricmp) over the same pair", 2000,
+					  [text, cased](uint32_t) {
+						  const char* s1 = text->utf8.c_str();
+						  const char* s2 = cased->upper.c_str();
+						  int		  d;
+						  while ((d = toupper(*s2) - toupper(*s1)) == 0 && *s1) {
+							  s1++;
+							  s2++;
+						  }
+						  if (d != 0) throw std::runtime_error("case-insensitive compare failed");
+					  });
+	m_bench.AddTarget("nocase_hash", "utf::HashNoCase() of the same text", 2000,
+					  [text](uint32_t) { utf::HashNoCase(text->utf8); });
+
+	for (const char* name : {"fold_case", "fold_case_crt", "nocase_cmp", "nocase_cmp_crt", "nocase_hash"})
+		m_bench.SetThroughput(name, text->utf8.size());
+
+	// Command lookup as typed: no-case table against lowercase copy + plain map
+	m_bench.AddTarget("cmd_lookup", "Case-insensitive dispatch table lookup of \"HISTORY\"", 100000,
+					  [](uint32_t) {
+						  if (GetCommandHandlers().find(std::string_view("HISTORY")) ==
+							  GetCommandHandlers().end())
+							  throw std::runtime_error("command not found");
+					  });
+	auto lowered = std::make_shared<std::unordered_map<std::string, int>>();
+	for (const auto& [name, handler] : GetCommandHandlers()) lowered->emplace(name, 0);
+	m_bench.AddTarget("cmd_lookup_lower", "Lowercase copy of \"HISTORY\" + plain map lookup", 100000,
+					  [lowered](uint32_t) {
+						  std::string name = "HISTORY";
+						  std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+						  if (lowered->find(name) == lowered->end())
+							  throw std::runtime_error("command not found");
+					  });
+
+	// Service lookup: the registry against the old flag + null + throw getters. Find()
+	// is Get() without the debug assert, which the tool windows not yet shown would trip
+	auto serviceSink = std::make_shared<uintptr_t>(0);
+	auto getAll		 = []<typename... Ts>(const MemoryManagement* memory, ServiceRegistry<Ts...>*) {
+		return (reinterpret_cast<uintptr_t>(memory->Find<Ts>()) ^ ...);
+	};
+	m_bench.AddTarget("service_get", "MemoryManagement::Find<T>() of every service", 100000,
+					  [this, serviceSink, getAll](uint32_t) {
+						  *serviceSink ^= getAll(m_memory, static_cast<MemoryManagement::Services*>(nullptr));
+					  });
+	struct CheckedSlot {
+		bool  allocated;
+		void* service;
+	};
+	auto checkedSlots = std::make_shared<std::array<CheckedSlot, MemoryManagement::Services::kCount>>();
+	for (CheckedSlot& slot : *checkedSlots) slot = {true, &slot};
+	m_bench.AddTarget("service_get_checked", "Same lookups through allocated flag + null check + throw",
+					  100000, [serviceSink, checkedSlots](uint32_t) {
+						  for (const CheckedSlot& slot : *checkedSlots) {
+							  if (!slot.allocated) throw std::runtime_error("service is not allocated");
+							  if (!slot.service) throw std::runtime_error("service pointer is null");
+							  *serviceSink ^= reinterpret_cast<uintptr_t>(slot.service);
+						  }
+					  });
+
+	// File browser labels: frame arena against the std::string concatenation it replaced
+	static const wchar_t* const kWideFileName = L"StyleConfiguration_backup_2024.json";
+	m_bench.AddTarget("frame_labels", "64 \"[F] name\" labels from a wide name in the frame arena", 10000,
+					  [this](uint32_t) {
+						  const FrameArena::Marker mark = m_frameArena->Mark();
+						  for (int i = 0; i < 64; i++)
+							  m_frameArena->Concat({"[F] ", m_frameArena->Utf8(kWideFileName)});
+						  m_frameArena->Rewind(mark);
+					  });
+	m_bench.AddTarget("frame_labels_string", "Same labels as \"[F] \" + std::string", 10000, [](uint32_t) {
+		for (int i = 0; i < 64; i++) std::string label = "[F] " + utf::ToUtf8(kWideFileName);
+	});
+
+	// Scripted ImGui::MemAlloc traffic, one sample per frame; the default is ten
+	// minutes at 60 fps. Fragmentation is the share of memory held but not in use.
+	auto allocSession = [this](uint32_t frames, bool pooled) {
+		PoolAllocator::SessionReport report{};
+		BenchResult					 result = PoolAllocator::MeasureSession(frames, pooled, report);
+		const double unused = report.committedBytes
+								  ? 100.0 * (1.0 - double(report.liveBytes) / double(report.committedBytes))
+								  : 0.0;
+		AddBenchNote("[info]   %.1f KiB live, %.1f KiB committed, %.1f%% unused\n",
+					 report.liveBytes / 1024.0, report.committedBytes / 1024.0, unused);
+		return result;
+	};
+	m_bench.AddCustomTarget("alloc_session_pool", "Frame of a scripted session on the size-class pools", 36000,
+							[allocSession](uint32_t frames) { return allocSession(frames, true); });
+	m_bench.AddCustomTarget("alloc_session_heap", "Same session on a private Win32 heap (what malloc uses)",
+							36000, [allocSession](uint32_t frames) { return allocSession(frames, false); });
+
+	m_bench.AddCustomTarget("input_queue", "Input thread -> main thread command hand-off latency",
+							10000, [this](uint32_t iterations) {
+								if (!m_ConsoleInputHandler) return BenchResult{};
+								return m_ConsoleInputHandler->MeasureQueueLatency(iterations);
+							});
+
+	m_bench.AddCustomTarget("ipc", "Control endpoint round trip of 'echo' (client thread)", 2000,
+							[this](uint32_t iterations) {
+								if (!m_ControlServer) return BenchResult{};
+								return m_ControlServer->MeasureRoundTrip(iterations);
+							});
+
+	// Same batch on 1, 2, 4 ... cores and on all of them; the result kept is the
+	// all-cores one, and every core count is reported against 1 core below it
+	m_bench.AddCustomTarget(
+		"jobs_scaling", "Fan-out/join of 256 jobs on a private job pool, 1 to N cores", 200,
+		[this](uint32_t iterations) {
+			const uint32_t cores = std::clamp(std::thread::hardware_concurrency(), 1u, JobSystem::kMaxWorkers + 1);
+
+			std::vector<uint32_t> counts;
+			for (uint32_t count = 1; count < cores; count *= 2) counts.push_back(count);
+			counts.push_back(cores);
+
+			BenchResult result{};
+			double		single = 0.0;
+			for (uint32_t count : counts) {
+				result = JobSystem::MeasureScaling(iterations, count);
+				if (count == 1) single = result.median_us;
+				const double speedup = result.median_us > 0.0 ? single / result.median_us : 0.0;
+				AddBenchNote("[info]   %s: %.1f us median, %.2fx speedup, %.0f%% efficiency\n",
+							 result.target.c_str(), result.median_us, speedup, 100.0 * speedup / count);
+			}
+			return result;
+		});
+}
+
+/**
+ * @brief Handler for the 'bench' command.
+ *
+ * Usage:
+ * - 'bench' or 'bench list' lists
+ * the targets
+ * - 'bench <target> [iterations]' runs a target or any console command
+ * - 'bench all
+ * [iterations]' runs every built-in target
+ * - 'bench export [file]' writes the session's results
+ * as JSON
+ *
+ * Output produced while a benchmark runs goes to a scratch log that is discarded
+ * afterwards, and file logging is suspended, so measuring does not flood the console.
+ * A target's own report (AddBenchNote()) is printed with its results.
+ *
+ * @param
+ * args Sub-command or target name followed by an optional iteration count.
+ */
+void ConsoleWindow::CommandBench(const std::string& args) {
+	std::string target = args;
+	std::string rest;
+	size_t		space_pos = args.find_first_of(" \t");
+	if (space_pos != std::string::npos) {
+		target			 = args.substr(0, space_pos);
+		rest			 = args.substr(space_pos + 1);
+		size_t rest_start = rest.find_first_not_of(" \t");
+		rest			 = rest_start != std::string::npos ? rest.substr(rest_start) : std::string();
+	}
+	utf::FoldCase(target);
+
+	if (target.empty() || target == "list") {
+		AddLog("[info] ⏱️ Benchmark targets:\n");
+		for (const auto& [name, info] : m_bench.GetTargets()) {
+			AddLog("[cmd]   ▸ %-12s %6u iters  %s\n", name.c_str(), info.defaultIterations,
+				   info.description.c_str());
 		}
-	} else if (key == "logging") {
-		if (value == "true" || value == "1" || value == "on") {
-			EnableFileLogging(true);
-			AddLog("[info] File logging enabled\n");
-		} else if (value == "false" || value == "0" || value == "off") {
-			EnableFileLogging(false);
-			AddLog("[info] File logging disabled\n");
+		AddLog("[info] Any console command can be benchmarked by name too.\n");
+		AddLog("[info] Usage: bench <target|all> [iterations] | bench export [file]\n");
+		return;
+	}
+
+	if (target == "export") {
+		const std::wstring path = rest.empty() ? L"bench_results.json" : utf::ToWide(rest);
+		if (m_bench.GetResults().empty()) {
+			AddLog("[warning] ⚠️ No benchmark results to export yet\n");
+		} else if (m_bench.ExportJson(path)) {
+			AddLog("[success] ✅ Exported %zu result(s) to %ls\n", m_bench.GetResults().size(),
+				   path.c_str());
+		} else {
+			AddLog("[error] ❌ Failed to write %ls\n", path.c_str());
+		}
+		return;
+	}
+
+	uint32_t iterations = 0;
+	if (!rest.empty()) {
+		auto [ptr, ec] = std::from_chars(rest.data(), rest.data() + rest.size(), iterations);
+		if (ec != std::errc() || iterations == 0 || iterations > 10'000'000) {
+			AddLog("[error] ❌ Invalid iteration count: '%s'\n", rest.c_str());
+			return;
 		}
 	}
+
+	// Commands that would terminate, break into the debugger or recurse
+	static const char* const excluded[] = {"exit", "quit", "break", "bench", "activate"};
+	constexpr uint32_t		 kAdHocBenchIterations = 100; // Default for a console command
+
+	std::vector<std::string> toRun;
+	Benchmark::Body			 adHoc; // Set when target is a console command, run once and not registered
+	if (target == "all") {
+		for (const auto& [name, info] : m_bench.GetTargets()) toRun.push_back(name);
+	} else if (m_bench.FindTarget(target)) {
+		toRun.push_back(target);
+	} else if (GetCommandHandlers().count(target) &&
+			   std::none_of(std::begin(excluded), std::end(excluded),
+							[&](const char* e) { return target == e; })) {
+		// Wrap the console command as a one-off target; 'bench all' must not pick it up later
+		adHoc = [this, target](uint32_t) { DispatchCommand(target, std::string()); };
+		toRun.push_back(target);
+	} else {
+		AddLog("[error] ❌ Unknown benchmark target: '%s' (try 'bench list')\n", target.c_str());
+		return;
+	}
+
+	std::vector<BenchResult>			  results;
+	std::vector<std::vector<std::string>> notes; // Per result, from AddBenchNote()
+	m_benchNotes.clear();
+	for (const std::string& name : toRun) {
+		// Redirect output to a scratch log; the filter target measures the real log
+		ImVector<ConsoleItem> saved;
+		if (name != "filter") saved.swap(Items);
+		const bool fileLogging = m_bEnableFileLogging;
+		m_bEnableFileLogging   = false;
+
+		try {
+			results.push_back(adHoc ? m_bench.RunOnce(name, iterations ? iterations : kAdHocBenchIterations, adHoc)
+									: m_bench.Run(name, iterations));
+		} catch (const std::exception& e) {
+			m_bEnableFileLogging = fileLogging;
+			if (name != "filter") {
+				ClearLog();
+				Items.swap(saved);
+			}
+			m_benchNotes.clear();
+			AddLog("[error] ❌ Benchmark '%s' failed: %s\n", name.c_str(), e.what());
+			return;
+		}
+
+		m_bEnableFileLogging = fileLogging;
+		if (name != "filter") {
+			ClearLog();
+			Items.swap(saved);
+		}
+		notes.push_back(std::move(m_benchNotes));
+		m_benchNotes.clear();
+	}
+
+	for (size_t i = 0; i < results.size(); i++) {
+		const BenchResult& r = results[i];
+		AddLog("[success] ⏱️ %-12s min %9.3f us  median %9.3f us  p99 %9.3f us\n", r.target.c_str(),
+			   r.min_us, r.median_us, r.p99_us);
+		AddLog("[grey]   %u iters (+%u warmup, %u outliers dropped)  %.2f allocs/iter  %.0f "
+			   "B/iter\n",
+			   r.iterations, r.warmup, r.outliers, r.allocs_per_iter, r.bytes_per_iter);
+		if (r.throughput_gbps > 0.0) AddLog("[grey]   %.2f GB/s\n", r.throughput_gbps);
+		for (const std::string& note : notes[i]) AddLog("%s", note.c_str());
+	}
+}
+
+/**
+ * @brief Queues a line of a benchmark target's own report.
+ *
+ * Whatever a target logs while it runs is discarded with the scratch log, so
+ * a report meant for the user goes through here and CommandBench() prints it
+ * below the target's results.
+ *
+ * @param fmt The printf-style format string (UTF-8 encoded).
+ * @param ... Variable arguments for the format string.
+ */
+void ConsoleWindow::AddBenchNote(const char* fmt, ...) {
+	char	buf[1024];
+	va_list args;
+	va_start(args, fmt);
+	vsnprintf(buf, IM_ARRAYSIZE(buf), fmt, args);
+	buf[IM_ARRAYSIZE(buf) - 1] = 0;
+	va_end(args);
+
+	m_benchNotes.emplace_back(buf);
+}
+
+/**
+ * @brief Handler for the 'activate' command.
+ *
+ * Brings the main window to the front and applies window arguments
+ * (-width, -maximized, -cmd, ...). Sent by a later launch with -single so the
+ * running instance takes over its command line.
+ *
+ * @param args Command line arguments, quoted as on a Windows command line.
+ */
+void ConsoleWindow::CommandActivate(const std::string& args) {
+	m_cmdArgs->ApplyForwardedArguments(utf::ToWide(args));
+	if (!args.empty()) AddLog("[info] 🔁 Applied arguments: %s\n", args.c_str());
 }
 
 /**
@@ -704,8 +1443,7 @@ void ConsoleWindow::CommandLog(const std::string& args) {
 	size_t msg_start = message.find_first_not_of(" \t");
 	if (msg_start != std::string::npos) { message = message.substr(msg_start); }
 
-	// Convert level to lowercase
-	std::transform(level.begin(), level.end(), level.begin(), ::tolower);
+	utf::FoldCase(level);
 
 	// Log with appropriate level
 	if (level == "info") {
@@ -746,27 +1484,50 @@ void ConsoleWindow::AddLog(const char* fmt, ...) {
 	buf[IM_ARRAYSIZE(buf) - 1] = 0;
 	va_end(args);
 
-	// Convert UTF-8 to ImWchar for storage
-	ImWchar wbuf[1024];
-	ImTextStrFromUtf8(wbuf, IM_ARRAYSIZE(wbuf), buf, nullptr);
-	Items.push_back(Wcsdup(wbuf));
+	// Colors, storage, log file
+	AppendItem(buf);
+}
+
+/**
+ * @brief Adds one already formatted UTF-8 line (no printf pass).
+ *
+ * Used by the
+ * OutputConsole sink pipeline: the line is converted straight into the
+ * item's own
+ * allocation, without the fixed-size staging buffers of AddLog(). ANSI
+ * colors
+ * (tc::green, ...) become color spans.
+ *
+ * @param line UTF-8 text without the
+ * trailing newline.
+ */
+void ConsoleWindow::AddLine(std::string_view line) { AppendItem(line); }
 
-	// Write to log file if enabled
-	if (m_bEnableFileLogging && m_logFile.is_open()) {
-		// Get current timestamp
-		auto now  = std::chrono::system_clock::now();
-		auto time = std::chrono::system_clock::to_time_t(now);
-		auto ms =
-			std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
+/**
+ * @brief Appends a timestamped entry to the log file when file logging is on.
+ *
+ *
+ * Flushed by FlushLogFile(), which App schedules every 'log_flush_ms' milliseconds.
+ *
+ * @param text UTF-8 text.
+ * @param
+ * newline Append a line terminator after the text.
+ */
+void ConsoleWindow::WriteLogFile(std::string_view text, bool newline) {
+	if (!m_bEnableFileLogging || !m_logFile.is_open()) return;
 
-		struct tm timeinfo;
-		localtime_s(&timeinfo, &time);
+	// Get current timestamp
+	auto now  = std::chrono::system_clock::now();
+	auto time = std::chrono::system_clock::to_time_t(now);
+	auto ms	  = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
 
-		// Write timestamp and message
-		m_logFile << std::put_time(&timeinfo, "[%Y-%m-%d %H:%M:%S") << '.' << std::setfill('0')
-				  << std::setw(3) << ms.count() << "] " << buf;
-		m_logFile.flush(); // Ensure immediate write
-	}
+	struct tm timeinfo;
+	localtime_s(&timeinfo, &time);
+
+	// Write timestamp and message
+	m_logFile << std::put_time(&timeinfo, "[%Y-%m-%d %H:%M:%S") << '.' << std::setfill('0')
+			  << std::setw(3) << ms.count() << "] " << text;
+	if (newline) m_logFile << '\n';
 }
 
 /**
@@ -792,33 +1553,15 @@ void ConsoleWindow::AddLog(const ImWchar* fmt, ...) {
 	// Note: There's no standard vswprintf_s that works with ImWchar
 	// So we'll convert format to char, process, then convert back
 	char fmt_utf8[256];
-	ImTextStrToUtf8(fmt_utf8, sizeof(fmt_utf8), fmt, nullptr);
+	utf::WideToUtf8Cstr(fmt, fmt_utf8, sizeof(fmt_utf8));
 
 	char result_utf8[1024];
 	vsnprintf(result_utf8, sizeof(result_utf8), fmt_utf8, args);
 	result_utf8[sizeof(result_utf8) - 1] = 0;
 	va_end(args);
 
-	// Convert result back to ImWchar
-	ImTextStrFromUtf8(buf, IM_ARRAYSIZE(buf), result_utf8, nullptr);
-	Items.push_back(Wcsdup(buf));
-
-	// Write to log file if enabled
-	if (m_bEnableFileLogging && m_logFile.is_open()) {
-		// Get current timestamp
-		auto now  = std::chrono::system_clock::now();
-		auto time = std::chrono::system_clock::to_time_t(now);
-		auto ms =
-			std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-
-		struct tm timeinfo;
-		localtime_s(&timeinfo, &time);
-
-		// Write timestamp and message
-		m_logFile << std::put_time(&timeinfo, "[%Y-%m-%d %H:%M:%S") << '.' << std::setfill('0')
-				  << std::setw(3) << ms.count() << "] " << result_utf8;
-		m_logFile.flush();
-	}
+	// Colors, storage, log file
+	AppendItem(result_utf8);
 }
 
 /**
@@ -841,13 +1584,10 @@ void ConsoleWindow::AddLogW(const wchar_t* fmt, ...) {
 	vswprintf_s(wbuf, _countof(wbuf), fmt, args);
 	va_end(args);
 
-	// Convert wchar_t to ImWchar
-	ImWchar imwbuf[1024];
-	size_t	i = 0;
-	for (; i < 1023 && wbuf[i]; i++) { imwbuf[i] = (ImWchar)wbuf[i]; }
-	imwbuf[i] = 0;
-
-	Items.push_back(Wcsdup(imwbuf));
+	// Straight to UTF-8 for AppendItem()
+	char		 utf8[1024 * 3];
+	const size_t bytes = utf::WideToUtf8(wbuf, utf::Length(wbuf), utf8, sizeof(utf8));
+	AppendItem(std::string_view(utf8, bytes));
 }
 
 /**
@@ -956,7 +1696,8 @@ void ConsoleWindow::Render(const char* title, bool* p_open) {
 
 	// Options menu
 	if (ImGui::BeginPopup("Options")) {
-		ImGui::Checkbox("Auto-scroll", &AutoScroll);
+		bool autoScroll = cvars::ConsoleAutoScroll.Get();
+		if (ImGui::Checkbox("Auto-scroll", &autoScroll)) cvars::ConsoleAutoScroll.Set(autoScroll);
 
 		ImGui::Separator();
 		ImGui::Text("ImGui Debug Log Flags:");
@@ -1023,101 +1764,49 @@ void ConsoleWindow::Render(const char* title, bool* p_open) {
 		ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 1)); // Tighten spacing
 		if (copy_to_clipboard) ImGui::LogToClipboard();
 
-		// Persistent color state - maintains color across lines until reset
-		ImVec4 currentColor = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-		bool   colorActive	= false;
-
+		// Colors were resolved when the lines were added (AppendItem). The UTF-8
+		// copies go to the frame arena, rewound after every line, so lines of
+		// any length are shown in full without touching the heap.
+		FrameArena::HeapProbe	 probe(*m_frameArena);
+		const FrameArena::Marker mark = m_frameArena->Mark();
 		for (int i = 0; i < Items.Size; i++) {
-			const ImWchar* item = Items[i];
-			// Convert ImWchar to UTF-8 for display and filtering
-			char item_utf8[1024];
-			ImTextStrToUtf8(item_utf8, sizeof(item_utf8), item, nullptr);
-
-			if (!Filter.PassFilter(item_utf8)) continue;
-
-			// Check for color control tags
-			bool colorChanged = false;
+			const ConsoleItem&	   item		 = Items[i];
+			const std::string_view item_utf8 = m_frameArena->Utf8(item.Text, item.Length);
 
-			// Reset tag - clears color
-			if (strstr(item_utf8, "[reset]")) {
-				if (colorActive) {
-					ImGui::PopStyleColor();
-					colorActive = false;
-				}
-				currentColor = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-				colorChanged = true;
-			}
-			// Check for color tags
-			else if (strstr(item_utf8, "[error]") || strstr(item_utf8, "[red]")) {
-				currentColor = ImVec4(1.0f, 0.3f, 0.3f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[warning]") || strstr(item_utf8, "[yellow]")) {
-				currentColor = ImVec4(1.0f, 0.85f, 0.2f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[success]") || strstr(item_utf8, "[green]")) {
-				currentColor = ImVec4(0.3f, 1.0f, 0.3f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[info]") || strstr(item_utf8, "[blue]") ||
-					   strstr(item_utf8, "[cyan]")) {
-				currentColor = ImVec4(0.4f, 0.8f, 1.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[cmd]")) {
-				currentColor = ImVec4(0.6f, 1.0f, 0.6f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[history]") || strstr(item_utf8, "[magenta]")) {
-				currentColor = ImVec4(0.8f, 0.6f, 1.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[grey]")) {
-				currentColor = ImVec4(0.5f, 0.5f, 0.5f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[white]")) {
-				currentColor = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[bright_red]")) {
-				currentColor = ImVec4(1.0f, 0.0f, 0.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[bright_green]")) {
-				currentColor = ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[bright_yellow]")) {
-				currentColor = ImVec4(1.0f, 1.0f, 0.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[bright_blue]")) {
-				currentColor = ImVec4(0.0f, 0.5f, 1.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[bright_magenta]")) {
-				currentColor = ImVec4(1.0f, 0.0f, 1.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[bright_cyan]")) {
-				currentColor = ImVec4(0.0f, 1.0f, 1.0f, 1.0f);
-				colorChanged = true;
-			} else if (strstr(item_utf8, "[bright_white]")) {
-				currentColor = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-				colorChanged = true;
-			} else if (strncmp(item_utf8, "# ", 2) == 0) {
-				currentColor = ImVec4(1.0f, 0.8f, 0.4f, 1.0f);
-				colorChanged = true;
+			if (!Filter.PassFilter(item_utf8.data(), item_utf8.data() + item_utf8.size())) {
+				m_frameArena->Rewind(mark);
+				continue;
 			}
 
-			// Apply new color if changed
-			if (colorChanged && !strstr(item_utf8, "[reset]")) {
-				if (colorActive) { ImGui::PopStyleColor(); }
-				ImGui::PushStyleColor(ImGuiCol_Text, currentColor);
-				colorActive = true;
+			if (!item.Spans) {
+				if (item.Color) ImGui::PushStyleColor(ImGuiCol_Text, item.Color);
+				ImGui::TextUnformatted(item_utf8.data(), item_utf8.data() + item_utf8.size());
+				if (item.Color) ImGui::PopStyleColor();
+				m_frameArena->Rewind(mark);
+				continue;
 			}
 
-			ImGui::TextUnformatted(item_utf8);
-		}
+			// Several colors: one text run per span on the same line
+			for (int s = 0; s < item.SpanCount; s++) {
+				const ConsoleSpan&	   span = item.Spans[s];
+				const int			   end	= s + 1 < item.SpanCount ? item.Spans[s + 1].Begin : item.Length;
+				const std::string_view run	= m_frameArena->Utf8(item.Text + span.Begin, end - span.Begin);
 
-		// Pop color if still active at end of rendering
-		if (colorActive) { ImGui::PopStyleColor(); }
+				if (s > 0) ImGui::SameLine(0.0f, 0.0f);
+				if (span.Color) ImGui::PushStyleColor(ImGuiCol_Text, span.Color);
+				ImGui::TextUnformatted(run.data(), run.data() + run.size());
+				if (span.Color) ImGui::PopStyleColor();
+			}
+			m_frameArena->Rewind(mark);
+		}
 
 		if (copy_to_clipboard) ImGui::LogFinish();
 		if (copy_to_clipboard) ImGui::LogFinish();
 		// Keep up at the bottom of the scroll region if we were already at the bottom at the
 		// beginning of the frame. Using a scrollbar or mouse-wheel will take away from the bottom
 		// edge.
-		if (ScrollToBottom || (AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY()))
+		if (ScrollToBottom ||
+			(cvars::ConsoleAutoScroll.Get() && ImGui::GetScrollY() >= ImGui::GetScrollMaxY()))
 			ImGui::SetScrollHereY(1.0f);
 		ScrollToBottom = false;
 
@@ -1134,24 +1823,18 @@ void ConsoleWindow::Render(const char* title, bool* p_open) {
 
 	// Use ImGui's wide character input
 	char utf8_input[256 * 4]; // UTF-8 can be up to 4 bytes per character
-	ImTextStrToUtf8(utf8_input, sizeof(utf8_input), InputBuf, nullptr);
+	utf::WideToUtf8Cstr(InputBuf, utf8_input, sizeof(utf8_input));
 
 	if (ImGui::InputTextWithHint("##Input", "Type a command...", utf8_input,
 								 IM_ARRAYSIZE(utf8_input), input_text_flags, &TextEditCallbackStub,
 								 (void*)this)) {
 		// Convert back to ImWchar
-		ImTextStrFromUtf8(InputBuf, IM_ARRAYSIZE(InputBuf), utf8_input, nullptr);
+		utf::Utf8ToWideCstr(utf8_input, InputBuf, IM_ARRAYSIZE(InputBuf));
 
 		ImWchar* s = InputBuf;
 		Wcstrim(s);
-		if (s[0]) {
-			// Convert to UTF-8 for lowercase conversion
-			char temp_utf8[256];
-			ImTextStrToUtf8(temp_utf8, sizeof(temp_utf8), s, nullptr);
-			Helpers::charToLower(temp_utf8);
-			ImTextStrFromUtf8(InputBuf, IM_ARRAYSIZE(InputBuf), temp_utf8, nullptr);
-			ExecMyCommand(InputBuf);
-		}
+		// Command names are matched case-insensitively; arguments keep their case
+		if (s[0]) ExecMyCommand(s);
 		InputBuf[0]	  = 0;
 		reclaim_focus = true;
 	}
@@ -1212,21 +1895,9 @@ int ConsoleWindow::TextEditCallback(ImGuiInputTextCallbackData* data) {
 				word_start--;
 			}
 
-			// Build a list of candidates - convert ImWchar commands to UTF-8 for comparison
+			// Build a list of candidates (views of the interned command names)
 			ImVector<const char*> candidates;
-			ImVector<char*>		  candidate_utf8_storage; // Store converted strings temporarily
-
-			for (int i = 0; i < Commands.Size; i++) {
-				char* cmd_utf8 = (char*)ImGui::MemAlloc(256);
-				ImTextStrToUtf8(cmd_utf8, 256, Commands[i], nullptr);
-
-				if (Strnicmp(cmd_utf8, word_start, (int)(word_end - word_start)) == 0) {
-					candidates.push_back(cmd_utf8);
-					candidate_utf8_storage.push_back(cmd_utf8);
-				} else {
-					ImGui::MemFree(cmd_utf8);
-				}
-			}
+			CollectCompletions(word_start, word_end, candidates);
 
 			if (candidates.Size == 0) {
 				// No match
@@ -1264,32 +1935,27 @@ int ConsoleWindow::TextEditCallback(ImGuiInputTextCallbackData* data) {
 				for (int i = 0; i < candidates.Size; i++) AddLog("[cmd]   ▸ %s\n", candidates[i]);
 			}
 
-			// Clean up temporary UTF-8 strings
-			for (int i = 0; i < candidate_utf8_storage.Size; i++) {
-				ImGui::MemFree(candidate_utf8_storage[i]);
-			}
-
 			break;
 		}
 		case ImGuiInputTextFlags_CallbackHistory: {
 			// Example of HISTORY
 			const int prev_history_pos = HistoryPos;
 			if (data->EventKey == ImGuiKey_UpArrow) {
-				if (HistoryPos == -1) HistoryPos = History.Size - 1;
+				if (HistoryPos == -1) HistoryPos = (int)History.size() - 1;
 				else if (HistoryPos > 0) HistoryPos--;
 			} else if (data->EventKey == ImGuiKey_DownArrow) {
 				if (HistoryPos != -1)
-					if (++HistoryPos >= History.Size) HistoryPos = -1;
+					if (++HistoryPos >= (int)History.size()) HistoryPos = -1;
 			}
 
 			// A better implementation would preserve the data on the current input line along with
 			// cursor position.
 			if (prev_history_pos != HistoryPos) {
 				static const ImWchar empty_str[1] = {0};
-				const ImWchar* history_str = (HistoryPos >= 0) ? History[HistoryPos] : empty_str;
+				const ImWchar* history_str = (HistoryPos >= 0) ? History[HistoryPos].c_str() : empty_str;
 				// Convert ImWchar history to UTF-8 for ImGui input
 				char utf8_hist[256];
-				ImTextStrToUtf8(utf8_hist, sizeof(utf8_hist), history_str, nullptr);
+				utf::WideToUtf8Cstr(history_str, utf8_hist, sizeof(utf8_hist));
 				data->DeleteChars(0, data->BufTextLen);
 				data->InsertChars(0, utf8_hist);
 			}
@@ -1298,6 +1964,24 @@ int ConsoleWindow::TextEditCallback(ImGuiInputTextCallbackData* data) {
 	return 0;
 }
 
+/**
+ * @brief Collects the commands that start with the given word (case-insensitive).
+ *
+ *
+ * @param word_start Start of the partial word (UTF-8).
+ * @param word_end End of the partial
+ * word.
+ * @param out Receives the matching command names; they are interned (StringPool), so
+ * nothing needs to be freed.
+ */
+void ConsoleWindow::CollectCompletions(const char* word_start, const char* word_end,
+									   ImVector<const char*>& out) const {
+	for (int i = 0; i < Commands.Size; i++) {
+		if (utf::StartsWithNoCase(Commands[i].View(), std::string_view(word_start, word_end - word_start)))
+			out.push_back(Commands[i].c_str());
+	}
+}
+
 /**
  * @brief Case-insensitive string comparison (UTF-8).
  *
@@ -1308,12 +1992,7 @@ int ConsoleWindow::TextEditCallback(ImGuiInputTextCallbackData* data) {
  * > s2.
  */
 int ConsoleWindow::Stricmp(const char* s1, const char* s2) {
-	int d;
-	while ((d = toupper(*s2) - toupper(*s1)) == 0 && *s1) {
-		s1++;
-		s2++;
-	}
-	return d;
+	return utf::CompareNoCase(s1, s2);
 }
 
 /**
@@ -1326,12 +2005,7 @@ int ConsoleWindow::Stricmp(const char* s1, const char* s2) {
  * positive if s1 > s2.
  */
 int ConsoleWindow::Wcsicmp(const ImWchar* s1, const ImWchar* s2) {
-	int d;
-	while ((d = towupper(*s2) - towupper(*s1)) == 0 && *s1) {
-		s1++;
-		s2++;
-	}
-	return d;
+	return utf::CompareNoCaseWide(s1, utf::Length(s1), s2, utf::Length(s2));
 }
 
 /**
@@ -1341,17 +2015,12 @@ int ConsoleWindow::Wcsicmp(const ImWchar* s1, const ImWchar* s2) {
  * string to compare.
  * @param s2 Second string to compare.
  * @param n Maximum number of
- * characters to compare.
+ * code units to compare.
  * @return 0 if equal, negative if s1 < s2, positive if s1 > s2.
  */
 int ConsoleWindow::Strnicmp(const char* s1, const char* s2, int n) {
-	int d = 0;
-	while (n > 0 && (d = toupper(*s2) - toupper(*s1)) == 0 && *s1) {
-		s1++;
-		s2++;
-		n--;
-	}
-	return d;
+	return utf::CompareNoCase(std::string_view(s1, BoundedLength(s1, n)),
+							  std::string_view(s2, BoundedLength(s2, n)));
 }
 
 /**
@@ -1361,17 +2030,11 @@ int ConsoleWindow::Strnicmp(const char* s1, const char* s2, int n) {
  * wide string to compare.
  * @param s2 Second wide string to compare.
  * @param n Maximum number of
- * characters to compare.
+ * code units to compare.
  * @return 0 if equal, negative if s1 < s2, positive if s1 > s2.
  */
 int ConsoleWindow::Wcsnicmp(const ImWchar* s1, const ImWchar* s2, int n) {
-	int d = 0;
-	while (n > 0 && (d = towupper(*s2) - towupper(*s1)) == 0 && *s1) {
-		s1++;
-		s2++;
-		n--;
-	}
-	return d;
+	return utf::CompareNoCaseWide(s1, BoundedLength(s1, n), s2, BoundedLength(s2, n));
 }
 
 /**
@@ -1427,6 +2090,7 @@ size_t ConsoleWindow::Wcslen(const ImWchar* s) {
  */
 void ConsoleWindow::EnableFileLogging(bool enable) {
 	m_bEnableFileLogging = enable;
+	if (cvars::ConsoleFileLogging.Get() != enable) cvars::ConsoleFileLogging.Set(enable);
 
 	if (enable && !m_logFile.is_open()) {
 		// Open log file in append mode with UTF-8 encoding
@@ -0,0 +1,890 @@
+// ControlServer.cpp
+// Implementation of the local control endpoint (named pipe / Unix socket)
+
+#include "PCH.hpp"
+#include "Classes.hpp"
+#include "ControlServer.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace app {
+
+namespace {
+
+// Bytes requested per read from a client
+constexpr size_t kReadChunkSize = 16 * 1024;
+
+// A client sending this much without a newline is dropped
+constexpr size_t kMaxLineLength = 64 * 1024;
+
+// Commands run per Tick(); at 60 FPS this is ~15k commands per second
+constexpr uint32_t kMaxCommandsPerTick = 256;
+
+// Upper bound for Stop() to get pending I/O cancelled and the thread joined
+constexpr auto kStopTimeout = std::chrono::milliseconds(250);
+
+// Endpoint names come from a cvar and end up in a file path on POSIX, so
+// they are plain names: letters, digits, '_', '.' and '-'
+bool IsValidEndpointName(const std::string& name) {
+	if (name.empty() || name == "." || name == "..") return false;
+	return std::all_of(name.begin(), name.end(), [](char c) {
+		return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '.' || c == '-';
+	});
+}
+
+// Tells apart the temporary endpoints of several instances
+uint32_t CurrentProcessId() {
+#ifdef _WIN32
+	return GetCurrentProcessId();
+#else
+	return static_cast<uint32_t>(getpid());
+#endif
+}
+
+/**
+ * @brief Appends received bytes to a connection's line buffer and emits
+ *        every complete line
+ * @return false if the client exceeded kMaxLineLength
+ */
+template <typename Fn>
+bool SplitLines(std::string& inbox, const char* data, size_t size, Fn&& onLine) {
+	inbox.append(data, size);
+
+	size_t lineStart = 0;
+	for (;;) {
+		const size_t newline = inbox.find('\n', lineStart);
+		if (newline == std::string::npos) break;
+
+		size_t lineEnd = newline;
+		if (lineEnd > lineStart && inbox[lineEnd - 1] == '\r') lineEnd--;
+		if (lineEnd > lineStart) onLine(inbox.substr(lineStart, lineEnd - lineStart));
+		lineStart = newline + 1;
+	}
+	inbox.erase(0, lineStart);
+	return inbox.size() <= kMaxLineLength;
+}
+
+#ifdef _WIN32
+
+constexpr ULONG_PTR kWakeKey = 0;
+
+/**
+ * @brief One named pipe instance; the OVERLAPPED blocks must stay alive until
+ *        every operation issued on them has completed (pendingOps == 0)
+ */
+struct PipeConnection {
+	uint32_t	id		   = 0;
+	HANDLE		pipe	   = INVALID_HANDLE_VALUE;
+	OVERLAPPED	readOv	   = {}; // Also used for ConnectNamedPipe
+	OVERLAPPED	writeOv	   = {};
+	char		readBuf[kReadChunkSize];
+	std::string inbox;	 // Partial command line
+	std::string outbox;	 // Framed responses waiting for the current write
+	std::string writing; // Buffer owned by the in-flight WriteFile
+	bool		connected  = false;
+	bool		bWriting   = false;
+	bool		closing	   = false;
+	int			pendingOps = 0;
+};
+
+HANDLE CreatePipeInstance(const std::wstring& path, bool first) {
+	DWORD openMode = PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED;
+	if (first) openMode |= FILE_FLAG_FIRST_PIPE_INSTANCE; // Fails if another process owns the name
+
+	return CreateNamedPipeW(path.c_str(), openMode,
+							PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT |
+								PIPE_REJECT_REMOTE_CLIENTS,
+							PIPE_UNLIMITED_INSTANCES, static_cast<DWORD>(kReadChunkSize),
+							static_cast<DWORD>(kReadChunkSize), 0, nullptr);
+}
+
+void CloseConnection(PipeConnection& conn) {
+	if (conn.closing) return;
+	conn.closing = true;
+	// Pending operations complete with ERROR_OPERATION_ABORTED
+	CancelIoEx(conn.pipe, nullptr);
+}
+
+void IssueRead(PipeConnection& conn) {
+	if (conn.closing) return;
+	if (ReadFile(conn.pipe, conn.readBuf, static_cast<DWORD>(sizeof(conn.readBuf)), nullptr,
+				 &conn.readOv) ||
+		GetLastError() == ERROR_IO_PENDING) {
+		conn.pendingOps++; // A completion packet is queued either way
+	} else {
+		CloseConnection(conn);
+	}
+}
+
+void IssueWrite(PipeConnection& conn) {
+	if (conn.closing || conn.bWriting || conn.outbox.empty()) return;
+
+	conn.writing.swap(conn.outbox);
+	conn.outbox.clear();
+	if (WriteFile(conn.pipe, conn.writing.data(), static_cast<DWORD>(conn.writing.size()),
+				  nullptr, &conn.writeOv) ||
+		GetLastError() == ERROR_IO_PENDING) {
+		conn.pendingOps++;
+		conn.bWriting = true;
+	} else {
+		CloseConnection(conn);
+	}
+}
+
+/**
+ * @brief Starts waiting for the next client on a fresh pipe instance
+ * @return false if the instance could not be set up
+ */
+bool Listen(PipeConnection& conn, HANDLE iocp) {
+	if (!CreateIoCompletionPort(conn.pipe, iocp, conn.id, 0)) return false;
+
+	if (ConnectNamedPipe(conn.pipe, &conn.readOv)) return false; // Overlapped never succeeds here
+	switch (GetLastError()) {
+		case ERROR_IO_PENDING: conn.pendingOps++; return true;
+		case ERROR_PIPE_CONNECTED:
+			// Client raced us between create and connect; no packet is queued
+			conn.connected = true;
+			return true;
+		default: return false;
+	}
+}
+
+#endif
+
+} // namespace
+
+// ============================================================================
+// ControlServer
+// ============================================================================
+
+ControlServer::ControlServer(bool followCVar) :
+m_consoleWindow(nullptr),
+m_bFollowCVar(followCVar),
+m_serverThread(),
+m_bShouldStop(false),
+m_bListening(false),
+m_clientCount(0),
+m_endpoint(),
+m_endpointCVarVersion(0),
+m_requests(std::make_unique<RequestRing>()),
+m_requestBacklog(),
+m_responses(std::make_unique<ResponseRing>()),
+m_responseBacklog(),
+m_commandsServed(0),
+#ifdef _WIN32
+m_iocp(nullptr),
+m_firstPipe(INVALID_HANDLE_VALUE)
+#else
+m_listenSocket(-1),
+m_wakePipe{-1, -1}
+#endif
+{
+}
+
+ControlServer::~ControlServer() { Stop(); }
+
+HRESULT ControlServer::Alloc() {
+	m_consoleWindow = MemoryManagement::Get_MemoryManagement_Singleton()->Get<ConsoleWindow>();
+	return S_OK;
+}
+
+/**
+ * @brief Resolves dependencies and starts the endpoint named by the
+ *        'control_endpoint' cvar, if any
+ */
+void ControlServer::Open() {
+	Alloc();
+
+	m_endpointCVarVersion = cvars::ControlEndpoint.GetModificationCount();
+	const std::string name = cvars::ControlEndpoint.Get();
+	if (!name.empty()) Start(name);
+}
+
+/**
+ * @brief Runs commands received since the last frame and follows changes to
+ *        the 'control_endpoint' cvar
+ *
+ * Never blocks: at most kMaxCommandsPerTick commands run per call and
+ * responses that do not fit the ring are retried next frame.
+ */
+void ControlServer::Tick() {
+	if (ProcessRequests(kMaxCommandsPerTick) || !m_responseBacklog.empty()) Wake();
+
+	// 'set control_endpoint <name>' restarts the server; an empty name stops it
+	if (m_bFollowCVar && cvars::ControlEndpoint.GetModificationCount() != m_endpointCVarVersion) {
+		m_endpointCVarVersion  = cvars::ControlEndpoint.GetModificationCount();
+		const std::string name = cvars::ControlEndpoint.Get();
+		if (name.empty()) {
+			Stop();
+		} else if (name != m_endpoint || !IsListening()) {
+			Start(name);
+		}
+	}
+}
+
+void ControlServer::Close() { Stop(); }
+
+uint32_t ControlServer::ProcessRequests(uint32_t maxCommands) {
+	// Responses left over from a previous call go first to keep per-client order
+	while (!m_responseBacklog.empty() && m_responses->TryPush(std::move(m_responseBacklog.front())))
+		m_responseBacklog.pop_front();
+
+	uint32_t processed = 0;
+	Request	 request;
+	while (processed < maxCommands && m_requests->TryPop(request)) {
+		std::string output;
+		if (m_consoleWindow) m_consoleWindow->ExecRemoteCommand(request.line, output);
+
+		Response response{request.client, std::string()};
+		FrameResponse(output, response.text);
+		if (!m_responseBacklog.empty() || !m_responses->TryPush(std::move(response)))
+			m_responseBacklog.push_back(std::move(response));
+
+		processed++;
+	}
+
+	m_commandsServed += processed;
+	return processed;
+}
+
+void ControlServer::FrameResponse(const std::string& output, std::string& framed) {
+	framed.reserve(output.size() + 8);
+
+	size_t lineStart = 0;
+	while (lineStart < output.size()) {
+		size_t newline = output.find('\n', lineStart);
+		if (newline == std::string::npos) newline = output.size();
+
+		if (output[lineStart] == '.') framed.push_back('.');
+		framed.append(output, lineStart, newline - lineStart);
+		framed.push_back('\n');
+		lineStart = newline + 1;
+	}
+	framed.append(".\n");
+}
+
+void ControlServer::QueueRequest(uint32_t client, std::string&& line) {
+	if (m_requestBacklog.empty()) {
+		Request request{client, std::move(line)};
+		if (m_requests->TryPush(std::move(request))) return;
+		m_requestBacklog.push_back(std::move(request));
+		return;
+	}
+	m_requestBacklog.push_back(Request{client, std::move(line)});
+}
+
+void ControlServer::FlushRequestBacklog() {
+	while (!m_requestBacklog.empty() && m_requests->TryPush(std::move(m_requestBacklog.front())))
+		m_requestBacklog.pop_front();
+}
+
+std::string ControlServer::ResolveEndpoint(const std::string& name) {
+#ifdef _WIN32
+	return "\\\\.\\pipe\\" + name;
+#else
+	return "/tmp/" + name + ".sock";
+#endif
+}
+
+BenchResult ControlServer::MeasureRoundTrip(uint32_t iterations) {
+	using clock = std::chrono::steady_clock;
+
+	iterations			  = std::max(iterations, 1u);
+	const uint32_t warmup = std::clamp(iterations / 10, 1u, 1000u);
+
+	// Borrow a private endpoint when the user has none open
+	const bool temporary = !IsListening();
+	if (temporary &&
+		!Start("imgui_console_bench_" + std::to_string(CurrentProcessId())))
+		throw std::runtime_error("cannot open a temporary control endpoint");
+
+	std::vector<double> samples;
+	samples.reserve(iterations);
+	std::atomic<bool> done(false);
+	bool			  failed = false;
+
+	// Client on its own thread; the calling thread plays the main loop
+	std::thread client([&]() {
+		ControlClient connection;
+		if (!connection.Connect(m_endpoint)) {
+			failed = true;
+			done.store(true, std::memory_order_release);
+			return;
+		}
+		std::string output;
+		for (uint32_t i = 0; i < warmup + iterations; i++) {
+			const auto start = clock::now();
+			if (!connection.Execute("echo ping", output)) {
+				failed = true;
+				break;
+			}
+			const auto end = clock::now();
+			if (i >= warmup)
+				samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+		}
+		done.store(true, std::memory_order_release);
+	});
+
+	while (!done.load(std::memory_order_acquire)) {
+		if (ProcessRequests(kMaxCommandsPerTick))
+			Wake();
+		else
+			std::this_thread::yield();
+	}
+	client.join();
+
+	if (temporary) Stop();
+	if (failed) throw std::runtime_error("control endpoint round trip failed");
+
+	return Benchmark::FromSamples("ipc", samples, warmup, 0, 0);
+}
+
+#ifdef _WIN32
+
+bool ControlServer::Start(const std::string& name) {
+	Stop();
+
+	if (!IsValidEndpointName(name)) {
+		std::cerr << "ControlServer: invalid endpoint name '" << name << "'" << std::endl;
+		return false;
+	}
+
+	const std::string path = ResolveEndpoint(name);
+	const std::wstring wpath(path.begin(), path.end());
+
+	m_firstPipe = CreatePipeInstance(wpath, true);
+	if (m_firstPipe == INVALID_HANDLE_VALUE) {
+		std::cerr << "ControlServer: cannot create " << path << " (error " << GetLastError()
+				  << ")" << std::endl;
+		return false;
+	}
+
+	m_iocp = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+	if (!m_iocp) {
+		CloseHandle(m_firstPipe);
+		m_firstPipe = INVALID_HANDLE_VALUE;
+		return false;
+	}
+
+	m_endpoint	  = name;
+	m_bShouldStop = false;
+	m_bListening  = true;
+	m_serverThread = std::thread(&ControlServer::ServerThreadFunction, this);
+
+	std::cout << "Control endpoint listening on " << path << std::endl;
+	return true;
+}
+
+void ControlServer::Stop() {
+	if (m_serverThread.joinable()) {
+		m_bShouldStop = true;
+		Wake();
+		m_serverThread.join();
+	}
+
+	if (m_firstPipe != INVALID_HANDLE_VALUE) {
+		CloseHandle(m_firstPipe); // Thread never started
+		m_firstPipe = INVALID_HANDLE_VALUE;
+	}
+	if (m_iocp) {
+		CloseHandle(m_iocp);
+		m_iocp = nullptr;
+	}
+
+	// Drop anything still in flight; the clients are gone
+	m_requests = std::make_unique<RequestRing>();
+	m_responses = std::make_unique<ResponseRing>();
+	m_requestBacklog.clear();
+	m_responseBacklog.clear();
+	m_clientCount = 0;
+	m_bListening  = false;
+}
+
+void ControlServer::Wake() {
+	if (m_iocp) PostQueuedCompletionStatus(m_iocp, 0, kWakeKey, nullptr);
+}
+
+/**
+ * @brief I/O loop: one completion port for every pipe instance
+ *
+ * There is always exactly one instance waiting in ConnectNamedPipe; when a
+ * client takes it a new one is created. Completion keys are connection ids,
+ * key 0 is a wakeup from the main thread (responses ready or stop).
+ */
+void ControlServer::ServerThreadFunction() {
+	const std::string  path = ResolveEndpoint(m_endpoint);
+	const std::wstring wpath(path.begin(), path.end());
+
+	std::map<uint32_t, UPtr<PipeConnection>> connections;
+	uint32_t								 nextId	  = 1;
+	uint32_t								 listener = 0; // Id of the instance waiting for a client
+
+	auto addListener = [&](HANDLE pipe) {
+		auto conn  = std::make_unique<PipeConnection>();
+		conn->id   = nextId++;
+		conn->pipe = pipe;
+		if (conn->pipe == INVALID_HANDLE_VALUE || !Listen(*conn, m_iocp)) {
+			if (conn->pipe != INVALID_HANDLE_VALUE) CloseHandle(conn->pipe);
+			std::cerr << "ControlServer: cannot listen on " << path << std::endl;
+			listener = 0;
+			return;
+		}
+		listener = conn->id;
+		const bool connected = conn->connected;
+		connections[conn->id] = std::move(conn);
+		if (connected) {
+			// Handled as if the connect had completed
+			PipeConnection& c = *connections[listener];
+			m_clientCount++;
+			listener = 0;
+			IssueRead(c);
+		}
+	};
+
+	auto onConnected = [&](PipeConnection& conn) {
+		conn.connected = true;
+		m_clientCount++;
+		listener = 0;
+		IssueRead(conn);
+	};
+
+	HANDLE first = m_firstPipe;
+	m_firstPipe	 = INVALID_HANDLE_VALUE;
+	addListener(first);
+
+	OVERLAPPED_ENTRY entries[64];
+	while (!m_bShouldStop) {
+		if (!listener) addListener(CreatePipeInstance(wpath, false));
+
+		ULONG		count	= 0;
+		const DWORD timeout = m_requestBacklog.empty() ? INFINITE : 1;
+		if (!GetQueuedCompletionStatusEx(m_iocp, entries, IM_ARRAYSIZE(entries), &count, timeout,
+										 FALSE))
+			count = 0; // Timeout
+
+		for (ULONG i = 0; i < count; i++) {
+			const OVERLAPPED_ENTRY& entry = entries[i];
+			if (entry.lpCompletionKey == kWakeKey) continue;
+
+			auto it = connections.find(static_cast<uint32_t>(entry.lpCompletionKey));
+			if (it == connections.end()) continue;
+			PipeConnection& conn = *it->second;
+			conn.pendingOps--;
+
+			const bool	ok	  = entry.lpOverlapped->Internal == 0; // STATUS_SUCCESS
+			const DWORD bytes = entry.dwNumberOfBytesTransferred;
+
+			if (entry.lpOverlapped == &conn.readOv) {
+				if (!conn.connected) {
+					if (ok && !conn.closing) {
+						onConnected(conn);
+					} else {
+						listener = 0;
+						CloseConnection(conn);
+					}
+				} else if (ok && bytes > 0 && !conn.closing) {
+					const bool valid =
+						SplitLines(conn.inbox, conn.readBuf, bytes,
+								   [&](std::string&& line) { QueueRequest(conn.id, std::move(line)); });
+					if (valid)
+						IssueRead(conn);
+					else
+						CloseConnection(conn);
+				} else {
+					CloseConnection(conn); // Client hung up
+				}
+			} else if (entry.lpOverlapped == &conn.writeOv) {
+				conn.bWriting = false;
+				conn.writing.clear();
+				if (ok)
+					IssueWrite(conn);
+				else
+					CloseConnection(conn);
+			}
+		}
+
+		// Hand over commands that did not fit the ring earlier
+		FlushRequestBacklog();
+
+		// Route responses from the main thread to their connections
+		Response response;
+		while (m_responses->TryPop(response)) {
+			auto it = connections.find(response.client);
+			if (it == connections.end() || it->second->closing) continue; // Client left
+			it->second->outbox += response.text;
+			IssueWrite(*it->second);
+		}
+
+		// Free connections once the kernel is done with their OVERLAPPEDs
+		for (auto it = connections.begin(); it != connections.end();) {
+			PipeConnection& conn = *it->second;
+			if (conn.closing && conn.pendingOps == 0) {
+				if (conn.connected) m_clientCount--;
+				DisconnectNamedPipe(conn.pipe);
+				CloseHandle(conn.pipe);
+				it = connections.erase(it);
+			} else {
+				++it;
+			}
+		}
+	}
+
+	// Shutdown: cancel everything and wait (bounded) for the aborted completions
+	for (auto& [id, conn] : connections) CloseConnection(*conn);
+
+	const auto deadline = std::chrono::steady_clock::now() + kStopTimeout;
+	auto	   pending	= [&]() {
+		  for (auto& [id, conn] : connections)
+			  if (conn->pendingOps > 0) return true;
+		  return false;
+	};
+	while (pending() && std::chrono::steady_clock::now() < deadline) {
+		ULONG count = 0;
+		if (!GetQueuedCompletionStatusEx(m_iocp, entries, IM_ARRAYSIZE(entries), &count, 10, FALSE))
+			continue;
+		for (ULONG i = 0; i < count; i++) {
+			auto it = connections.find(static_cast<uint32_t>(entries[i].lpCompletionKey));
+			if (it != connections.end()) it->second->pendingOps--;
+		}
+	}
+
+	for (auto& [id, conn] : connections) {
+		CloseHandle(conn->pipe);
+		// Never free an OVERLAPPED the kernel may still write to
+		if (conn->pendingOps > 0) conn.release();
+	}
+}
+
+#else
+
+namespace {
+
+// Removes what a crashed instance left at path, but only if it is a socket
+void RemoveStaleSocket(const std::string& path) {
+	struct stat info{};
+	if (lstat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) unlink(path.c_str());
+}
+
+} // namespace
+
+bool ControlServer::Start(const std::string& name) {
+	Stop();
+
+	if (!IsValidEndpointName(name)) {
+		std::cerr << "ControlServer: invalid endpoint name '" << name << "'" << std::endl;
+		return false;
+	}
+
+	const std::string path = ResolveEndpoint(name);
+
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(address.sun_path)) return false;
+	std::copy(path.begin(), path.end(), address.sun_path); // Zero-initialised: stays terminated
+
+	m_listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (m_listenSocket < 0) return false;
+
+	RemoveStaleSocket(path); // From a crashed instance
+	if (bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+		listen(m_listenSocket, SOMAXCONN) != 0 || pipe(m_wakePipe) != 0) {
+		std::cerr << "ControlServer: cannot listen on " << path << std::endl;
+		close(m_listenSocket);
+		m_listenSocket = -1;
+		return false;
+	}
+	fcntl(m_listenSocket, F_SETFL, O_NONBLOCK);
+	fcntl(m_wakePipe[0], F_SETFL, O_NONBLOCK);
+
+	m_endpoint	   = name;
+	m_bShouldStop  = false;
+	m_bListening   = true;
+	m_serverThread = std::thread(&ControlServer::ServerThreadFunction, this);
+
+	std::cout << "Control endpoint listening on " << path << std::endl;
+	return true;
+}
+
+void ControlServer::Stop() {
+	if (m_serverThread.joinable()) {
+		m_bShouldStop = true;
+		Wake();
+		m_serverThread.join();
+	}
+
+	if (m_listenSocket >= 0) {
+		close(m_listenSocket);
+		RemoveStaleSocket(ResolveEndpoint(m_endpoint));
+		m_listenSocket = -1;
+	}
+	for (int& fd : m_wakePipe) {
+		if (fd >= 0) close(fd);
+		fd = -1;
+	}
+
+	m_requests	= std::make_unique<RequestRing>();
+	m_responses = std::make_unique<ResponseRing>();
+	m_requestBacklog.clear();
+	m_responseBacklog.clear();
+	m_clientCount = 0;
+	m_bListening  = false;
+}
+
+void ControlServer::Wake() {
+	if (m_wakePipe[1] >= 0) {
+		const char wake = 1;
+		(void)write(m_wakePipe[1], &wake, 1);
+	}
+}
+
+/**
+ * @brief I/O loop: poll() over the wake pipe, the listening socket and every
+ *        client; all descriptors are non-blocking
+ */
+void ControlServer::ServerThreadFunction() {
+	struct SocketConnection {
+		int			fd;
+		std::string inbox;
+		std::string outbox;
+	};
+
+	std::map<uint32_t, SocketConnection> connections;
+	uint32_t							 nextId = 1;
+	std::vector<pollfd>					 fds;
+	std::vector<uint32_t>				 ids; // Connection id for fds[2 + i]
+	char								 buf[kReadChunkSize];
+
+	while (!m_bShouldStop) {
+		fds.assign({{m_wakePipe[0], POLLIN, 0}, {m_listenSocket, POLLIN, 0}});
+		ids.clear();
+		for (auto& [id, conn] : connections) {
+			fds.push_back({conn.fd, static_cast<short>(POLLIN | (conn.outbox.empty() ? 0 : POLLOUT)),
+						   0});
+			ids.push_back(id);
+		}
+
+		const int timeout = m_requestBacklog.empty() ? -1 : 1;
+		if (poll(fds.data(), fds.size(), timeout) < 0 && errno != EINTR) break;
+
+		if (fds[0].revents & POLLIN) {
+			while (read(m_wakePipe[0], buf, sizeof(buf)) > 0) {}
+		}
+
+		if (fds[1].revents & POLLIN) {
+			for (int fd; (fd = accept(m_listenSocket, nullptr, nullptr)) >= 0;) {
+				fcntl(fd, F_SETFL, O_NONBLOCK);
+				connections[nextId++] = SocketConnection{fd, std::string(), std::string()};
+				m_clientCount++;
+			}
+		}
+
+		for (size_t i = 0; i < ids.size(); i++) {
+			const short		  revents = fds[2 + i].revents;
+			SocketConnection& conn	  = connections[ids[i]];
+			bool			  drop	  = (revents & (POLLERR | POLLNVAL)) != 0;
+
+			if (!drop && (revents & (POLLIN | POLLHUP))) {
+				for (;;) {
+					const ssize_t n = read(conn.fd, buf, sizeof(buf));
+					if (n > 0) {
+						const uint32_t id = ids[i];
+						if (!SplitLines(conn.inbox, buf, static_cast<size_t>(n),
+										[&](std::string&& line) { QueueRequest(id, std::move(line)); }))
+							drop = true;
+						continue;
+					}
+					if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+						drop = true;
+					break;
+				}
+			}
+
+			if (!drop && (revents & POLLOUT) && !conn.outbox.empty()) {
+				const ssize_t n = write(conn.fd, conn.outbox.data(), conn.outbox.size());
+				if (n > 0)
+					conn.outbox.erase(0, static_cast<size_t>(n));
+				else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+					drop = true;
+			}
+
+			if (drop) {
+				close(conn.fd);
+				connections.erase(ids[i]);
+				m_clientCount--;
+			}
+		}
+
+		FlushRequestBacklog();
+
+		Response response;
+		while (m_responses->TryPop(response)) {
+			auto it = connections.find(response.client);
+			if (it != connections.end()) it->second.outbox += response.text;
+		}
+	}
+
+	for (auto& [id, conn] : connections) close(conn.fd);
+}
+
+#endif
+
+// ============================================================================
+// ControlClient
+// ============================================================================
+
+#ifdef _WIN32
+
+ControlClient::ControlClient() : m_pipe(INVALID_HANDLE_VALUE), m_inbox() {}
+
+bool ControlClient::Connect(const std::string& name, uint32_t timeoutMs) {
+	Disconnect();
+
+	const std::string  path = ControlServer::ResolveEndpoint(name);
+	const std::wstring wpath(path.begin(), path.end());
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+	for (;;) {
+		m_pipe = CreateFileW(wpath.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+							 OPEN_EXISTING, 0, nullptr);
+		if (m_pipe != INVALID_HANDLE_VALUE) return true;
+
+		// Every instance busy: the server creates the next one right after a connect
+		if (GetLastError() != ERROR_PIPE_BUSY || std::chrono::steady_clock::now() >= deadline)
+			return false;
+		WaitNamedPipeW(wpath.c_str(), 50);
+	}
+}
+
+void ControlClient::Flush() {
+	// Returns once the server has read everything written so far
+	if (m_pipe != INVALID_HANDLE_VALUE) FlushFileBuffers(m_pipe);
+}
+
+void ControlClient::Disconnect() {
+	if (m_pipe != INVALID_HANDLE_VALUE) CloseHandle(m_pipe);
+	m_pipe = INVALID_HANDLE_VALUE;
+	m_inbox.clear();
+}
+
+bool ControlClient::IsConnected() const { return m_pipe != INVALID_HANDLE_VALUE; }
+
+bool ControlClient::WriteAll(const char* data, size_t size) {
+	while (size > 0) {
+		DWORD written = 0;
+		if (!WriteFile(m_pipe, data, static_cast<DWORD>(size), &written, nullptr)) return false;
+		data += written;
+		size -= written;
+	}
+	return true;
+}
+
+bool ControlClient::ReadSome() {
+	char  buf[kReadChunkSize];
+	DWORD read = 0;
+	if (!ReadFile(m_pipe, buf, static_cast<DWORD>(sizeof(buf)), &read, nullptr) || read == 0)
+		return false;
+	m_inbox.append(buf, read);
+	return true;
+}
+
+#else
+
+ControlClient::ControlClient() : m_socket(-1), m_inbox() {}
+
+bool ControlClient::Connect(const std::string& name, uint32_t) {
+	Disconnect();
+
+	const std::string path = ControlServer::ResolveEndpoint(name);
+	sockaddr_un		  address{};
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof(address.sun_path)) return false;
+	std::copy(path.begin(), path.end(), address.sun_path); // Zero-initialised: stays terminated
+
+	m_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (m_socket < 0) return false;
+	if (connect(m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+		Disconnect();
+		return false;
+	}
+	return true;
+}
+
+void ControlClient::Flush() {} // Data written to a socket is delivered even after close()
+
+void ControlClient::Disconnect() {
+	if (m_socket >= 0) close(m_socket);
+	m_socket = -1;
+	m_inbox.clear();
+}
+
+bool ControlClient::IsConnected() const { return m_socket >= 0; }
+
+bool ControlClient::WriteAll(const char* data, size_t size) {
+	while (size > 0) {
+		const ssize_t n = write(m_socket, data, size);
+		if (n < 0 && errno == EINTR) continue;
+		if (n <= 0) return false;
+		data += n;
+		size -= static_cast<size_t>(n);
+	}
+	return true;
+}
+
+bool ControlClient::ReadSome() {
+	char	buf[kReadChunkSize];
+	ssize_t n;
+	do {
+		n = read(m_socket, buf, sizeof(buf));
+	} while (n < 0 && errno == EINTR);
+	if (n <= 0) return false;
+	m_inbox.append(buf, static_cast<size_t>(n));
+	return true;
+}
+
+#endif
+
+ControlClient::~ControlClient() { Disconnect(); }
+
+bool ControlClient::Post(const std::string& command) {
+	if (!IsConnected()) return false;
+
+	std::string line = command;
+	line.push_back('\n');
+	return WriteAll(line.data(), line.size());
+}
+
+bool ControlClient::Execute(const std::string& command, std::string& output) {
+	output.clear();
+	if (!IsConnected()) return false;
+
+	std::string line = command;
+	line.push_back('\n');
+	if (!WriteAll(line.data(), line.size())) return false;
+
+	// Collect lines until the lone '.' terminator, undoing the dot-stuffing
+	size_t lineStart = 0;
+	for (;;) {
+		size_t newline;
+		while ((newline = m_inbox.find('\n', lineStart)) == std::string::npos) {
+			if (!ReadSome()) return false;
+		}
+
+		const std::string_view received(m_inbox.data() + lineStart, newline - lineStart);
+		lineStart = newline + 1;
+		if (received == ".") break;
+
+		output.append(received.substr(!received.empty() && received[0] == '.' ? 1 : 0));
+		output.push_back('\n');
+	}
+	m_inbox.erase(0, lineStart);
+	return true;
+}
+
+} // namespace app
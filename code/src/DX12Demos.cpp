@@ -2,6 +2,8 @@
 #include "Classes.hpp"
 #include "DX12Demos.hpp"
 
+#if APP_FEATURE_DEMO_WINDOWS // See Features.hpp
+
 namespace app {
 DxDemos::DxDemos() : m_io(nullptr) {}
 
@@ -32,3 +34,5 @@ void DxDemos::Tick() {
 
 void DxDemos::Close() {}
 }
+
+#endif // APP_FEATURE_DEMO_WINDOWS
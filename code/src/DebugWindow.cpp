@@ -1,22 +1,91 @@
 #include "PCH.hpp"
 
 #include "DebugWindow.hpp"
+#include "MemoryManagement.hpp"
+#include "FrameArena.hpp"
+#include "PoolAllocator.hpp"
+#include "App.hpp"
+#include "TickScheduler.hpp"
+#include "EventBus.hpp"
+#include "JobSystem.hpp"
+#include <psapi.h>
 
 namespace app {
 
+namespace {
+
+#if APP_MEMORY_TAGS
+// Live memory per MemTag: a table sortable by any column, then the history as lines
+void DrawMemoryTags(const SizeClassPool::Stats& stats) {
+	constexpr ImGuiTableFlags kTableFlags =
+		ImGuiTableFlags_Sortable | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+	if (ImGui::BeginTable("##memtags", 3, kTableFlags)) {
+		ImGui::TableSetupColumn("Subsystem");
+		ImGui::TableSetupColumn("Live KiB", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableSetupColumn("Blocks", ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableHeadersRow();
+
+		uint32_t order[kMemTagCount];
+		for (uint32_t i = 0; i < kMemTagCount; i++) order[i] = i;
+
+		// Sorted every frame: the values move and there are only a handful of rows
+		const ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs();
+		if (specs && specs->SpecsCount > 0) {
+			const ImGuiTableColumnSortSpecs& spec = specs->Specs[0];
+			std::sort(order, order + kMemTagCount, [&](uint32_t a, uint32_t b) {
+				int compare;
+				switch (spec.ColumnIndex) {
+				case 0: compare = std::strcmp(MemTagName(MemTag(a)), MemTagName(MemTag(b))); break;
+				case 1: compare = (stats.tagBytes[a] > stats.tagBytes[b]) - (stats.tagBytes[a] < stats.tagBytes[b]); break;
+				default: compare = (stats.tagBlocks[a] > stats.tagBlocks[b]) - (stats.tagBlocks[a] < stats.tagBlocks[b]); break;
+				}
+				return spec.SortDirection == ImGuiSortDirection_Ascending ? compare < 0 : compare > 0;
+			});
+		}
+
+		for (uint32_t i : order) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(MemTagName(MemTag(i)));
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f", stats.tagBytes[i] / 1024.0);
+			ImGui::TableNextColumn();
+			ImGui::Text("%lld", static_cast<long long>(stats.tagBlocks[i]));
+		}
+		ImGui::EndTable();
+	}
+
+#if APP_FEATURE_IMPLOT
+	const PoolAllocator::TagHistory& history = PoolAllocator::GetTagHistory();
+	if (history.count < 2) return;
+
+	MemTagScope tag(MemTag::ImPlot);
+	if (ImPlot::BeginPlot("##memtags_history", ImVec2(-1, 200))) {
+		ImPlot::SetupAxes("s", "KiB", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+		const int offset = history.count == PoolAllocator::TagHistory::kPoints ? history.next : 0;
+		for (uint32_t i = 0; i < kMemTagCount; i++)
+			ImPlot::PlotLine(MemTagName(MemTag(i)), history.time, history.kib[i], history.count, 0, offset);
+		ImPlot::EndPlot();
+	}
+#endif
+}
+#endif
+
+} // namespace
 
 DebugWindow::DebugWindow()
 : m_io(nullptr),
+#if APP_FEATURE_PROCESS_LAUNCHER
   tPsTHread{},
   tPyTHread{},
   bPsOpen(false),
   bPyOpen(false),
   hPsProcessHandle(nullptr),
   hPyProcessHandle(nullptr),
-  m_memory(nullptr)
+#endif
+  m_shown(nullptr),
+  m_frameArena(nullptr)
   {
-    m_memory = MemoryManagement::Get_MemoryManagement_Singleton();
-
   }
 
 void DebugWindow::GetIo(ImGuiIO* io) {
@@ -27,27 +96,108 @@ void DebugWindow::GetIo(ImGuiIO* io) {
 
 
 DebugWindow::~DebugWindow() {
-
+#if APP_FEATURE_PROCESS_LAUNCHER
 	if (tPsTHread.joinable()) { tPsTHread.detach(); }
 	if (tPyTHread.joinable()) { tPyTHread.detach(); }
 	bPsOpen			 = false;
 	bPyOpen			 = false;
 	hPsProcessHandle = nullptr;
 	hPyProcessHandle = nullptr;
-    m_memory = nullptr;
+#endif
 }
 
 void DebugWindow::Render() {
 
-	ImGui::Begin("Debug Window!", &m_memory->m_bShow_Debug_window); // Create a m_window called "Hello, world!"
+	ImGui::Begin("Debug Window!", m_shown); // Create a m_window called "Hello, world!"
 	// and append into it.
 
 	ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / m_io->Framerate,
 				m_io->Framerate);
+	ImGui::Text("Working set %.1f MB, private %.1f MB",
+				s_workingSetBytes.load(std::memory_order_relaxed) / (1024.0 * 1024.0),
+				s_privateBytes.load(std::memory_order_relaxed) / (1024.0 * 1024.0));
+
+	// Last frame's transient strings; overflows go to 0 once the buffers have grown
+	const FrameArena::FrameStats& arena = m_frameArena->GetLastFrameStats();
+	ImGui::Text("Frame arena: %.1f of %.1f KiB, %u overflows", arena.peakBytes / 1024.0,
+				arena.capacity / 1024.0, arena.overflows);
+#ifdef _DEBUG
+	ImGui::Text("Heap allocations in arena paths: %llu", static_cast<unsigned long long>(arena.heapAllocs));
+#endif
+
+	// ImGui::MemAlloc pools; unused is what the size classes round up plus free blocks
+	if (PoolAllocator::IsInstalled() && ImGui::CollapsingHeader("ImGui allocator")) {
+		const PoolAllocator::Snapshot pool = PoolAllocator::GetSnapshot();
+		const double reserved = static_cast<double>(pool.totals.reservedBytes);
+		ImGui::Text("Live %.1f KiB, peak %.1f KiB, reserved %.1f KiB (%.1f%% unused)",
+					pool.totals.liveBytes / 1024.0, pool.peakLiveBytes / 1024.0, reserved / 1024.0,
+					reserved > 0.0 ? 100.0 * (1.0 - pool.totals.liveBytes / reserved) : 0.0);
+		ImGui::Text("%.0f allocs/s, %llu allocs, %llu frees, %u pools", pool.allocsPerSecond,
+					static_cast<unsigned long long>(pool.totals.allocs),
+					static_cast<unsigned long long>(pool.totals.frees), pool.pools);
+
+		float histogram[SizeClassPool::kClassCount + 1];
+		for (uint32_t i = 0; i <= SizeClassPool::kClassCount; i++)
+			histogram[i] = static_cast<float>(pool.totals.histogram[i]);
+		ImGui::PlotHistogram("##sizes", histogram, IM_ARRAYSIZE(histogram), 0,
+							 "Allocations per size class (32 B .. 32 KiB, large)", 0.0f, FLT_MAX, ImVec2(0, 80));
+#if APP_MEMORY_TAGS
+		DrawMemoryTags(pool.totals);
+#endif
+	}
+
+	// Cost of everything the scheduler runs, background thread included
+	if (ImGui::CollapsingHeader("Tick scheduler")) {
+		constexpr ImGuiTableFlags kTableFlags =
+			ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+		if (ImGui::BeginTable("##ticks", 7, kTableFlags)) {
+			for (const char* column : {"Entry", "Phase", "Period", "Runs", "Last us", "Avg us", "Max us"})
+				ImGui::TableSetupColumn(column);
+			ImGui::TableHeadersRow();
+
+			for (const TickScheduler::Timing& timing : App::GetInstance()->GetScheduler().GetTimings()) {
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(timing.name);
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(TickPhaseName(timing.phase));
+				ImGui::TableNextColumn();
+				if (timing.periodMs) ImGui::Text("%u ms", timing.periodMs);
+				else ImGui::TextUnformatted("frame");
+				ImGui::TableNextColumn();
+				ImGui::Text("%llu", static_cast<unsigned long long>(timing.runs));
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", timing.lastUs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", timing.runs ? timing.totalUs / timing.runs : 0.0);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", timing.maxUs);
+			}
+			ImGui::EndTable();
+		}
+
+		const EventBus::Stats events = EventBus::Get_EventBus_Singleton()->GetStats();
+		ImGui::Text("Events: %llu published, %llu from other threads, %llu past a full queue",
+					static_cast<unsigned long long>(events.published), static_cast<unsigned long long>(events.queued),
+					static_cast<unsigned long long>(events.overflowed));
+
+		const JobSystem::Stats jobs = JobSystem::Get_JobSystem_Singleton()->GetStats();
+		ImGui::Text("Jobs: %u workers, %llu run, %llu stolen, %llu failed", jobs.workers,
+					static_cast<unsigned long long>(jobs.executed), static_cast<unsigned long long>(jobs.stolen),
+					static_cast<unsigned long long>(jobs.failed));
+	}
 
 	if (ImGui::Button("Debug Break")) __debugbreak(); // this is proposital!
 
+#if APP_FEATURE_PROCESS_LAUNCHER
+	RenderLauncher();
+#endif
 
+	ImGui::End();
+}
+
+#if APP_FEATURE_PROCESS_LAUNCHER
+void DebugWindow::RenderLauncher() {
 	if (bPsOpen) {
 		ig::SameLine();
 		ImGui::TextColored(ImVec4(0, 1, 0, 1), "PowerShell open");
@@ -67,21 +217,36 @@ void DebugWindow::Render() {
 	} else {
 		if (ImGui::Button("Open Python")) { openPyTherad(); }
 	}
-
-	ImGui::End();
 }
+#endif
 
 void DebugWindow::Open() {
- }
+	MemoryManagement* memory = MemoryManagement::Get_MemoryManagement_Singleton();
+	m_io					 = memory->Get_ImGuiIO();
+	m_shown					 = &memory->m_bShow_Debug_window;
+	m_frameArena			 = memory->Get<FrameArena>();
+}
+
+void DebugWindow::SampleProcessMemory() {
+	PROCESS_MEMORY_COUNTERS_EX counters{};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters),
+							 sizeof(counters))) {
+		s_workingSetBytes.store(counters.WorkingSetSize, std::memory_order_relaxed);
+		s_privateBytes.store(counters.PrivateUsage, std::memory_order_relaxed);
+	}
+}
 
 void DebugWindow::Tick() {
 	Render();
+#if APP_FEATURE_PROCESS_LAUNCHER
 	if (tPsTHread.joinable()) { tPsTHread.detach(); }
 	if (tPyTHread.joinable()) { tPyTHread.detach(); }
+#endif
 }
 
-void DebugWindow::Close() { this->~DebugWindow(); }
+void DebugWindow::Close() {}
 
+#if APP_FEATURE_PROCESS_LAUNCHER
 void DebugWindow::openPowershell() {
 
 
@@ -103,6 +268,9 @@ void DebugWindow::openPowershell() {
 		CloseHandle(pi.hProcess);
 		this->hPsProcessHandle = NULL;
 		this->bPsOpen		   = false;
+	} else {
+		// Nothing was started (e.g. not on PATH); let the button try again
+		this->bPsOpen = false;
 	}
 }
 
@@ -124,8 +292,11 @@ void DebugWindow::openPy() {
 		// Limpeza
 		CloseHandle(pi.hThread);
 		CloseHandle(pi.hProcess);
-		this->hPsProcessHandle = NULL;
+		this->hPyProcessHandle = NULL;
 		this->bPyOpen		   = false;
+	} else {
+		// Nothing was started (e.g. not on PATH); let the button try again
+		this->bPyOpen = false;
 	}
 }
 
@@ -143,8 +314,8 @@ void DebugWindow::openPowershellTherad() {
 	// &DebugWindow::openPowershell -> O endereço do método
 	// this -> A instância atual da classe para a qual o método será chamado
 	if (!tPsTHread.joinable() && !bPsOpen) {
+		bPsOpen	  = true; // Before the thread starts, so its failure path wins
 		tPsTHread = std::thread(&DebugWindow::openPowershell, this);
-		bPsOpen	  = true;
 	}
 }
 
@@ -161,8 +332,8 @@ void DebugWindow::openPyTherad() {
 	// &DebugWindow::openPowershell -> O endereço do método
 	// this -> A instância atual da classe para a qual o método será chamado
 	if (!tPyTHread.joinable() && !bPyOpen) {
+		bPyOpen	  = true; // Before the thread starts, so its failure path wins
 		tPyTHread = std::thread(&DebugWindow::openPy, this);
-		bPyOpen	  = true;
 	}
 }
 
@@ -174,4 +345,6 @@ bool DebugWindow::IsPsProcessRunning() {
 	if (GetExitCodeProcess(hPsProcessHandle, &exitCode)) { return (exitCode == STILL_ACTIVE); }
 	return false;
 }
+#endif // APP_FEATURE_PROCESS_LAUNCHER
+
 } // namespace app
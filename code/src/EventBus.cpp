@@ -0,0 +1,84 @@
+// EventBus.cpp
+// Implementation of the typed publish/subscribe bus
+
+#include "PCH.hpp"
+#include "EventBus.hpp"
+
+namespace app {
+
+EventBus* EventBus::Get_EventBus_Singleton() {
+	static EventBus instance;
+	return &instance;
+}
+
+EventBus::EventBus() :
+m_mainThread(),
+m_subscribers(),
+m_delivering(0),
+m_queue(),
+m_overflowMutex(),
+m_overflow(),
+m_hasOverflow(false),
+m_published(0),
+m_queued(0),
+m_overflowed(0) {}
+
+void EventBus::BindToCurrentThread() { m_mainThread.store(std::this_thread::get_id(), std::memory_order_release); }
+
+void EventBus::AddSubscriber(size_t index, void* object, void (*call)(void*, const void*)) {
+	IM_ASSERT(std::this_thread::get_id() == m_mainThread.load(std::memory_order_relaxed) && "Subscribe() on the main thread");
+	IM_ASSERT(m_delivering == 0 && "Subscribe() from inside a subscriber");
+	m_subscribers[index].push_back(Subscriber{object, call});
+}
+
+void EventBus::Unsubscribe(const void* object) {
+	IM_ASSERT(m_delivering == 0 && "Unsubscribe() from inside a subscriber");
+	for (std::vector<Subscriber>& subscribers : m_subscribers) {
+		std::erase_if(subscribers, [object](const Subscriber& subscriber) { return subscriber.object == object; });
+	}
+}
+
+void EventBus::Deliver(size_t index, const void* event) {
+	// A subscriber may publish in turn; that nests and is delivered right away too
+	++m_delivering;
+	for (const Subscriber& subscriber : m_subscribers[index]) subscriber.call(subscriber.object, event);
+	--m_delivering;
+}
+
+void EventBus::Enqueue(Event&& event) {
+	m_queued.fetch_add(1, std::memory_order_relaxed);
+
+	if (!m_hasOverflow.load(std::memory_order_acquire) && m_queue.TryPush(std::move(event))) return;
+
+	// Full, or an earlier event of this thread may be waiting in the overflow
+	std::lock_guard<std::mutex> lock(m_overflowMutex);
+	m_overflow.push_back(std::move(event));
+	m_hasOverflow.store(true, std::memory_order_release);
+	m_overflowed.fetch_add(1, std::memory_order_relaxed);
+}
+
+void EventBus::Dispatch() {
+	auto deliver = [this](const Event& event) {
+		std::visit([this, &event](const auto& typed) { Deliver(event.index(), &typed); }, event);
+	};
+
+	Event event;
+	while (m_queue.TryPop(event)) deliver(event);
+
+	// Everything in the overflow is newer than what the ring held
+	if (!m_hasOverflow.load(std::memory_order_acquire)) return;
+	std::vector<Event> overflow;
+	{
+		std::lock_guard<std::mutex> lock(m_overflowMutex);
+		overflow.swap(m_overflow);
+		m_hasOverflow.store(false, std::memory_order_release);
+	}
+	for (const Event& queued : overflow) deliver(queued);
+}
+
+EventBus::Stats EventBus::GetStats() const {
+	return Stats{m_published.load(std::memory_order_relaxed), m_queued.load(std::memory_order_relaxed),
+				 m_overflowed.load(std::memory_order_relaxed)};
+}
+
+} // namespace app
@@ -3,11 +3,34 @@
 
 #include "PCH.hpp"		   // Include precompiled header
 #include "FontManager.hpp" // Include our class declaration
+#include "Utf.hpp"
+#include "EventBus.hpp"
+#include "JobSystem.hpp"
 namespace app {
 
 // Namespace alias for shorter code - 'fs' now refers to std::filesystem
 namespace fs = std::filesystem;
 
+namespace {
+
+// Files loaded at startup by App::SetupImGui() and LoadFonts()
+constexpr const char* kSystemFontFiles[] = {
+	"C:\\Windows\\Fonts\\segoeui.ttf",
+	"C:\\Windows\\Fonts\\seguiemj.ttf",
+	"C:\\Windows\\Fonts\\arial.ttf",
+	"C:\\Windows\\Fonts\\consola.ttf",
+	"C:\\Windows\\Fonts\\cour.ttf",
+	"C:\\Windows\\Fonts\\tahoma.ttf",
+	"C:\\Windows\\Fonts\\verdana.ttf",
+	"C:\\Windows\\Fonts\\times.ttf",
+	"C:\\Windows\\Fonts\\calibri.ttf",
+	"C:\\Windows\\Fonts\\comic.ttf",
+	"C:\\Windows\\Fonts\\georgia.ttf",
+	"C:\\Windows\\Fonts\\trebuc.ttf",
+};
+
+} // namespace
+
 // ============================================================================
 // CONSTRUCTORS AND DESTRUCTOR
 // ============================================================================
@@ -16,7 +39,10 @@ namespace fs = std::filesystem;
 FontManager::FontManager()
 : m_io(nullptr),		  // ImGuiIO pointer set to null
   m_defaultFont(nullptr), // Default font pointer set to null
-  m_loadedFonts({})		  // Initialize empty vector of font pointers
+  m_loadedFonts({}),		  // Initialize empty vector of font pointers
+  m_fontMap(),
+  m_fontIndex(),
+  m_fileCache()
 {}
 
 void FontManager::GetIo(ImGuiIO* io) {
@@ -44,91 +70,94 @@ FontManager::~FontManager() {}
 
 // LoadFonts - Enhanced implementation with common Windows fonts
 void FontManager::LoadFonts() {
+	MemTagScope	 tag(MemTag::Fonts);
+	const size_t loadedBefore = m_loadedFonts.size();
+
 	// Load common Windows system fonts for variety
 	
 	// Segoe UI - Modern Windows UI font with emoji support
 	// First load the base font
-	ImFont* segoeUI = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\segoeui.ttf", 16.0f);
+	ImFont* segoeUI = AddFontFile("C:\\Windows\\Fonts\\segoeui.ttf", 16.0f);
 	if (segoeUI != nullptr) {
 		m_loadedFonts.push_back(segoeUI);
-		m_fontMap["Segoe UI"] = segoeUI;
+		MapFont("Segoe UI", segoeUI);
 		
 		// Merge emoji font into Segoe UI for emoji support
 		ImFontConfig config;
 		config.MergeMode = true;
 		config.GlyphMinAdvanceX = 16.0f; // Make icons monospaced
 		static const ImWchar icon_ranges[] = { 0x1F300, 0x1F9FF, 0 }; // Emoji range
-		m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\seguiemj.ttf", 16.0f, &config, icon_ranges);
+		AddFontFile("C:\\Windows\\Fonts\\seguiemj.ttf", 16.0f, &config, icon_ranges);
 	}
 	
 	// Arial - Classic sans-serif
-	ImFont* arial = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\arial.ttf", 16.0f);
+	ImFont* arial = AddFontFile("C:\\Windows\\Fonts\\arial.ttf", 16.0f);
 	if (arial != nullptr) {
 		m_loadedFonts.push_back(arial);
-		m_fontMap["Arial"] = arial;
+		MapFont("Arial", arial);
 	}
 	
 	// Consolas - Popular monospace font for code
-	ImFont* consolas = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\consola.ttf", 16.0f);
+	ImFont* consolas = AddFontFile("C:\\Windows\\Fonts\\consola.ttf", 16.0f);
 	if (consolas != nullptr) {
 		m_loadedFonts.push_back(consolas);
-		m_fontMap["Consolas"] = consolas;
+		MapFont("Consolas", consolas);
 	}
 	
 	// Courier New - Classic monospace
-	ImFont* courierNew = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\cour.ttf", 16.0f);
+	ImFont* courierNew = AddFontFile("C:\\Windows\\Fonts\\cour.ttf", 16.0f);
 	if (courierNew != nullptr) {
 		m_loadedFonts.push_back(courierNew);
-		m_fontMap["Courier New"] = courierNew;
+		MapFont("Courier New", courierNew);
 	}
 	
 	// Tahoma - Compact sans-serif
-	ImFont* tahoma = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\tahoma.ttf", 16.0f);
+	ImFont* tahoma = AddFontFile("C:\\Windows\\Fonts\\tahoma.ttf", 16.0f);
 	if (tahoma != nullptr) {
 		m_loadedFonts.push_back(tahoma);
-		m_fontMap["Tahoma"] = tahoma;
+		MapFont("Tahoma", tahoma);
 	}
 	
 	// Verdana - Clear, readable font
-	ImFont* verdana = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\verdana.ttf", 16.0f);
+	ImFont* verdana = AddFontFile("C:\\Windows\\Fonts\\verdana.ttf", 16.0f);
 	if (verdana != nullptr) {
 		m_loadedFonts.push_back(verdana);
-		m_fontMap["Verdana"] = verdana;
+		MapFont("Verdana", verdana);
 	}
 	
 	// Times New Roman - Classic serif
-	ImFont* timesNewRoman = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\times.ttf", 16.0f);
+	ImFont* timesNewRoman = AddFontFile("C:\\Windows\\Fonts\\times.ttf", 16.0f);
 	if (timesNewRoman != nullptr) {
 		m_loadedFonts.push_back(timesNewRoman);
-		m_fontMap["Times New Roman"] = timesNewRoman;
+		MapFont("Times New Roman", timesNewRoman);
 	}
 	
 	// Calibri - Modern, clean font
-	ImFont* calibri = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\calibri.ttf", 16.0f);
+	ImFont* calibri = AddFontFile("C:\\Windows\\Fonts\\calibri.ttf", 16.0f);
 	if (calibri != nullptr) {
 		m_loadedFonts.push_back(calibri);
-		m_fontMap["Calibri"] = calibri;
+		MapFont("Calibri", calibri);
 	}
 	
 	// Comic Sans MS - Casual font
-	ImFont* comicSans = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\comic.ttf", 16.0f);
+	ImFont* comicSans = AddFontFile("C:\\Windows\\Fonts\\comic.ttf", 16.0f);
 	if (comicSans != nullptr) {
 		m_loadedFonts.push_back(comicSans);
-		m_fontMap["Comic Sans MS"] = comicSans;
+		MapFont("Comic Sans MS", comicSans);
 	}
 	
 	// Georgia - Elegant serif
-	ImFont* georgia = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\georgia.ttf", 16.0f);
+	ImFont* georgia = AddFontFile("C:\\Windows\\Fonts\\georgia.ttf", 16.0f);
 	if (georgia != nullptr) {
 		m_loadedFonts.push_back(georgia);
-		m_fontMap["Georgia"] = georgia;
+		MapFont("Georgia", georgia);
 	}
 	
 	// Trebuchet MS - Modern humanist font
-	ImFont* trebuchet = m_io->Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\trebuc.ttf", 16.0f);
+	ImFont* trebuchet = AddFontFile("C:\\Windows\\Fonts\\trebuc.ttf", 16.0f);
 	if (trebuchet != nullptr) {
 		m_loadedFonts.push_back(trebuchet);
-		m_fontMap["Trebuchet MS"] = trebuchet;
+		MapFont("Trebuchet MS", trebuchet);
 	}
 	
 	// Add Proggy Clean (ImGui's built-in default) for consistency
@@ -137,8 +166,43 @@ void FontManager::LoadFonts() {
 	ImFont* proggy = m_io->Fonts->AddFontDefault(&config);
 	if (proggy != nullptr) {
 		m_loadedFonts.push_back(proggy);
-		m_fontMap["Proggy Clean"] = proggy;
+		MapFont("Proggy Clean", proggy);
+	}
+
+	PublishLoaded(static_cast<int>(m_loadedFonts.size() - loadedBefore));
+}
+
+void FontManager::PreloadFontFiles() {
+	for (const char* path : kSystemFontFiles) {
+		std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+		if (!file.is_open()) continue; // AddFontFile() falls back to ImGui, which reports it
+
+		const std::streamsize size = file.tellg();
+		if (size <= 0) continue;
+
+		TaggedVector<uint8_t, MemTag::Fonts> bytes(static_cast<size_t>(size));
+		file.seekg(0);
+		if (file.read(reinterpret_cast<char*>(bytes.data()), size)) m_fileCache[path] = std::move(bytes);
+	}
+}
+
+ImFont* FontManager::AddFontFile(const char* path, float sizePixels, const ImFontConfig* config,
+								 const ImWchar* ranges) {
+	MemTagScope tag(MemTag::Fonts);
+	auto		cached = m_fileCache.find(path);
+	if (cached == m_fileCache.end()) return m_io->Fonts->AddFontFromFileTTF(path, sizePixels, config, ranges);
+
+	ImFontConfig fontConfig = config ? *config : ImFontConfig();
+	fontConfig.FontDataOwnedByAtlas = false; // m_fileCache keeps the bytes alive
+	if (fontConfig.Name[0] == '\0') {
+		// Same name AddFontFromFileTTF() would give it
+		const std::string fileName = fs::path(path).filename().string();
+		std::snprintf(fontConfig.Name, sizeof(fontConfig.Name), "%s, %.0fpx", fileName.c_str(), sizePixels);
 	}
+
+	auto& bytes = cached->second;
+	return m_io->Fonts->AddFontFromMemoryTTF(bytes.data(), static_cast<int>(bytes.size()), sizePixels,
+											 &fontConfig, ranges);
 }
 
 // ============================================================================
@@ -149,7 +213,8 @@ void FontManager::LoadFonts() {
 // @param folderPath: String path to the folder to scan
 // @return: Integer count of successfully loaded fonts
 int FontManager::LoadFontsFromFolder(const std::string& folderPath) {
-	int loadedCount = 0; // Counter for successfully loaded fonts
+	MemTagScope tag(MemTag::Fonts);
+	int			loadedCount = 0; // Counter for successfully loaded fonts
 
 	// Check if the provided path exists in the filesystem
 	if (!fs::exists(folderPath)) {
@@ -188,7 +253,7 @@ int FontManager::LoadFontsFromFolder(const std::string& folderPath) {
 	}
 
 	// Return total number of fonts successfully loaded
-	return loadedCount;
+	return PublishLoaded(loadedCount);
 }
 
 // LoadFontsFromFolderRecursive - Scans folder and optionally all subfolders
@@ -196,7 +261,8 @@ int FontManager::LoadFontsFromFolder(const std::string& folderPath) {
 // @param recursive: Boolean flag - if true, scans all subdirectories
 // @return: Integer count of successfully loaded fonts
 int FontManager::LoadFontsFromFolderRecursive(const std::string& folderPath, bool recursive) {
-	int loadedCount = 0; // Counter for successfully loaded fonts
+	MemTagScope tag(MemTag::Fonts);
+	int			loadedCount = 0; // Counter for successfully loaded fonts
 
 	// Validate that the path exists and is a directory
 	if (!fs::exists(folderPath)) {
@@ -246,7 +312,7 @@ int FontManager::LoadFontsFromFolderRecursive(const std::string& folderPath, boo
 		}
 	}
 
-	return loadedCount; // Return total fonts loaded
+	return PublishLoaded(loadedCount); // Return total fonts loaded
 }
 
 // ============================================================================
@@ -257,7 +323,8 @@ int FontManager::LoadFontsFromFolderRecursive(const std::string& folderPath, boo
 // @param folderPath: String path to the folder to scan
 // @return: Integer count of successfully loaded fonts
 int FontManager::LoadFontsFromFolderToMap(const std::string& folderPath) {
-	int loadedCount = 0; // Counter for successfully loaded fonts
+	MemTagScope tag(MemTag::Fonts);
+	int			loadedCount = 0; // Counter for successfully loaded fonts
 
 	// Validate that the provided path exists in the filesystem
 	if (!fs::exists(folderPath)) {
@@ -293,7 +360,7 @@ int FontManager::LoadFontsFromFolderToMap(const std::string& folderPath) {
 				if (loadedFont != nullptr) {
 					// Add to both vector and map
 					m_loadedFonts.push_back(loadedFont);
-					m_fontMap[fontName] = loadedFont; // Store in map with name as key
+					MapFont(fontName, loadedFont); // Store in map with name as key
 
 					loadedCount++; // Increment our success counter
 				}
@@ -302,7 +369,7 @@ int FontManager::LoadFontsFromFolderToMap(const std::string& folderPath) {
 	}
 
 	// Return total number of fonts successfully loaded
-	return loadedCount;
+	return PublishLoaded(loadedCount);
 }
 
 // LoadFontsFromFolderRecursiveToMap - Scans folder recursively and loads into map
@@ -310,7 +377,8 @@ int FontManager::LoadFontsFromFolderToMap(const std::string& folderPath) {
 // @param recursive: Boolean flag - if true, scans all subdirectories
 // @return: Integer count of successfully loaded fonts
 int FontManager::LoadFontsFromFolderRecursiveToMap(const std::string& folderPath, bool recursive) {
-	int loadedCount = 0; // Counter for successfully loaded fonts
+	MemTagScope tag(MemTag::Fonts);
+	int			loadedCount = 0; // Counter for successfully loaded fonts
 
 	// Validate that the path exists and is a directory
 	if (!fs::exists(folderPath)) {
@@ -341,7 +409,7 @@ int FontManager::LoadFontsFromFolderRecursiveToMap(const std::string& folderPath
 					if (loadedFont != nullptr) {
 						// Add to both vector and map
 						m_loadedFonts.push_back(loadedFont);
-						m_fontMap[fontName] = loadedFont;
+						MapFont(fontName, loadedFont);
 
 						loadedCount++; // Count successful load
 					}
@@ -362,7 +430,7 @@ int FontManager::LoadFontsFromFolderRecursiveToMap(const std::string& folderPath
 
 					if (loadedFont != nullptr) {
 						m_loadedFonts.push_back(loadedFont);
-						m_fontMap[fontName] = loadedFont;
+						MapFont(fontName, loadedFont);
 						loadedCount++;
 					}
 				}
@@ -370,7 +438,7 @@ int FontManager::LoadFontsFromFolderRecursiveToMap(const std::string& folderPath
 		}
 	}
 
-	return loadedCount; // Return total fonts loaded
+	return PublishLoaded(loadedCount); // Return total fonts loaded
 }
 
 // ============================================================================
@@ -382,12 +450,7 @@ int FontManager::LoadFontsFromFolderRecursiveToMap(const std::string& folderPath
 // @return: true if file has font extension, false otherwise
 bool FontManager::IsFontFile(const std::filesystem::path& path) const {
 	// Get the file extension (includes the dot, e.g., ".ttf")
-	std::string extension = path.extension().string();
-
-	// Convert extension to lowercase for case-insensitive comparison
-	// This handles .TTF, .ttf, .TtF, etc. all the same way
-	std::transform(extension.begin(), extension.end(), extension.begin(),
-				   [](unsigned char c) { return std::tolower(c); });
+	const std::wstring extension = path.extension().wstring();
 
 	// Check if extension matches any valid font format
 	// Common font extensions:
@@ -395,10 +458,11 @@ bool FontManager::IsFontFile(const std::filesystem::path& path) const {
 	// .otf  = OpenType Font
 	// .ttc  = TrueType Collection
 	// .dfont = Mac OS X Data Fork Font
-	return extension == ".ttf" || // TrueType Font
-		   extension == ".otf" || // OpenType Font
-		   extension == ".ttc" || // TrueType Collection
-		   extension == ".dfont"; // Data Fork Font
+	// Compared case-insensitively: .TTF, .ttf, .TtF, etc. all match
+	return utf::EqualsNoCase(extension, L".ttf") || // TrueType Font
+		   utf::EqualsNoCase(extension, L".otf") || // OpenType Font
+		   utf::EqualsNoCase(extension, L".ttc") || // TrueType Collection
+		   utf::EqualsNoCase(extension, L".dfont"); // Data Fork Font
 }
 
 // ExtractFontName - Extracts the font name from a file path (removes extension)
@@ -481,36 +545,8 @@ std::string FontManager::OpenFontFileDialog(HWND hwnd) const {
 	// Show the Open File Dialog
 	// GetOpenFileNameW returns TRUE if user selected a file, FALSE if cancelled
 	if (GetOpenFileNameW(&ofn) == TRUE) {
-		// User selected a file - convert wide string to regular string
-
-		// Get the length of the wide string
-		int sizeNeeded = WideCharToMultiByte(CP_UTF8, // Convert to UTF-8 encoding
-											 0,		  // No special flags
-											 szFile,  // Source wide string
-											 -1,	  // -1 means string is null-terminated
-											 NULL,	  // NULL means we're just calculating size
-											 0,		  // Size is 0 when calculating
-											 NULL,	  // No default character
-											 NULL);	  // No flag for unmappable characters
-
-		// Create a string with the calculated size
-		std::string result(sizeNeeded, 0); // Initialize with null characters
-
-		// Perform the actual conversion from wide string to UTF-8
-		WideCharToMultiByte(CP_UTF8,	// Convert to UTF-8
-							0,			// No special flags
-							szFile,		// Source wide string
-							-1,			// Null-terminated
-							&result[0], // Destination buffer
-							sizeNeeded, // Size of destination buffer
-							NULL,		// No default character
-							NULL);		// No flag for unmappable characters
-
-		// Remove the null terminator that WideCharToMultiByte added
-		result.resize(sizeNeeded - 1);
-
-		// Return the selected file path
-		return result;
+		// User selected a file - return its path as UTF-8
+		return utf::ToUtf8(szFile);
 	}
 
 	// User cancelled the dialog - return empty string
@@ -591,33 +627,8 @@ std::string FontManager::OpenFolderBrowserDialog(HWND hwnd) const {
 		// Convert PIDL to actual file system path
 		// SHGetPathFromIDListW converts the PIDL to a readable path string
 		if (SHGetPathFromIDListW(pidl, szFolder)) {
-			// Successfully got the path - convert wide string to regular string
-
-			// Calculate size needed for conversion
-			int sizeNeeded = WideCharToMultiByte(CP_UTF8,  // Convert to UTF-8
-												 0,		   // No special flags
-												 szFolder, // Source wide string
-												 -1,	   // Null-terminated
-												 NULL,	   // Just calculating size
-												 0,		   // Size is 0 when calculating
-												 NULL,	   // No default character
-												 NULL);	   // No flag for unmappable characters
-
-			// Create string with calculated size
-			std::string result(sizeNeeded, 0);
-
-			// Perform actual conversion
-			WideCharToMultiByte(CP_UTF8,	// Convert to UTF-8
-								0,			// No special flags
-								szFolder,	// Source wide string
-								-1,			// Null-terminated
-								&result[0], // Destination buffer
-								sizeNeeded, // Size of destination
-								NULL,		// No default character
-								NULL);		// No flag for unmappable characters
-
-			// Remove null terminator
-			result.resize(static_cast<size_t>(sizeNeeded - 1));
+			// Successfully got the path - convert it to UTF-8
+			std::string result = utf::ToUtf8(szFolder);
 
 			// Free the PIDL m_memory allocated by SHBrowseForFolderW
 			// This is important to prevent m_memory leaks
@@ -636,10 +647,20 @@ std::string FontManager::OpenFolderBrowserDialog(HWND hwnd) const {
 	return "";
 }
 
+// PublishLoaded - Tells the subscribers of FontLoaded about a finished load
+// @param count: Fonts the load added (nothing is published for 0)
+// @return: count, so loaders can end with return PublishLoaded(loadedCount)
+int FontManager::PublishLoaded(int count) {
+	if (count > 0) EventBus::Get_EventBus_Singleton()->Publish(FontLoaded{count});
+	return count;
+}
+
 // LoadSingleFont - Safely loads a single font file and adds to loaded fonts vector
 // @param fontPath: String path to the font file
 // @return: Pointer to loaded ImFont, or nullptr if loading failed
 ImFont* FontManager::LoadSingleFont(const std::string& fontPath) {
+	MemTagScope tag(MemTag::Fonts);
+
 	// Attempt to load the font using ImGui's font loading function
 	// This function returns nullptr if the file cannot be loaded
 	ImFont* font = m_io->Fonts->AddFontFromFileTTF(fontPath.c_str());
@@ -673,6 +694,7 @@ void FontManager::CleanupFonts() {
 
 	// Clear the map, removing all font name -> pointer mappings
 	m_fontMap.clear();
+	m_fontIndex.clear();
 }
 
 // ============================================================================
@@ -716,12 +738,15 @@ const std::map<std::string, ImFont*>& FontManager::GetFontMap() const { return m
 // @param fontName: String name of the font to find (e.g., "arial")
 // @return: Pointer to ImFont if found, nullptr if not found
 ImFont* FontManager::GetFontByName(const std::string& fontName) const {
-	// Try to find the font name in the map
-	// std::map::find returns an iterator to the element if found
-	auto it = m_fontMap.find(fontName);
+	// A name that was never interned cannot be a font name; no string compares
+	const uint32_t id = StringPool::Get_StringPool_Singleton()->Find(fontName);
+	if (id == StringPool::kInvalidId) return nullptr;
+
+	// Look the interned id up in the index kept next to m_fontMap
+	auto it = m_fontIndex.find(id);
 
 	// Check if the font was found
-	if (it != m_fontMap.end()) {
+	if (it != m_fontIndex.end()) {
 		// Font found - return the pointer (second element of the pair)
 		return it->second;
 	}
@@ -730,6 +755,14 @@ ImFont* FontManager::GetFontByName(const std::string& fontName) const {
 	return nullptr;
 }
 
+// MapFont - Adds a font to m_fontMap and to the id index GetFontByName() uses
+// @param name: Font name, interned once here
+// @param font: Pointer to the loaded ImFont
+void FontManager::MapFont(const std::string& name, ImFont* font) {
+	m_fontMap[name]					 = font;
+	m_fontIndex[StrId(name).GetId()] = font;
+}
+
 // GetFontCount - Returns the number of loaded fonts
 // @return: Size of the loaded fonts vector
 size_t FontManager::GetFontCount() const { return m_loadedFonts.size(); }
@@ -976,90 +1009,48 @@ std::map<std::string, FontManager::FontInfo> FontManager::SearchFontsWithInfoAsM
 	// Return the map containing font name -> FontInfo mappings
 	return fontInfoMap;
 }
-// SearchFontsWithInfoAsMap - Searches for fonts and returns detailed info as map
-// Key is the font name (without extension), value is FontInfo structure
+// SearchFontsInFolderAsMap - Searches for font files and maps their names to paths
+// Runs as a job from the Font Manager window, so it stops early when the pool does
 // @param folderPath: String path to the folder to search
 // @param recursive: Boolean flag - if true, searches all subdirectories
-// @return: Map where key is font name and value is FontInfo with details
+// @return: Map where key is font name (without extension) and value is full path
 std::map<std::string, std::string> FontManager::SearchFontsInFolderAsMap(
 	const std::string& folderPath, bool recursive) const {
 
-	// Create an empty map to store font name -> FontInfo mappings
-	std::map<std::string, std::string> fontInfoMap;
-	return fontInfoMap;
-	/*
-    // Validate that the provided path exists
-    if (!fs::exists(folderPath)) {
-        return fontInfoMap;  // Return empty map
-    }
-    
-    // Validate that the path is a directory
-    if (!fs::is_directory(folderPath)) {
-        return fontInfoMap;  // Return empty map
-    }
-    
-    // Choose iterator based on recursive flag
-    if (recursive) {
-        // Recursive search through all subdirectories
-        for (const auto& entry : fs::recursive_directory_iterator(folderPath)) {
-            if (entry.is_regular_file()) {
-                const fs::path& filePath = entry.path();
-                
-                // Check if this is a font file
-                if (IsFontFile(filePath)) {
-                    // Create FontInfo structure
-                    FontInfo info;
-                    
-                    // Populate with file information
-                    info.fullPath = filePath.string();
-                    info.fileName = filePath.filename().string();
-                    info.fontName = ExtractFontName(filePath);
-                    info.extension = filePath.extension().string();
-                    
-                    // Get file size with error handling
-                    std::error_code ec;
-                    info.fileSize = fs::file_size(filePath, ec);
-                    if (ec) {
-                        info.fileSize = 0;  // Set to 0 on error
-                    }
-                    
-                    // Add to map using font name as key
-                    // If font name already exists, this will overwrite it
-                    fontInfoMap[info.fontName] = info;
-                }
-            }
-        }
-    } else {
-        // Non-recursive search
-        for (const auto& entry : fs::directory_iterator(folderPath)) {
-            if (entry.is_regular_file()) {
-                const fs::path& filePath = entry.path();
-                
-                if (IsFontFile(filePath)) {
-                    // Create and populate FontInfo
-                    FontInfo info;
-                    info.fullPath = filePath.string();
-                    info.fileName = filePath.filename().string();
-                    info.fontName = ExtractFontName(filePath);
-                    info.extension = filePath.extension().string();
-                    
-                    // Get file size
-                    std::error_code ec;
-                    info.fileSize = fs::file_size(filePath, ec);
-                    if (ec) {
-                        info.fileSize = 0;
-                    }
-                    
-                    // Add to map
-                    fontInfoMap[info.fontName] = info;
-                }
-            }
-        }
-    }
-    
-    // Return the map containing font name -> FontInfo mappings
-    return fontInfoMap;
-    */
+	// Create an empty map to store font name -> path mappings
+	std::map<std::string, std::string> fontPathMap;
+
+	// Validate that the provided path exists and is a directory
+	if (!fs::exists(folderPath) || !fs::is_directory(folderPath)) {
+		return fontPathMap; // Return empty map
+	}
+
+	// Adds one entry if it is a font file
+	// If font name already exists, this will overwrite it
+	auto addFont = [this, &fontPathMap](const fs::directory_entry& entry) {
+		if (entry.is_regular_file() && IsFontFile(entry.path())) {
+			fontPathMap[ExtractFontName(entry.path())] = entry.path().string();
+		}
+	};
+
+	// A search cut short by the exit is never shown
+	const JobSystem* jobs = JobSystem::Get_JobSystem_Singleton();
+
+	// Choose iterator based on recursive flag
+	if (recursive) {
+		for (const auto& entry : fs::recursive_directory_iterator(folderPath)) {
+			if (jobs->IsStopping()) break;
+			addFont(entry);
+		}
+	} else {
+		for (const auto& entry : fs::directory_iterator(folderPath)) {
+			if (jobs->IsStopping()) break;
+			addFont(entry);
+		}
+	}
+
+	// Return the map containing font name -> path mappings
+	return fontPathMap;
 }
 
 // ============================================================================
@@ -1070,20 +1061,21 @@ std::map<std::string, std::string> FontManager::SearchFontsInFolderAsMap(
 // These fonts are embedded in ImGui and always available
 // @return: Number of default fonts loaded
 int FontManager::LoadImGuiDefaultFonts() {
-	int loadedCount = 0;
+	MemTagScope tag(MemTag::Fonts);
+	int			loadedCount = 0;
 
 	// Load default ImGui font (ProggyClean.ttf, 13px)
 	ImFont* defaultFont = m_io->Fonts->AddFontDefault();
 	if (defaultFont != nullptr) {
 		m_loadedFonts.push_back(defaultFont);
-		m_fontMap["Default"] = defaultFont;
+		MapFont("Default", defaultFont);
 		loadedCount++;
 	}
 
 	// You can add more built-in fonts here if ImGui provides them
 	// For now, ImGui only has the default ProggyClean font built-in
 
-	return loadedCount;
+	return PublishLoaded(loadedCount);
 }
 
 // LoadWindowsFonts - Optionally loads fonts from Windows Fonts folder
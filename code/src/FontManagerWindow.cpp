@@ -1,5 +1,7 @@
 #include "PCH.hpp"
 #include "Classes.hpp"
+
+#if APP_FEATURE_FONT_MANAGER_UI // See Features.hpp
 namespace app {
 
 FontManagerWindow::FontManagerWindow()
@@ -12,14 +14,13 @@ FontManagerWindow::FontManagerWindow()
   m_totalFontsLoaded(0),	// Zero fonts loaded+
   bShowFontPreview(false),
   bFonstsWereLoaded(false),
-  m_memory(nullptr)
+  m_shown(nullptr),
+  m_searching(false)		// No folder search running
   {
   }
 
 
 void FontManagerWindow::GetAux(HWND hwnd, FontManager* fontManager) {
-    m_memory = MemoryManagement::Get_MemoryManagement_Singleton();
-
 	GetHwnd(hwnd);
 	GetFontManager(fontManager);
 }
@@ -34,7 +35,14 @@ void FontManagerWindow::GetHwnd(HWND hwnd) {
 	else throw std::runtime_error("hwnd is nullptr");
 }
 
-void FontManagerWindow::Open() {}
+// Created the first time the window is shown (see LazyPanel.hpp), when the
+// main window and the font manager have long been set up
+void FontManagerWindow::Open() {
+	MemoryManagement* memory = MemoryManagement::Get_MemoryManagement_Singleton();
+	GetAux(memory->Get<WindowManager>()->GetHWND(), memory->Get<FontManager>());
+	m_shown = &memory->m_bShow_FontManager_window;
+	EventBus::Get_EventBus_Singleton()->Subscribe<FontLoaded, &FontManagerWindow::OnFontLoaded>(this);
+}
 
 void FontManagerWindow::Tick() {
     Render();
@@ -45,11 +53,12 @@ void FontManagerWindow::Close() {}
 
 FontManagerWindow::~FontManagerWindow() {
 
+	EventBus::Get_EventBus_Singleton()->Unsubscribe(this);
+
 	m_fontManager = nullptr;
 	m_selectedFilePath.clear();
 	m_selectedFolderPath.clear();
 	m_statusMessage.clear();
-    m_memory = nullptr;
 }
 
 
@@ -57,7 +66,7 @@ void FontManagerWindow::Render() {
 	// Begin a new ImGui m_window
 	// "Font Manager Demo" is the m_window title
 	// The m_window is resizable and can be moved
-	ImGui::Begin("Font Manager Demo", &m_memory->m_bShow_FontManager_window);
+	ImGui::Begin("Font Manager Demo", m_shown);
 
 	ImGui::Checkbox("Show font preview", &bShowFontPreview);
 
@@ -115,7 +124,7 @@ void FontManagerWindow::Render() {
 			// Check if font loaded successfully
 			if (loadedFont != nullptr) {
 				m_statusMessage = "Successfully loaded font!";
-				m_totalFontsLoaded++;
+				EventBus::Get_EventBus_Singleton()->Publish(FontLoaded{1});
 			} else {
 				m_statusMessage = "ERROR: Failed to load font!";
 			}
@@ -166,8 +175,6 @@ void FontManagerWindow::Render() {
 
 				// Update status with number of fonts loaded
 				m_statusMessage = "Loaded " + std::to_string(loaded) + " fonts from folder";
-				m_totalFontsLoaded += loaded;
-				m_fontsLoaded	  = true;
 				bFonstsWereLoaded = true;
 			}
 
@@ -179,19 +186,34 @@ void FontManagerWindow::Render() {
 					m_fontManager->LoadFontsFromFolderRecursiveToMap(m_selectedFolderPath, true);
 
 				m_statusMessage = "Loaded " + std::to_string(loaded) + " fonts recursively";
-				m_totalFontsLoaded += loaded;
-				m_fontsLoaded	  = true;
 				bFonstsWereLoaded = true;
 			}
 
 			// Button to search fonts without loading
+			// The folder is walked by a job; the count comes back on the main thread
+			ImGui::BeginDisabled(m_searching);
 			if (ImGui::Button("Search Fonts (Don't Load)") && bFonstsWereLoaded) {
-				// Search for fonts but don't load them into m_memory
-				std::map<std::string, std::string> foundFonts =
-					m_fontManager->SearchFontsInFolderAsMap(m_selectedFolderPath, false);
-
-				m_statusMessage = "Found " + std::to_string(foundFonts.size()) + " font files";
+				JobSystem* jobs = JobSystem::Get_JobSystem_Singleton();
+				m_searching		= true;
+				m_statusMessage = "Searching " + m_selectedFolderPath + "...";
+
+				jobs->Schedule([this, jobs, fontManager = m_fontManager, folder = m_selectedFolderPath]() {
+					std::string message;
+					try {
+						// Search for fonts but don't load them into m_memory
+						const std::map<std::string, std::string> foundFonts =
+							fontManager->SearchFontsInFolderAsMap(folder, false);
+						message = "Found " + std::to_string(foundFonts.size()) + " font files";
+					} catch (const std::exception& e) {
+						message = std::string("ERROR: Font search failed: ") + e.what();
+					}
+					jobs->RunOnMainThread([this, message]() {
+						m_statusMessage = message;
+						m_searching		= false;
+					});
+				});
 			}
+			ImGui::EndDisabled();
 		}
 	}
 
@@ -209,6 +231,10 @@ void FontManagerWindow::Render() {
 
 	// Display total count of loaded fonts
 	ImGui::Text("Total fonts in m_memory: %zu", m_fontManager->GetFontMap().size());
+	if (m_fontsLoaded) {
+		ImGui::SameLine();
+		ImGui::TextDisabled("(%d loaded since this window was opened)", m_totalFontsLoaded);
+	}
 
 	// Create a child m_window with scrollbar for font list
 	// This creates a scrollable area to display all loaded fonts
@@ -278,6 +304,12 @@ void FontManagerWindow::Render() {
 	ImGui::End();
 }
 
+// Counts the loads made while the window exists, by it or by anyone else
+void FontManagerWindow::OnFontLoaded(const FontLoaded& event) {
+	m_totalFontsLoaded += event.count;
+	m_fontsLoaded = true;
+}
+
 void FontManagerWindow::RenderFontPreview() {
 	// Create a separate m_window to preview loaded fonts
 	ImGui::Begin("Font Preview");
@@ -347,3 +379,5 @@ void FontManagerWindow::RenderFontPreview() {
 //}
 
 } // namespace app
+
+#endif // APP_FEATURE_FONT_MANAGER_UI
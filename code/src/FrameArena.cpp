@@ -0,0 +1,177 @@
+// FrameArena.cpp
+// Implementation of the per-frame linear allocator
+
+#include "PCH.hpp"
+#include "FrameArena.hpp"
+#include "Benchmark.hpp"
+#include "MemoryTags.hpp"
+#include "Utf.hpp"
+
+namespace app {
+
+FrameArena::HeapProbe::HeapProbe(FrameArena& arena)
+#ifdef _DEBUG
+: m_arena(arena), m_start(Benchmark::GetThreadAllocCount())
+#endif
+{
+	(void)arena;
+}
+
+FrameArena::HeapProbe::~HeapProbe() {
+#ifdef _DEBUG
+	m_arena.m_frame.heapAllocs += Benchmark::GetThreadAllocCount() - m_start;
+#endif
+}
+
+FrameArena::FrameArena() : m_buffers{}, m_current(0), m_used(0), m_frame{}, m_lastFrame{} {}
+
+FrameArena::~FrameArena() {
+	FreeBlocks(m_buffers[0]);
+	FreeBlocks(m_buffers[1]);
+}
+
+void FrameArena::BeginFrame() {
+	m_lastFrame = m_frame;
+	m_current ^= 1;
+	m_used = 0;
+
+	Block*& buffer = m_buffers[m_current];
+	if (buffer && buffer->next) {
+		// Overflowed two frames ago: one block that holds all of it from now on
+		size_t total = 0;
+		for (const Block* block = buffer; block; block = block->next) total += block->size;
+		FreeBlocks(buffer);
+		buffer = NewBlock(std::bit_ceil(total));
+	} else if (buffer) {
+		buffer->used = 0;
+	}
+
+	m_frame			 = FrameStats{};
+	m_frame.capacity = buffer ? buffer->size : 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+	Block* block = m_buffers[m_current];
+	for (;;) {
+		if (block) {
+			const uintptr_t base   = reinterpret_cast<uintptr_t>(block + 1);
+			const size_t	offset = ((base + block->used + alignment - 1) & ~(uintptr_t(alignment) - 1)) - base;
+			if (offset + bytes <= block->size) {
+				m_used += offset + bytes - block->used;
+				block->used = offset + bytes;
+				if (m_used > m_frame.peakBytes) m_frame.peakBytes = m_used;
+				return reinterpret_cast<char*>(base + offset);
+			}
+			m_frame.overflows++;
+		}
+
+		// A block at least as large as the last one, so overflows stay rare
+		const size_t size = std::max(bytes + alignment, block ? block->size : kInitialBytes);
+		Block*		 fresh = NewBlock(size);
+		fresh->next		   = block;
+		block			   = fresh;
+		m_buffers[m_current] = fresh;
+	}
+}
+
+FrameArena::Marker FrameArena::Mark() const {
+	const Block* block = m_buffers[m_current];
+	return Marker{m_buffers[m_current], block ? block->used : 0, m_used};
+}
+
+void FrameArena::Rewind(const Marker& mark) {
+	Block* block = m_buffers[m_current];
+	if (mark.block != block) return; // Overflowed since; BeginFrame() reclaims it
+	if (block) block->used = mark.blockUsed;
+	m_used = mark.used;
+}
+
+void FrameArena::Trim(char* ptr, size_t size, size_t newSize) {
+	Block* block = m_buffers[m_current];
+	IM_ASSERT(ptr + size == reinterpret_cast<char*>(block + 1) + block->used);
+	block->used -= size - newSize;
+	m_used -= size - newSize;
+}
+
+const char* FrameArena::Printf(const char* fmt, ...) {
+	va_list args;
+	va_start(args, fmt);
+
+	// Usually fits the space left in the block, which needs a single pass
+	if (Block* block = m_buffers[m_current]) {
+		char*		 dst	   = reinterpret_cast<char*>(block + 1) + block->used;
+		const size_t available = block->size - block->used;
+		va_list		 copy;
+		va_copy(copy, args);
+		const int length = std::vsnprintf(dst, available, fmt, copy);
+		va_end(copy);
+		if (length >= 0 && size_t(length) < available) {
+			va_end(args);
+			return static_cast<char*>(Allocate(size_t(length) + 1, 1));
+		}
+	}
+
+	va_list copy;
+	va_copy(copy, args);
+	const int length = std::vsnprintf(nullptr, 0, fmt, copy);
+	va_end(copy);
+	if (length < 0) {
+		va_end(args);
+		return "";
+	}
+
+	char* text = static_cast<char*>(Allocate(size_t(length) + 1, 1));
+	std::vsnprintf(text, size_t(length) + 1, fmt, args);
+	va_end(args);
+	return text;
+}
+
+std::string_view FrameArena::Concat(std::initializer_list<std::string_view> parts) {
+	size_t length = 0;
+	for (std::string_view part : parts) length += part.size();
+
+	char* text = static_cast<char*>(Allocate(length + 1, 1));
+	char* out  = text;
+	for (std::string_view part : parts) {
+		std::memcpy(out, part.data(), part.size());
+		out += part.size();
+	}
+	*out = '\0';
+	return std::string_view(text, length);
+}
+
+template <typename Unit>
+std::string_view FrameArena::Utf8(const Unit* text, size_t length) {
+	// Worst case up front and the rest given back: one pass over the text
+	constexpr size_t kMaxBytesPerUnit = sizeof(Unit) == 2 ? 3 : 4;
+	const size_t	 capacity		  = length * kMaxBytesPerUnit + 1;
+
+	char*		 utf8  = static_cast<char*>(Allocate(capacity, 1));
+	const size_t bytes = utf::WideToUtf8(text, length, utf8, capacity - 1);
+	utf8[bytes]		   = '\0';
+	Trim(utf8, capacity, bytes + 1);
+	return std::string_view(utf8, bytes);
+}
+
+template std::string_view FrameArena::Utf8<wchar_t>(const wchar_t*, size_t);
+template std::string_view FrameArena::Utf8<ImWchar>(const ImWchar*, size_t);
+
+FrameArena::Block* FrameArena::NewBlock(size_t size) {
+	MemTagScope tag(MemTag::FrameArena);
+	Block* block = static_cast<Block*>(ImGui::MemAlloc(sizeof(Block) + size));
+	IM_ASSERT(block);
+	block->next = nullptr;
+	block->size = size;
+	block->used = 0;
+	return block;
+}
+
+void FrameArena::FreeBlocks(Block* block) {
+	while (block) {
+		Block* next = block->next;
+		ImGui::MemFree(block);
+		block = next;
+	}
+}
+
+} // namespace app
@@ -71,7 +71,7 @@ void Helpers::ShowExampleMenuFile() {
 	}
 	if (ImGui::MenuItem("Checked", NULL, true)) {}
 	ImGui::Separator();
-	if (ImGui::MenuItem("Quit", "Alt+F4")) { exit(EXIT_SUCCESS); }
+	if (ImGui::MenuItem("Quit", "Alt+F4")) { app::App::RequestExit(); }
 }
 
 void Helpers::ShowExampleAppMainMenuBar() {
@@ -110,25 +110,60 @@ int Helpers::UnkExcpt() {
 }
 
 std::string Helpers::strtoLower(std::string s) {
-    std::transform(s.begin(), s.end(), s.begin(), [](char c) { return std::tolower(c); });
+    ToLowerInPlace(s);
     return s;
 }
 
 std::wstring Helpers::strtoLowerW(std::wstring s) {
-    std::transform(s.begin(), s.end(), s.begin(), [](wchar_t c) { return std::tolower(c); });
+    ToLowerInPlace(s);
     return s;
 }
 
-void Helpers::charToLower(char* c) {
-    std::string s = Helpers::strtoLower(c);
-    std::string& es = s;
+void Helpers::ToLowerInPlace(std::string& s) {
+    app::utf::FoldCase(s);
+}
 
-    c = es.data();
+void Helpers::ToLowerInPlace(std::wstring& s) {
+    app::utf::FoldCase(s);
+}
+
+void Helpers::charToLower(char* c) {
+    // Folding never lengthens the text, so it always fits in place
+    c[app::utf::FoldCase(c, std::strlen(c))] = '\0';
 }
 
 const char* Helpers::constCharToLower(const char* c) {
-    std::string s = Helpers::strtoLower(c);
-    const char* val = s.c_str();
-    return val;
+    thread_local std::string buffer;
+    buffer.assign(c);
+    ToLowerInPlace(buffer);
+    return buffer.c_str();
 }
     
+
+bool Helpers::WriteFileAtomic(const std::wstring& path, std::string_view content) {
+	const fs::path target(path);
+	fs::path	   temp = target;
+	temp += L".tmp";
+
+	std::error_code ec;
+	{
+		std::ofstream file(temp, std::ios::out | std::ios::trunc | std::ios::binary);
+		if (!file.is_open()) return false;
+		file.write(content.data(), static_cast<std::streamsize>(content.size()));
+		file.flush();
+		if (!file.good()) {
+			file.close();
+			fs::remove(temp, ec);
+			return false;
+		}
+	}
+
+	// Replaces an existing target in one step (MoveFileExW with MOVEFILE_REPLACE_EXISTING)
+	fs::rename(temp, target, ec);
+	if (ec) {
+		std::error_code ignored;
+		fs::remove(temp, ignored);
+		return false;
+	}
+	return true;
+}
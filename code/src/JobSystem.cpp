@@ -0,0 +1,355 @@
+// JobSystem.cpp
+// Implementation of the work-stealing job system
+
+#include "PCH.hpp"
+#include "JobSystem.hpp"
+#include "Utf.hpp"
+
+namespace app {
+
+namespace detail {
+
+struct Job {
+	JobSystem::JobFn fn;
+	JobCounter*		 counter; // Decremented once fn has returned; may be nullptr
+};
+
+} // namespace detail
+
+namespace {
+
+// Which pool and which of its workers the calling thread is; -1 outside the workers
+thread_local const JobSystem* t_pool	= nullptr;
+thread_local int32_t		  t_worker	= -1;
+
+// Work of one job in MeasureScaling(): hashes a buffer that fits in L1, so the
+// batch scales with cores and not with memory bandwidth
+constexpr size_t   kScalingBytes  = 4096;
+constexpr uint32_t kScalingRounds = 4;
+
+uint64_t ScalingWork(const uint8_t* data, uint64_t seed) {
+	uint64_t hash = 14695981039346656037ull ^ seed;
+	for (uint32_t round = 0; round < kScalingRounds; round++)
+		for (size_t i = 0; i < kScalingBytes; i++) hash = (hash ^ data[i]) * 1099511628211ull;
+	return hash;
+}
+
+} // namespace
+
+// ----------------------------------------------------------------------------
+// WorkerDeque
+// ----------------------------------------------------------------------------
+
+bool JobSystem::WorkerDeque::Push(Job* job) {
+	const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+	const int64_t top	 = m_top.load(std::memory_order_acquire);
+	if (bottom - top >= kCapacity) return false;
+
+	m_slots[bottom & (kCapacity - 1)].store(job, std::memory_order_release);
+	m_bottom.store(bottom + 1, std::memory_order_release);
+	return true;
+}
+
+JobSystem::Job* JobSystem::WorkerDeque::Pop() {
+	// Claim the bottom slot first, then see whether a thief got there too
+	const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+	m_bottom.store(bottom, std::memory_order_seq_cst);
+	int64_t top = m_top.load(std::memory_order_seq_cst);
+
+	if (top > bottom) {
+		m_bottom.store(bottom + 1, std::memory_order_relaxed); // Was empty
+		return nullptr;
+	}
+
+	Job* job = m_slots[bottom & (kCapacity - 1)].load(std::memory_order_acquire);
+	if (top == bottom) {
+		// Last one: whoever moves top first has it
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			job = nullptr;
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+	}
+	return job;
+}
+
+JobSystem::Job* JobSystem::WorkerDeque::Steal() {
+	int64_t		  top	 = m_top.load(std::memory_order_seq_cst);
+	const int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+	if (top >= bottom) return nullptr;
+
+	Job* job = m_slots[top & (kCapacity - 1)].load(std::memory_order_acquire);
+	if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		return nullptr; // Lost to the owner or another thief; the caller moves on
+	return job;
+}
+
+// ----------------------------------------------------------------------------
+// JobSystem
+// ----------------------------------------------------------------------------
+
+JobSystem* JobSystem::Get_JobSystem_Singleton() {
+	static JobSystem instance;
+	return &instance;
+}
+
+JobSystem::JobSystem() :
+m_workers(),
+m_sharedMutex(),
+m_shared(),
+m_queued(0),
+m_sleeping(0),
+m_wakeMutex(),
+m_wake(),
+m_stop(false),
+m_mainThreadMutex(),
+m_mainThread(),
+m_executed(0),
+m_stolen(0),
+m_failed(0) {}
+
+JobSystem::~JobSystem() { Stop(); }
+
+void JobSystem::Start(uint32_t workers) {
+	IM_ASSERT(m_workers.empty() && "Start() twice");
+	workers = std::min(workers, kMaxWorkers);
+
+	m_stop.store(false, std::memory_order_relaxed);
+	// Every deque exists before the first worker can try to steal from it
+	for (uint32_t i = 0; i < workers; i++) m_workers.push_back(std::make_unique<Worker>());
+	for (uint32_t i = 0; i < workers; i++)
+		m_workers[i]->thread = std::thread(&JobSystem::WorkerLoop, this, static_cast<int32_t>(i));
+}
+
+void JobSystem::Stop() {
+	if (m_workers.empty()) return;
+	{
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_stop.store(true, std::memory_order_relaxed);
+	}
+	m_wake.notify_all();
+	for (std::unique_ptr<Worker>& worker : m_workers) worker->thread.join();
+
+	// Drop what never started. Counting each down keeps Wait() and the counter's
+	// destructor honest, and the jobs it releases land in the shared queue and
+	// are dropped by this same loop
+	bool stolen;
+	while (Job* job = FindJob(-1, stolen)) {
+		m_queued.fetch_sub(1, std::memory_order_relaxed);
+		JobCounter* counter = job->counter;
+		delete job;
+		if (counter) Finish(counter);
+	}
+	m_workers.clear();
+}
+
+void JobSystem::Schedule(JobFn fn, JobCounter* counter, JobCounter* after) {
+	// A running job may still schedule while Stop() waits for it; Stop() drops
+	// that job. From anywhere else the job would never run, so say so.
+	if (m_stop.load(std::memory_order_relaxed) && t_pool != this) {
+		std::wcerr << L"Job scheduled after the job system stopped; dropped" << std::endl;
+		IM_ASSERT(false && "JobSystem::Schedule() after Stop()");
+		return;
+	}
+
+	Job* job = new Job{std::move(fn), counter};
+	if (counter) counter->m_state.fetch_add(1, std::memory_order_relaxed);
+
+	if (after && after->GetPending() != 0) {
+		std::lock_guard<std::mutex> lock(after->m_mutex);
+		// Checked again under the lock: Finish() takes it once the count is zero
+		if ((after->m_state.load(std::memory_order_acquire) & JobCounter::kPendingMask) != 0) {
+			after->m_waiting.push_back(job);
+			return;
+		}
+	}
+	Enqueue(job);
+}
+
+void JobSystem::Enqueue(Job* job) {
+	// Counted first, so a worker that finds nothing and goes to sleep sees it
+	m_queued.fetch_add(1, std::memory_order_seq_cst);
+
+	if (t_pool != this || t_worker < 0 || !m_workers[t_worker]->deque.Push(job)) {
+		std::lock_guard<std::mutex> lock(m_sharedMutex);
+		m_shared.push_back(job);
+	}
+
+	if (m_sleeping.load(std::memory_order_seq_cst) > 0) {
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_wake.notify_one();
+	}
+}
+
+JobSystem::Job* JobSystem::FindJob(int32_t self, bool& stolen) {
+	stolen = false;
+
+	// Newest of our own first: its data is most likely still in cache
+	if (self >= 0) {
+		if (Job* job = m_workers[self]->deque.Pop()) return job;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_sharedMutex);
+		if (!m_shared.empty()) {
+			Job* job = m_shared.front();
+			m_shared.pop_front();
+			return job;
+		}
+	}
+
+	// Oldest of someone else's, starting after ourselves so thieves spread out
+	const int32_t count = static_cast<int32_t>(m_workers.size());
+	for (int32_t i = 1; i <= count; i++) {
+		const int32_t victim = (self + i + count) % count;
+		if (victim == self) continue;
+		if (Job* job = m_workers[victim]->deque.Steal()) {
+			stolen = true;
+			return job;
+		}
+	}
+	return nullptr;
+}
+
+void JobSystem::Execute(Job* job) {
+	m_queued.fetch_sub(1, std::memory_order_relaxed);
+
+	try {
+		job->fn();
+	} catch (const std::exception& e) {
+		m_failed.fetch_add(1, std::memory_order_relaxed);
+		std::wcerr << L"Job failed: " << utf::ToWide(e.what()) << std::endl;
+	} catch (...) {
+		m_failed.fetch_add(1, std::memory_order_relaxed);
+		std::wcerr << L"Job failed: unknown exception" << std::endl;
+	}
+	m_executed.fetch_add(1, std::memory_order_relaxed);
+
+	JobCounter* counter = job->counter;
+	delete job;
+	if (counter) Finish(counter);
+}
+
+void JobSystem::Finish(JobCounter* counter) {
+	// Any job but the last leaves the counter alone once it has counted down
+	uint64_t state = counter->m_state.load(std::memory_order_relaxed);
+	bool	 last;
+	do {
+		last = (state & JobCounter::kPendingMask) == 1;
+	} while (!counter->m_state.compare_exchange_weak(state, last ? state - 1 + JobCounter::kReleasing : state - 1,
+													 std::memory_order_acq_rel, std::memory_order_relaxed));
+	if (!last) return;
+
+	std::vector<Job*> released;
+	{
+		std::lock_guard<std::mutex> lock(counter->m_mutex);
+		released.swap(counter->m_waiting);
+	}
+	counter->m_state.fetch_sub(JobCounter::kReleasing, std::memory_order_release); // Last touch
+	for (Job* job : released) Enqueue(job);
+}
+
+void JobSystem::WorkerLoop(int32_t self) {
+	t_pool	 = this;
+	t_worker = self;
+
+	for (;;) {
+		// Checked before each job, so Stop() waits only for the ones running
+		if (m_stop.load(std::memory_order_relaxed)) break;
+
+		bool stolen;
+		if (Job* job = FindJob(self, stolen)) {
+			if (stolen) m_stolen.fetch_add(1, std::memory_order_relaxed);
+			Execute(job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_wakeMutex);
+		if (m_stop.load(std::memory_order_relaxed)) break;
+
+		// Announce the sleep before the last look at the count (pairs with Enqueue())
+		m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+		m_wake.wait(lock, [this]() {
+			return m_stop.load(std::memory_order_relaxed) || m_queued.load(std::memory_order_seq_cst) > 0;
+		});
+		m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	t_pool	 = nullptr;
+	t_worker = -1;
+}
+
+void JobSystem::Wait(const JobCounter& counter) {
+	const int32_t self = t_pool == this ? t_worker : -1;
+	while (!counter.IsDone()) {
+		bool stolen;
+		if (Job* job = FindJob(self, stolen)) {
+			if (stolen) m_stolen.fetch_add(1, std::memory_order_relaxed);
+			Execute(job);
+		} else {
+			std::this_thread::yield(); // The last jobs are running elsewhere
+		}
+	}
+}
+
+void JobSystem::RunOnMainThread(JobFn fn) {
+	std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+	m_mainThread.push_back(std::move(fn));
+}
+
+void JobSystem::DispatchMainThread() {
+	std::vector<JobFn> continuations;
+	{
+		std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+		if (m_mainThread.empty()) return;
+		continuations.swap(m_mainThread);
+	}
+	// One queued from a continuation waits for the next frame
+	for (JobFn& continuation : continuations) continuation();
+}
+
+JobSystem::Stats JobSystem::GetStats() const {
+	return Stats{static_cast<uint32_t>(m_workers.size()), m_executed.load(std::memory_order_relaxed),
+				 m_stolen.load(std::memory_order_relaxed), m_failed.load(std::memory_order_relaxed)};
+}
+
+BenchResult JobSystem::MeasureScaling(uint32_t iterations, uint32_t cores) {
+	using clock = std::chrono::steady_clock;
+
+	iterations			  = std::max(iterations, 1u);
+	cores				  = std::clamp(cores, 1u, kMaxWorkers + 1);
+	const uint32_t warmup = std::clamp(iterations / 10, 1u, 100u);
+
+	std::vector<uint8_t> data(kScalingBytes);
+	for (size_t i = 0; i < data.size(); i++) data[i] = static_cast<uint8_t>(i * 131u);
+	std::vector<uint64_t> results(kScalingJobs);
+
+	JobSystem pool;
+	pool.Start(cores - 1);
+
+	std::vector<double> samples;
+	samples.reserve(iterations);
+	for (uint32_t i = 0; i < warmup + iterations; i++) {
+		JobCounter done;
+
+		const auto start = clock::now();
+		pool.Schedule(
+			[&pool, &done, &data, &results]() {
+				for (uint32_t job = 0; job < kScalingJobs; job++) {
+					pool.Schedule([&data, &results, job]() { results[job] = ScalingWork(data.data(), job); }, &done);
+				}
+			},
+			&done);
+		pool.Wait(done);
+		const auto end = clock::now();
+
+		if (i >= warmup) samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+	}
+	pool.Stop();
+
+	// Jobs that did not run would leave their zero behind
+	for (uint32_t job = 0; job < kScalingJobs; job++)
+		if (results[job] != ScalingWork(data.data(), job)) throw std::runtime_error("job system skipped a job");
+
+	return Benchmark::FromSamples("jobs_" + std::to_string(cores), samples, warmup, 0, 0);
+}
+
+} // namespace app
@@ -1,6 +1,6 @@
 // MemoryManagement.cpp
 // Implementation of centralized m_memory management
-// Handles allocation and retrieval of all major application objects
+// Creates the application services and holds the state shared between them
 
 #include "pch.hpp"
 #include "Classes.hpp"
@@ -30,44 +30,13 @@ void MemoryManagement::Tick() {}
 void MemoryManagement::Close() {}
 
 /**
- * @brief Constructor - Initializes all pointers and flags
+ * @brief Constructor - Initializes the flags; no service exists yet
  *
- * Initializes all unique_ptr members to nullptr and allocation flags to false.
- * This ensures the memory management system starts in a clean, unallocated state.
- *
- * All managed objects must be explicitly allocated using their respective
- * Alloc_* methods before they can be retrieved with Get_* methods.
+ * Services are created by AllocAll() and retrieved with Get<T>().
  */
 MemoryManagement::MemoryManagement() :
-m_command_line_args(nullptr),
-m_console_window(nullptr),
-m_console_input_handler(nullptr),
-m_config_manager(nullptr),
-m_style_manager(nullptr),
-m_dx12_renderer(nullptr),
-m_dx_demos(nullptr),
-m_debug_window(nullptr),
-m_Example_Descriptor_Heap_Allocator(nullptr),
-m_font_manager(nullptr),
-m_font_manager_window(nullptr),
-m_frame_context(nullptr),
-m_window_class(nullptr),
-m_window_manager(nullptr),
-m_output_console(nullptr),
-m_bCommand_line_args_allocated(false),
-m_bConsole_window_allocated(false),
-m_bConsole_input_handler_allocated(false),
-m_bConfig_manager_allocated(false),
-m_bStyle_manager_allocated(false),
-m_bDx12_renderer_allocated(false),
-m_bDx_demos_allocated(false),
-m_bDebug_window_allocated(false),
-m_bExample_Descriptor_Heap_Allocator_allocated(false),
-m_bFont_manager_allocated(false),
-m_bFont_manager_window_allocated(false),
-m_bFrame_context_allocated(false),
-m_bWindow_class_allocated(false),
-m_bWindow_manager_allocated(false),
+m_services(),
+m_startup(),
 m_bShow_demo_window(false),
 m_bShow_another_window(false),
 m_bShow_FontManager_window(false),
@@ -75,7 +44,6 @@ m_bShow_styleEditor_window(false),
 m_bShow_Debug_window(false),
 m_bShow_FileSys_window(false),
 m_bShow_Console_window(true),
-m_bOutput_console_allocated(false),
 m_io(nullptr),
 bIoPassed(false),
 m_clear_color_ptr(nullptr),
@@ -84,210 +52,75 @@ m_currentConsoleColor(ImGuiConsoleColor::Reset)
 {}
 
 /**
- * @brief Destructor - Resets all allocation flags
- *
- * The unique_ptr members automatically clean up their owned objects through RAII.
- * This destructor explicitly resets all flags to false for clarity and safety,
- * although the automatic cleanup handles the actual memory deallocation.
+ * @brief Destructor - The registry destroys whatever services still exist
  */
 MemoryManagement::~MemoryManagement() {
-	m_Example_Descriptor_Heap_Allocator = nullptr;
-	m_app								= nullptr;
-	m_command_line_args					= nullptr;
-	m_console_window					= nullptr;
-	m_console_input_handler				= nullptr;
-	m_config_manager					= nullptr;
-	m_style_manager						= nullptr;
-	m_dx_demos							= nullptr;
-	m_dx12_renderer						= nullptr;
-	m_debug_window						= nullptr;
-	m_font_manager						= nullptr;
-	m_font_manager_window				= nullptr;
-	m_frame_context						= nullptr;
-	m_window_class						= nullptr;
-	m_window_manager					= nullptr;
-	m_output_console					= nullptr;
+	m_bShow_demo_window		   = false;
+	m_bShow_another_window	   = false;
+	m_bShow_FontManager_window = false;
+	m_bShow_styleEditor_window = false;
+	m_bShow_Debug_window	   = false;
+	m_bShow_FileSys_window	   = false;
+	bIoPassed				   = false;
+	m_io					   = nullptr;
+}
 
-	m_bCommand_line_args_allocated				   = false;
-	m_bConsole_window_allocated					   = false;
-	m_bConsole_input_handler_allocated			   = false;
-	// bDx12_renderer_allocated					 = false;
-	m_bDx_demos_allocated						   = false;
-	m_bDebug_window_allocated					   = false;
-	m_bExample_Descriptor_Heap_Allocator_allocated = false;
-	m_bFont_manager_allocated					   = false;
-	m_bFont_manager_window_allocated			   = false;
-	m_bFrame_context_allocated					   = false;
-	m_bWindow_class_allocated					   = false;
-	m_bWindow_manager_allocated					   = false;
-	m_bShow_demo_window							   = false;
-	m_bShow_another_window						   = false;
-	m_bShow_FontManager_window					   = false;
-	m_bShow_styleEditor_window					   = false;
-	m_bShow_Debug_window						   = false;
-	m_bShow_FileSys_window						   = false;
-	m_bOutput_console_allocated					   = false;
-	bIoPassed									   = false;
-	m_io										   = nullptr;
+/**
+ * @brief Adds the step that creates service T, named "alloc T"
+ */
+template <typename T>
+void MemoryManagement::AddAllocStep(std::initializer_list<std::string_view> dependencies,
+									StartupGraph::Affinity affinity) {
+	m_startup.Add("alloc " + std::string(Services::Name<T>()), dependencies, affinity,
+				  [this]() { return m_services.Create<T>(); });
 }
 
 /**
- * @brief Allocates all managed objects in the correct order
+ * @brief Creates all services as the first batch of the startup graph
  *
- * This method calls all
- * individual Alloc_* methods to create and initialize
- * all managed objects in a single call. This
- * is the recommended way to
- * initialize the entire application's memory management system.
+ * Each service becomes a step that names the services its constructor needs.
+ * The constructors only store pointers and defaults, so the independent ones
+ * run on the startup worker pool; App::Initialize() then adds the Open steps
+ * to the same graph.
  *
+ * The tool windows (DebugWindow, FontManagerWindow, WindowClass) are not
+ * created here: their LazyPanel creates them when they are first shown.
  *
- * Each allocation is checked for errors. If any allocation fails, this method
- * returns
- * immediately with the error code without attempting further allocations.
+ * If a creation fails, no further ones are started and the error code is
+ * returned once the ones already running have finished.
  *
- * @return S_OK if all
- * allocations succeed
+ * @return S_OK if all allocations succeed
  * @return First encountered HRESULT error code if any allocation fails
  */
 HRESULT MemoryManagement::AllocAll() {
-	HRESULT hr;
-
-	// Allocate App
-	hr = Alloc_App();
-	if (FAILED(hr)) return hr;
-	// Allocate command line arguments parser
-	hr = Alloc_command_line_args();
-	if (FAILED(hr)) return hr;
-
-	// Allocate m_console m_window (ImGui m_console)
-	hr = Alloc_console_window();
-	if (FAILED(hr)) return hr;
-
-	// Allocate m_console input handler (threaded command input)
-	hr = Alloc_console_input_handler();
-	if (FAILED(hr)) return hr;
-
-	// Allocate config manager
-	hr = Alloc_config_manager();
-	if (FAILED(hr)) return hr;
-
-	// Allocate style manager
-	hr = Alloc_style_manager();
-	if (FAILED(hr)) return hr;
-
-	// Allocate DX12 renderer
-	hr = Alloc_dx12_renderer();
-	if (FAILED(hr)) return hr;
-
-	// Allocate DirectX demos
-	hr = Alloc_dx_demos();
-	if (FAILED(hr)) return hr;
-
-	// Allocate debug m_window
-	hr = Alloc_debug_window();
-	if (FAILED(hr)) return hr;
-
-	// Allocate descriptor heap allocator for ImGui
-	hr = Alloc_Example_Descriptor_Heap_Allocator();
-	if (FAILED(hr)) return hr;
-
-	// Allocate font manager
-	hr = Alloc_font_manager();
-	if (FAILED(hr)) return hr;
+	using Affinity = StartupGraph::Affinity;
 
-	// Allocate font manager m_window
-	hr = Alloc_font_manager_window();
-	if (FAILED(hr)) return hr;
+	AddAllocStep<App>({}, Affinity::Any);
+	AddAllocStep<CommandLineArguments>({}, Affinity::Any);
+	AddAllocStep<ConsoleWindow>({}, Affinity::Any);
+	AddAllocStep<ConsoleInputHandler>({}, Affinity::Any);
+	AddAllocStep<ControlServer>({}, Affinity::Any);
+	AddAllocStep<ConfigManager>({}, Affinity::Any);
+	AddAllocStep<StyleManager>({}, Affinity::Any);
+	AddAllocStep<DX12Renderer>({}, Affinity::Any);
+	AddAllocStep<ExampleDescriptorHeapAllocator>({}, Affinity::Any);
+	AddAllocStep<FontManager>({}, Affinity::Any);
+	AddAllocStep<FrameArena>({}, Affinity::Any);
+	AddAllocStep<WindowManager>({}, Affinity::Any);
 
-	// Allocate frame context
-	hr = Alloc_frame_context();
-	if (FAILED(hr)) return hr;
+	// Reads the parsed arguments, and its CustomOutput remembers the thread that
+	// created it as the main thread
+	AddAllocStep<OutputConsole>({"alloc CommandLineArguments"}, Affinity::MainThread);
 
-	// Allocate m_window class (file system browser)
-	hr = Alloc_window_class();
-	if (FAILED(hr)) return hr;
-
-	// Allocate m_window manager
-	hr = Alloc_window_manager();
-	if (FAILED(hr)) return hr;
-
-	// Allocate m_console_window
-	hr = Alloc_output_console();
-	if (FAILED(hr)) return hr;
-
-	return S_OK;
-}
-
-HRESULT MemoryManagement::Alloc_App() {
-	if (m_bApp_allocated) {
-		MessageBoxA(NULL, "m_app is already allocated.", "Memory Error", MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// Create new instance using make_unique (exception-safe)
-		m_app = std::make_unique<App>();
-	} catch (const std::bad_alloc&) {
-		// Handle m_memory exhaustion
-		MessageBoxA(NULL, "Failed to allocate m_app for CommandLineArguments.", "Critical Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// Safety check to ensure the pointer is valid
-	if (!m_app) {
-		MessageBoxA(NULL, "Unexpected error during allocation m_app.", "Allocation Error",
-					MB_OK | MB_ICONERROR);
-		return E_POINTER;
-	}
-
-	// Mark as successfully allocated
-	m_bApp_allocated = true;
-
-	return S_OK;
+	return m_startup.Run();
 }
 
 /**
- * @brief Allocates CommandLineArguments object
+ * @brief Destroys all services, the most recently created first
  *
- * Creates a new CommandLineArguments instance for parsing and storing
- * command line arguments passed to the application.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
+ * @return S_OK
  */
-HRESULT MemoryManagement::Alloc_command_line_args() {
-	// Check if already allocated to prevent m_memory leaks or re-initialization
-	if (m_bCommand_line_args_allocated) {
-		MessageBoxA(NULL, "CommandLineArguments is already allocated.", "Memory Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// Create new instance using make_unique (exception-safe)
-		m_command_line_args = std::make_unique<CommandLineArguments>();
-	} catch (const std::bad_alloc&) {
-		// Handle m_memory exhaustion
-		MessageBoxA(NULL, "Failed to allocate m_memory for CommandLineArguments.", "Critical Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// Safety check to ensure the pointer is valid
-	if (!m_command_line_args) {
-		MessageBoxA(NULL, "Unexpected error during allocation.", "Allocation Error",
-					MB_OK | MB_ICONERROR);
-		return E_POINTER;
-	}
-
-	// Mark as successfully allocated
-	m_bCommand_line_args_allocated = true;
-
-	return S_OK;
-}
+HRESULT MemoryManagement::Destroy_All() { return m_services.DestroyAll(); }
 
 /**
  * @brief Gets the singleton instance of MemoryManagement
@@ -303,488 +136,6 @@ MemoryManagement* MemoryManagement::Get_MemoryManagement_Singleton() {
 	return instance.get();
 }
 
-App* MemoryManagement::Get_App() const {
-	// Check if allocated
-	if (!m_bApp_allocated) { throw std::runtime_error("m_app is not allocated"); }
-
-	// Check if pointer is valid
-	if (!m_app) { throw std::runtime_error("m_app is nullptr!"); }
-
-	// Return raw pointer from unique_ptr
-	// get() returns the raw pointer without releasing ownership
-	return m_app.get();
-}
-
-/**
- * @brief Gets the CommandLineArguments instance
- *
- * Returns a raw pointer to the managed CommandLineArguments object.
- *
- * @return Raw pointer to CommandLineArguments
- * @throws std::runtime_error if not allocated or pointer is null
- */
-CommandLineArguments* MemoryManagement::Get_CommandLineArguments() const {
-	// Check if allocated
-	if (!m_bCommand_line_args_allocated) {
-		throw std::runtime_error("CommandLineArguments is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_command_line_args) { throw std::runtime_error("m_command_line_args is nullptr!"); }
-
-	// Return raw pointer from unique_ptr
-	// get() returns the raw pointer without releasing ownership
-	return m_command_line_args.get();
-}
-
-/**
- * @brief Allocates the ConsoleInputHandler object
- *
- * Creates a new ConsoleInputHandler instance for threaded m_console input processing.
- * This handler manages asynchronous input from the m_console in a separate thread.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_console_input_handler() {
-	// 1. Check if already allocated to prevent logic errors and m_memory leaks
-	if (m_bConsole_input_handler_allocated) {
-		MessageBoxA(NULL, "ConsoleInputHandler is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// 2. Create new instance using make_unique (exception-safe)
-		m_console_input_handler = std::make_unique<ConsoleInputHandler>();
-	} catch (const std::bad_alloc&) {
-		// 3. Handle physical m_memory exhaustion
-		MessageBoxA(NULL, "Failed to allocate m_memory for ConsoleInputHandler.",
-					"Critical Memory Error", MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// 4. Verify allocation success
-	if (!m_console_input_handler) { return E_POINTER; }
-
-	// 5. Mark as successfully allocated
-	m_bConsole_input_handler_allocated = true;
-
-	return S_OK;
-}
-
-/**
- * @brief Allocates ConfigManager object
- *
- * Creates a new ConfigManager instance for loading, saving, and managing
- * application configuration settings.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_config_manager() {
-	// Check if the ConfigManager is already allocated to prevent double allocation
-	if (m_bConfig_manager_allocated) {
-		MessageBoxA(NULL, "ConfigManager is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// Create new instance using make_unique
-		// This handles m_memory allocation safely
-		m_config_manager = std::make_unique<ConfigManager>();
-	} catch (const std::bad_alloc&) {
-		// Handle physical m_memory exhaustion
-		MessageBoxA(NULL, "Failed to allocate m_memory for ConfigManager.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// Verify if the unique_ptr holds a valid object
-	if (!m_config_manager) {
-		MessageBoxA(NULL, "ConfigManager pointer is null after allocation.", "Critical Error",
-					MB_OK | MB_ICONERROR);
-		return E_POINTER;
-	}
-
-	// Mark as successfully allocated
-	m_bConfig_manager_allocated = true;
-
-	return S_OK;
-}
-
-/**
- * @brief Allocates the StyleManager object
- *
- * Creates a new StyleManager instance for managing ImGui style configuration
- * with persistent storage using reflectcpp serialization.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_style_manager() {
-	// Check if the StyleManager is already allocated to prevent double allocation
-	if (m_bStyle_manager_allocated) {
-		MessageBoxA(NULL, "StyleManager is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// Create new instance using make_unique
-		// This handles memory allocation safely
-		m_style_manager = std::make_unique<StyleManager>();
-	} catch (const std::bad_alloc&) {
-		// Handle physical memory exhaustion
-		MessageBoxA(NULL, "Failed to allocate memory for StyleManager.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// Verify if the unique_ptr holds a valid object
-	if (!m_style_manager) {
-		MessageBoxA(NULL, "StyleManager pointer is null after allocation.", "Critical Error",
-					MB_OK | MB_ICONERROR);
-		return E_POINTER;
-	}
-
-	// Mark as successfully allocated
-	m_bStyle_manager_allocated = true;
-
-	return S_OK;
-}
-
-/**
- * @brief Gets the ConsoleInputHandler instance
- *
- * Returns a raw pointer to the managed ConsoleInputHandler object.
- * The object must be allocated via Alloc_console_input_handler() before calling this.
- *
- * @return Raw pointer to ConsoleInputHandler
- * @throws std::runtime_error if not allocated or pointer is null
- */
-ConsoleInputHandler* MemoryManagement::Get_ConsoleInputHandler() const {
-	// Check if allocated
-	if (!m_bConsole_input_handler_allocated) {
-		throw std::runtime_error("ConsoleInputHandler is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_console_input_handler) {
-		throw std::runtime_error("m_console_input_handler is nullptr!");
-	}
-
-	// Return raw pointer
-	return m_console_input_handler.get();
-}
-
-/**
- * @brief Gets the ConsoleWindow instance
- *
- * Returns a raw pointer to the managed ConsoleWindow object.
- * The object must be allocated via Alloc_console_window() before calling this.
- *
- * @return Raw pointer to ConsoleWindow
- * @throws std::runtime_error if not allocated or pointer is null
- */
-ConsoleWindow* MemoryManagement::Get_ConsoleWindow() const {
-
-	// Check if allocated
-	if (!m_bConsole_window_allocated) {
-		throw std::runtime_error("m_console_window is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_console_window) { throw std::runtime_error("m_console_window is nullptr!"); }
-
-	// Return raw pointer
-	return m_console_window.get();
-}
-
-/**
- * @brief Gets the DebugWindow instance
- *
- * Returns a raw pointer to the managed DebugWindow object.
- * The object must be allocated via Alloc_debug_window() before calling this.
- *
- * @return Raw pointer to DebugWindow
- * @throws std::runtime_error if not allocated or pointer is null
- */
-DebugWindow* MemoryManagement::Get_DebugWindow() const {
-	// Check if allocated
-	if (!m_bDebug_window_allocated) { throw std::runtime_error("m_debug_window is not allocated"); }
-
-	// Check if pointer is valid
-	if (!m_debug_window) { throw std::runtime_error("m_debug_window is nullptr!"); }
-
-	// Return raw pointer
-	return m_debug_window.get();
-}
-
-/**
- * @brief Gets the FontManager instance
- *
- * Returns a raw pointer to the managed FontManager object.
- * The object must be allocated via Alloc_font_manager() before calling this.
- *
- * @return Raw pointer to FontManager
- * @throws std::runtime_error if not allocated or pointer is null
- */
-FontManager* MemoryManagement::Get_FontManager() const {
-	// Check if allocated
-	if (!m_bFont_manager_allocated) { throw std::runtime_error("m_font_manager is not allocated"); }
-
-	// Check if pointer is valid
-	if (!m_font_manager) { throw std::runtime_error("m_font_manager is nullptr!"); }
-
-	// Return raw pointer
-	return m_font_manager.get();
-}
-
-/**
- * @brief Gets the FontManagerWindow instance
- *
- * Returns a raw pointer to the managed FontManagerWindow object.
- * The object must be allocated via Alloc_font_manager_window() before calling this.
- *
- * @return Raw pointer to FontManagerWindow
- * @throws std::runtime_error if not allocated or pointer is null
- */
-FontManagerWindow* MemoryManagement::Get_FontManagerWindow() const {
-	// Check if allocated
-	if (!m_bFont_manager_window_allocated) {
-		throw std::runtime_error("m_font_manager_window is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_font_manager_window) { throw std::runtime_error("m_font_manager_window is nullptr!"); }
-
-	// Return raw pointer
-	return m_font_manager_window.get();
-}
-
-/**
- * @brief Allocates DX12Renderer object
- *
- * Creates a new DX12Renderer instance for DirectX 12 rendering.
- *
- * @throws std::runtime_error if already allocated or allocation fails
- */
-HRESULT MemoryManagement::Alloc_dx12_renderer() {
-
-	// Check if the ConfigManager is already allocated to prevent double allocation
-	if (m_bDx12_renderer_allocated) {
-		MessageBoxA(NULL, "m_dx12_renderer is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// Create new instance using make_unique
-		// This handles m_memory allocation safely
-		m_dx12_renderer = std::make_unique<DX12Renderer>();
-	} catch (const std::bad_alloc&) {
-		// Handle physical m_memory exhaustion
-		MessageBoxA(NULL, "Failed to allocate m_memory for m_dx12_renderer.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// Verify if the unique_ptr holds a valid object
-	if (!m_dx12_renderer) {
-		MessageBoxA(NULL, "m_dx12_renderer pointer is null after allocation.", "Critical Error",
-					MB_OK | MB_ICONERROR);
-		return E_POINTER;
-	}
-
-	// Mark as successfully allocated
-	m_bDx12_renderer_allocated = true;
-
-	return S_OK;
-}
-
-/**
- * @brief Gets the DX12Renderer instance
- *
- * @return Raw pointer to DX12Renderer
- * @throws std::runtime_error if not allocated or pointer is null
- */
-DX12Renderer* MemoryManagement::Get_DX12Renderer() const {
-	// Check if allocated
-	if (!m_bDx12_renderer_allocated) {
-		throw std::runtime_error("m_dx12_renderer is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_dx12_renderer) { throw std::runtime_error("m_dx12_renderer is nullptr!"); }
-
-	// Return raw pointer
-	return m_dx12_renderer.get();
-}
-
-/**
- * @brief Allocates the ExampleDescriptorHeapAllocator object
- *
- * Creates the descriptor heap allocator used by ImGui for DirectX 12 rendering.
- * This allocator manages GPU descriptor handles for ImGui textures and resources.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_Example_Descriptor_Heap_Allocator() {
-	// Check if already allocated to prevent double allocation in DX12 context
-	if (m_bExample_Descriptor_Heap_Allocator_allocated) {
-		MessageBoxA(NULL, "ExampleDescriptorHeapAllocator is already allocated.",
-					"Initialization Error", MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// Create new instance using make_unique (exception-safe for bad_alloc)
-		m_Example_Descriptor_Heap_Allocator = std::make_unique<ExampleDescriptorHeapAllocator>();
-	} catch (const std::bad_alloc&) {
-		// Handle m_memory exhaustion (critical for GPU-related allocators)
-		MessageBoxA(NULL, "Failed to allocate m_memory for ExampleDescriptorHeapAllocator.",
-					"Memory Error", MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// Safety check to ensure the pointer is valid after construction
-	if (!m_Example_Descriptor_Heap_Allocator) { return E_POINTER; }
-
-	// Mark as successfully allocated
-	m_bExample_Descriptor_Heap_Allocator_allocated = true;
-
-	return S_OK;
-}
-
-/**
- * @brief Gets the ExampleDescriptorHeapAllocator instance
- *
- * @return Raw pointer to ExampleDescriptorHeapAllocator
- * @throws std::runtime_error if not allocated or pointer is null
- */
-ExampleDescriptorHeapAllocator* MemoryManagement::Get_ExampleDescriptorHeapAllocator() const {
-	// Check if allocated
-	if (!m_bExample_Descriptor_Heap_Allocator_allocated) {
-		throw std::runtime_error("ExampleDescriptorHeapAllocator is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_Example_Descriptor_Heap_Allocator) {
-		throw std::runtime_error("m_Example_Descriptor_Heap_Allocator is nullptr!");
-	}
-
-	// Return raw pointer
-	return m_Example_Descriptor_Heap_Allocator.get();
-}
-
-/**
- * @brief Gets the WindowClass instance
- *
- * Returns a raw pointer to the managed WindowClass object.
- * The object must be allocated via Alloc_window_class() before calling this.
- *
- * @return Raw pointer to WindowClass
- * @throws std::runtime_error if not allocated or pointer is null
- */
-WindowClass* MemoryManagement::Get_WindowClass() const {
-	// Check if allocated
-	if (!m_bWindow_class_allocated) { throw std::runtime_error("m_window_class is not allocated"); }
-
-	// Check if pointer is valid
-	if (!m_window_class) { throw std::runtime_error("m_window_class is nullptr!"); }
-
-	// Return raw pointer
-	return m_window_class.get();
-}
-
-/**
- * @brief Allocates the WindowManager object
- *
- * Creates the m_window manager responsible for Win32 m_window creation and management.
- * Handles m_window lifecycle, DPI awareness, and m_window state (windowed/fullscreen).
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_window_manager() {
-	// Check if already allocated to prevent re-initialization
-	if (m_bWindow_manager_allocated) {
-		MessageBoxA(NULL, "WindowManager is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// Create new instance using make_unique (exception-safe)
-		m_window_manager = std::make_unique<WindowManager>();
-	} catch (const std::bad_alloc&) {
-		// Handle m_memory exhaustion
-		MessageBoxA(NULL, "Failed to allocate m_memory for WindowManager.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// Verify if the unique_ptr holds a valid object
-	if (!m_window_manager) { return E_POINTER; }
-
-	// Mark as successfully allocated
-	m_bWindow_manager_allocated = true;
-
-	return S_OK;
-}
-
-/**
- * @brief Allocates the OutputConsole object
- *
- * Creates the output m_console m_window for application logging and debug output.
- * Provides a visual interface for viewing application messages and errors.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_output_console() {
-	// Check if already allocated to prevent m_memory leaks or logic errors
-	if (m_bOutput_console_allocated) {
-		MessageBoxA(NULL, "OutputConsole is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		// Create new instance using make_unique
-		m_output_console = std::make_unique<OutputConsole>();
-	} catch (const std::bad_alloc&) {
-		// Handle physical m_memory exhaustion
-		MessageBoxA(NULL, "Failed to allocate m_memory for OutputConsole.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	// Safety check to ensure the pointer is valid
-	if (!m_output_console) { return E_POINTER; }
-
-	// Mark as successfully allocated
-	m_bOutput_console_allocated = true;
-
-	return S_OK;
-}
-
-
 /**
  * @brief Sets the ImGuiIO pointer
  *
@@ -847,612 +198,4 @@ ImVec4* MemoryManagement::Get_clear_color_ptr() {
 	return m_clear_color_ptr							 = clear_color_singleton.get();
 }
 
-/**
- * @brief Gets the WindowManager instance
- *
- * @return Raw pointer to WindowManager
- * @throws std::runtime_error if not allocated or pointer is null
- */
-WindowManager* MemoryManagement::Get_WindowManager() const {
-	// Check if allocated
-	if (!m_bWindow_manager_allocated) {
-		throw std::runtime_error("m_window_manager is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_window_manager) { throw std::runtime_error("m_window_manager is nullptr!"); }
-
-	// Return raw pointer
-	return m_window_manager.get();
-}
-
-/**
- * @brief Gets the ConfigManager instance
- *
- * Returns a raw pointer to the managed ConfigManager object.
- * The object must be allocated via Alloc_config_manager() before calling this.
- *
- * @return Raw pointer to ConfigManager
- * @throws std::runtime_error if not allocated or pointer is null
- */
-ConfigManager* MemoryManagement::Get_ConfigManager() const {
-
-	// Check if allocated
-	if (!m_bConfig_manager_allocated) {
-		throw std::runtime_error("m_config_manager is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_config_manager) { throw std::runtime_error("m_config_manager is nullptr!"); }
-
-	// Return raw pointer
-	return m_config_manager.get();
-}
-
-/**
- * @brief Gets the StyleManager instance
- *
- * Returns a raw pointer to the managed StyleManager object.
- * The object must be allocated via Alloc_style_manager() before calling this.
- *
- * @return Raw pointer to StyleManager
- * @throws std::runtime_error if not allocated or pointer is null
- */
-StyleManager* MemoryManagement::Get_StyleManager() const {
-
-	// Check if allocated
-	if (!m_bStyle_manager_allocated) {
-		throw std::runtime_error("m_style_manager is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_style_manager) { throw std::runtime_error("m_style_manager is nullptr!"); }
-
-	// Return raw pointer
-	return m_style_manager.get();
-}
-
-/**
- * @brief Gets the OutputConsole instance
- *
- * Returns a raw pointer to the managed OutputConsole object.
- * The object must be allocated via Alloc_output_console() before calling this.
- *
- * @return Raw pointer to OutputConsole
- * @throws std::runtime_error if not allocated or pointer is null
- */
-OutputConsole* MemoryManagement::Get_OutputConsole() const {
-
-	// Check if allocated
-	if (!m_bOutput_console_allocated) {
-		throw std::runtime_error("m_output_console is not allocated");
-	}
-
-	// Check if pointer is valid
-	if (!m_output_console) { throw std::runtime_error("m_output_console is nullptr!"); }
-
-	// Return raw pointer
-	return m_output_console.get();
-}
-
-
-/**
- * @brief Allocates the ConsoleWindow object
- *
- * Creates the ImGui-based m_console m_window for command input and output display.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_console_window() {
-	if (m_bConsole_window_allocated) {
-		MessageBoxA(NULL, "ConsoleWindow is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		m_console_window = std::make_unique<ConsoleWindow>();
-	} catch (const std::bad_alloc&) {
-		MessageBoxA(NULL, "Failed to allocate m_memory for ConsoleWindow.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	if (!m_console_window) return E_POINTER;
-
-	m_bConsole_window_allocated = true;
-	return S_OK;
-}
-
-/**
- * @brief Allocates the DirectX demos object
- *
- * Currently a placeholder for future DirectX demonstration features.
- *
- * @return S_OK (placeholder implementation)
- */
-HRESULT MemoryManagement::Alloc_dx_demos() {
-	// TODO: Implement DX demos allocation
-	return S_OK;
-}
-
-/**
- * @brief Allocates the DebugWindow object
- *
- * Creates the debug m_window for displaying application debug information and metrics.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_debug_window() {
-	if (m_bDebug_window_allocated) {
-		MessageBoxA(NULL, "DebugWindow is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		m_debug_window = std::make_unique<DebugWindow>();
-	} catch (const std::bad_alloc&) {
-		MessageBoxA(NULL, "Failed to allocate m_memory for DebugWindow.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	if (!m_debug_window) return E_POINTER;
-
-	m_bDebug_window_allocated = true;
-	return S_OK;
-}
-
-/**
- * @brief Allocates the FontManager object
- *
- * Creates the font manager for loading, managing, and switching between different fonts.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_font_manager() {
-	if (m_bFont_manager_allocated) {
-		MessageBoxA(NULL, "FontManager is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		m_font_manager = std::make_unique<FontManager>();
-	} catch (const std::bad_alloc&) {
-		MessageBoxA(NULL, "Failed to allocate m_memory for FontManager.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	if (!m_font_manager) return E_POINTER;
-
-	m_bFont_manager_allocated = true;
-	return S_OK;
-}
-
-/**
- * @brief Allocates the FontManagerWindow object
- *
- * Creates the UI m_window for the font manager, allowing users to select and preview fonts.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_font_manager_window() {
-	if (m_bFont_manager_window_allocated) {
-		MessageBoxA(NULL, "FontManagerWindow is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		m_font_manager_window = std::make_unique<FontManagerWindow>();
-	} catch (const std::bad_alloc&) {
-		MessageBoxA(NULL, "Failed to allocate m_memory for FontManagerWindow.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	if (!m_font_manager_window) return E_POINTER;
-
-	m_bFont_manager_window_allocated = true;
-	return S_OK;
-}
-
-/**
- * @brief Allocates the frame context object
- *
- * Currently a placeholder for future frame context management.
- *
- * @return S_OK (placeholder implementation)
- */
-HRESULT MemoryManagement::Alloc_frame_context() {
-	// TODO: Implement frame context allocation
-	return S_OK;
-}
-
-/**
- * @brief Allocates the WindowClass object
- *
- * Creates the m_window class wrapper, typically used for file system browser or other utility
- * windows.
- *
- * @return S_OK on successful allocation
- * @return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED) if already allocated
- * @return E_OUTOFMEMORY if memory allocation fails
- * @return E_POINTER if pointer is null after allocation
- */
-HRESULT MemoryManagement::Alloc_window_class() {
-	if (m_bWindow_class_allocated) {
-		MessageBoxA(NULL, "WindowClass is already allocated.", "Initialization Error",
-					MB_OK | MB_ICONERROR);
-		return HRESULT_FROM_WIN32(ERROR_ALREADY_INITIALIZED);
-	}
-
-	try {
-		m_window_class = std::make_unique<WindowClass>();
-	} catch (const std::bad_alloc&) {
-		MessageBoxA(NULL, "Failed to allocate m_memory for WindowClass.", "Memory Error",
-					MB_OK | MB_ICONSTOP);
-		return E_OUTOFMEMORY;
-	}
-
-	if (!m_window_class) return E_POINTER;
-
-	m_bWindow_class_allocated = true;
-	return S_OK;
-}
-
-/**
- * @brief Destroys all allocated objects in reverse order
- *
- * This method calls all individual Destroy_* methods to deallocate and clean up
- * all managed objects in a single call. Objects are destroyed in reverse order
- * of their allocation to respect dependencies.
- *
- * @return S_OK if all objects destroyed successfully
- * @return First encountered error code if any destruction fails
- */
-HRESULT MemoryManagement::Destroy_All() {
-	HRESULT hr = S_OK;
-	HRESULT temp_hr;
-
-	// Destroy in reverse order of allocation
-	temp_hr = Destroy_output_console();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_window_manager();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_window_class();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_frame_context();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_font_manager_window();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_font_manager();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_Example_Descriptor_Heap_Allocator();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_debug_window();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_dx_demos();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_dx12_renderer();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_style_manager();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_config_manager();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_console_input_handler();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_console_window();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_command_line_args();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	temp_hr = Destroy_App();
-	if (FAILED(temp_hr) && SUCCEEDED(hr)) hr = temp_hr;
-
-	return hr;
-}
-
-/**
- * @brief Destroys the App object
- *
- * Deallocates the App object and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_App() {
-	if (!m_bApp_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_app.reset();
-	m_bApp_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the CommandLineArguments object
- *
- * Deallocates the command line arguments parser and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_command_line_args() {
-	if (!m_bCommand_line_args_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_command_line_args.reset();
-	m_bCommand_line_args_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the ConsoleWindow object
- *
- * Deallocates the ImGui console window and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_console_window() {
-	if (!m_bConsole_window_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_console_window.reset();
-	m_bConsole_window_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the ConsoleInputHandler object
- *
- * Deallocates the console input handler and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_console_input_handler() {
-	if (!m_bConsole_input_handler_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_console_input_handler.reset();
-	m_bConsole_input_handler_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the ConfigManager object
- *
- * Deallocates the configuration manager and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_config_manager() {
-	if (!m_bConfig_manager_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_config_manager.reset();
-	m_bConfig_manager_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the StyleManager object
- *
- * Deallocates the style manager and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_style_manager() {
-	if (!m_bStyle_manager_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_style_manager.reset();
-	m_bStyle_manager_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the DX12Renderer object
- *
- * Deallocates the DirectX 12 renderer and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_dx12_renderer() {
-	if (!m_bDx12_renderer_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_dx12_renderer.reset();
-	m_bDx12_renderer_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the DxDemos object
- *
- * Deallocates the DirectX demos object and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_dx_demos() {
-	if (!m_bDx_demos_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_dx_demos.reset();
-	m_bDx_demos_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the DebugWindow object
- *
- * Deallocates the debug window and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_debug_window() {
-	if (!m_bDebug_window_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_debug_window.reset();
-	m_bDebug_window_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the ExampleDescriptorHeapAllocator object
- *
- * Deallocates the descriptor heap allocator and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_Example_Descriptor_Heap_Allocator() {
-	if (!m_bExample_Descriptor_Heap_Allocator_allocated) {
-		return HRESULT_FROM_WIN32(ERROR_NOT_READY);
-	}
-
-	m_Example_Descriptor_Heap_Allocator.reset();
-	m_bExample_Descriptor_Heap_Allocator_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the FontManager object
- *
- * Deallocates the font manager and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_font_manager() {
-	if (!m_bFont_manager_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_font_manager.reset();
-	m_bFont_manager_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the FontManagerWindow object
- *
- * Deallocates the font manager window and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_font_manager_window() {
-	if (!m_bFont_manager_window_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_font_manager_window.reset();
-	m_bFont_manager_window_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the FrameContext object
- *
- * Deallocates the frame context and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_frame_context() {
-	if (!m_bFrame_context_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_frame_context.reset();
-	m_bFrame_context_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the WindowClass object
- *
- * Deallocates the window class and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_window_class() {
-	if (!m_bWindow_class_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_window_class.reset();
-	m_bWindow_class_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the WindowManager object
- *
- * Deallocates the window manager and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_window_manager() {
-	if (!m_bWindow_manager_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_window_manager.reset();
-	m_bWindow_manager_allocated = false;
-
-	return S_OK;
-}
-
-/**
- * @brief Destroys the OutputConsole object
- *
- * Deallocates the output console and resets its allocation flag.
- *
- * @return S_OK on successful destruction
- * @return HRESULT_FROM_WIN32(ERROR_NOT_READY) if not allocated
- */
-HRESULT MemoryManagement::Destroy_output_console() {
-	if (!m_bOutput_console_allocated) { return HRESULT_FROM_WIN32(ERROR_NOT_READY); }
-
-	m_output_console.reset();
-	m_bOutput_console_allocated = false;
-
-	return S_OK;
-}
 } // namespace app
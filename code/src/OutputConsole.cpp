@@ -16,12 +16,11 @@ void OutputConsole::Open() {
 
   
     ShowConsole(m_args->m_bShowCmd);
+    EventBus::Get_EventBus_Singleton()->Subscribe<ConsoleVisibilityChanged, &OutputConsole::OnConsoleVisibilityChanged>(this);
 }
 
-void OutputConsole::Tick() {
-
-    ShowConsole(m_memory->m_bShowCmd);
-}
+// The console is shown or hidden when asked (see OnConsoleVisibilityChanged())
+void OutputConsole::Tick() {}
 
 void OutputConsole::Close() {}
 
@@ -34,12 +33,16 @@ m_memory(nullptr),
 m_args(nullptr) {
 
     m_memory = MemoryManagement::Get_MemoryManagement_Singleton();
-    if(m_memory) m_args = m_memory->Get_CommandLineArguments();
+    if(m_memory) m_args = m_memory->Get<CommandLineArguments>();
     else throw std::runtime_error("m_memory is nullptr");
+
+    // The native console always receives Out; the ImGui console is added by SetConsoleWindow()
+    Out.AddSink(std::make_unique<NativeConsoleSink>());
 }
 
 OutputConsole::~OutputConsole() {
 
+	EventBus::Get_EventBus_Singleton()->Unsubscribe(this);
 	m_bWasConsoleCreated   = false;
 	m_bShouldCreateConsole = false;
 	m_bShowConsole		   = false;
@@ -48,22 +51,261 @@ OutputConsole::~OutputConsole() {
 	FreeConsole();
 }
 
-CustomOutput::CustomOutput() : m_consoleWindow(nullptr) {}
+namespace {
+
+// Source of CustomOutput ids; 0 means "no cached state" in Local()
+std::atomic<uint64_t> s_nextOutputId{1};
+
+} // namespace
+
+CustomOutput::ThreadLine::ThreadLine() :
+line(),
+scanPos(0),
+buffer(line),
+stream(&buffer),
+defaultFlags(stream.flags()),
+colorTag() {
+	// termcolor only writes escapes to streams that are terminals or opted in
+	stream << termcolor::colorize;
+	line.reserve(256);
+}
+
+CustomOutput::CustomOutput() :
+m_id(s_nextOutputId.fetch_add(1, std::memory_order_relaxed)),
+m_mainThread(std::this_thread::get_id()),
+m_sinkMutex(),
+m_sinks(),
+m_consoleWindowSink(nullptr),
+m_mainThreadSinks(0),
+m_deferred(),
+m_droppedLines(0) {}
+
+CustomOutput::~CustomOutput() {
+	// Free the destroying thread's state. States other threads created stay
+	// until those threads exit; ids are never reused, so they are never found
+	// again.
+	std::erase_if(ThreadStates(), [this](const LocalState& entry) { return entry.owner == m_id; });
+}
+
+std::vector<CustomOutput::LocalState>& CustomOutput::ThreadStates() {
+	static thread_local std::vector<LocalState> t_states;
+	return t_states;
+}
+
+/**
+ * @brief Returns the calling thread's formatting state for this object
+ *
+ * The last state used is cached, so the common case (one CustomOutput per
+ * thread) is a single comparison.
+ */
+CustomOutput::ThreadLine& CustomOutput::Local() {
+	static thread_local uint64_t	t_lastOwner = 0;
+	static thread_local ThreadLine* t_lastState = nullptr;
+
+	if (t_lastOwner == m_id) return *t_lastState;
+
+	std::vector<LocalState>& states = ThreadStates();
+	auto it = std::find_if(states.begin(), states.end(),
+						   [this](const LocalState& entry) { return entry.owner == m_id; });
+	if (it == states.end()) {
+		states.push_back(LocalState{m_id, std::make_unique<ThreadLine>()});
+		it = std::prev(states.end());
+	}
+
+	t_lastOwner = m_id;
+	t_lastState = it->state.get();
+	return *t_lastState;
+}
 
 void CustomOutput::SetConsoleWindow(ConsoleWindow* consoleWindow) {
-	m_consoleWindow = consoleWindow;
+	ConsoleWindowSink* previous = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(m_sinkMutex);
+		previous = m_consoleWindowSink;
+	}
+	RemoveSink(previous);
+	if (consoleWindow) {
+		auto* sink = static_cast<ConsoleWindowSink*>(
+			AddSink(std::make_unique<ConsoleWindowSink>(consoleWindow)));
+		std::lock_guard<std::mutex> lock(m_sinkMutex);
+		m_consoleWindowSink = sink;
+	}
 }
 
-void CustomOutput::FlushToConsoleWindow() {
-	if (m_consoleWindow && !m_buffer.empty()) {
-		// Check if buffer ends with newline
-		if (m_buffer.back() == '\n') {
-			// Remove the newline before sending to ConsoleWindow
-			m_buffer.pop_back();
-			if (!m_buffer.empty()) { m_consoleWindow->AddLog("%s", m_buffer.c_str()); }
-			m_buffer.clear();
-		}
+OutputSink* CustomOutput::AddSink(UPtr<OutputSink> sink) {
+	std::lock_guard<std::mutex> lock(m_sinkMutex);
+	if (sink->RequiresMainThread()) m_mainThreadSinks++;
+	m_sinks.push_back(std::move(sink));
+	return m_sinks.back().get();
+}
+
+void CustomOutput::RemoveSink(OutputSink* sink) {
+	if (!sink) return;
+
+	std::lock_guard<std::mutex> lock(m_sinkMutex);
+	auto it = std::find_if(m_sinks.begin(), m_sinks.end(),
+						   [sink](const UPtr<OutputSink>& s) { return s.get() == sink; });
+	if (it == m_sinks.end()) return;
+
+	if (sink->RequiresMainThread() && --m_mainThreadSinks == 0) {
+		m_deferred.clear();
+		m_droppedLines = 0;
+	}
+	if (sink == m_consoleWindowSink) m_consoleWindowSink = nullptr;
+	m_sinks.erase(it);
+}
+
+/**
+ * @brief Publishes every complete line of local.line, then drops them from the
+ *        buffer (keeping its capacity)
+ *
+ * All lines found are published under a single lock acquisition.
+ */
+void CustomOutput::EmitLines(ThreadLine& local) {
+	size_t newline = local.line.find('\n', local.scanPos);
+	if (newline == std::string::npos) {
+		local.scanPos = local.line.size();
+		return;
 	}
+
+	const bool onMainThread = std::this_thread::get_id() == m_mainThread;
+	size_t	   lineStart	= 0;
+	{
+		std::lock_guard<std::mutex> lock(m_sinkMutex);
+
+		// Older lines from other threads go first
+		if (onMainThread && !m_deferred.empty()) DispatchDeferredLocked();
+
+		do {
+			std::string_view line(local.line.data() + lineStart, newline - lineStart);
+			if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+			PublishLocked(line, onMainThread);
+
+			lineStart = newline + 1;
+			newline	  = local.line.find('\n', lineStart);
+		} while (newline != std::string::npos);
+	}
+
+	local.line.erase(0, lineStart);
+	local.scanPos = local.line.size();
+}
+
+void CustomOutput::PublishLocked(std::string_view line, bool onMainThread) {
+	for (const UPtr<OutputSink>& sink : m_sinks) {
+		if (onMainThread || !sink->RequiresMainThread()) sink->WriteLine(line);
+	}
+
+	if (onMainThread || m_mainThreadSinks == 0) return;
+
+	if (m_deferred.size() == kMaxDeferredLines) {
+		m_deferred.pop_front();
+		m_droppedLines++;
+	}
+	m_deferred.emplace_back(line);
+}
+
+void CustomOutput::DispatchDeferred() {
+	if (std::this_thread::get_id() != m_mainThread) return;
+
+	std::lock_guard<std::mutex> lock(m_sinkMutex);
+	if (!m_deferred.empty()) DispatchDeferredLocked();
+}
+
+void CustomOutput::DispatchDeferredLocked() {
+	std::string notice;
+	if (m_droppedLines) {
+		notice = "[warning] " + std::to_string(m_droppedLines) +
+				 " lines from other threads were dropped before the console caught up";
+		m_droppedLines = 0;
+	}
+
+	for (const UPtr<OutputSink>& sink : m_sinks) {
+		if (!sink->RequiresMainThread()) continue;
+		if (!notice.empty()) sink->WriteLine(notice);
+		for (const std::string& line : m_deferred) sink->WriteLine(line);
+	}
+	m_deferred.clear();
+}
+
+void CustomOutput::FlushSinks() {
+	const bool onMainThread = std::this_thread::get_id() == m_mainThread;
+
+	std::lock_guard<std::mutex> lock(m_sinkMutex);
+	for (const UPtr<OutputSink>& sink : m_sinks) {
+		if (onMainThread || !sink->RequiresMainThread()) sink->Flush();
+	}
+}
+
+bool CustomOutput::Drain(std::chrono::milliseconds timeout) {
+	const auto deadline		= std::chrono::steady_clock::now() + timeout;
+	const bool onMainThread = std::this_thread::get_id() == m_mainThread;
+
+	std::lock_guard<std::mutex> lock(m_sinkMutex);
+	if (onMainThread && !m_deferred.empty()) DispatchDeferredLocked();
+
+	bool idle = true;
+	for (const UPtr<OutputSink>& sink : m_sinks) {
+		if (!onMainThread && sink->RequiresMainThread()) continue;
+		sink->Flush();
+
+		const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+			deadline - std::chrono::steady_clock::now());
+		if (!sink->WaitIdle(std::max(left, std::chrono::milliseconds(0)))) idle = false;
+	}
+	return idle;
+}
+
+void CustomOutput::AppendWide(ThreadLine& local, const wchar_t* text, size_t length) {
+	if (!text || length == 0) return;
+
+	// Convert in place at the end of the line buffer - no temporary string
+	utf::AppendUtf8(local.line, std::wstring_view(text, length));
+}
+
+BenchResult CustomOutput::MeasureConcurrentLines(uint32_t iterations) {
+	using clock = std::chrono::steady_clock;
+
+	iterations			   = std::max(iterations, 1u);
+	const uint32_t warmup  = std::clamp(iterations / 10, 1u, 1000u);
+	const uint32_t threads = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+
+	CustomOutput output;
+	uint64_t	 lines = 0; // Only touched by the sink, which runs under m_sinkMutex
+	output.AddSink(std::make_unique<CallbackSink>([&lines](std::string_view) { lines++; }));
+
+	std::vector<std::vector<double>> samples(threads);
+	std::atomic<uint32_t>			 ready{0};
+	std::vector<std::thread>		 workers;
+	workers.reserve(threads);
+
+	for (uint32_t t = 0; t < threads; t++) {
+		workers.emplace_back([&, t]() {
+			std::vector<double>& mine = samples[t];
+			mine.reserve(iterations);
+
+			// Start together so the timed lines really overlap
+			ready.fetch_add(1, std::memory_order_acq_rel);
+			while (ready.load(std::memory_order_acquire) < threads) std::this_thread::yield();
+
+			for (uint32_t i = 0; i < warmup + iterations; i++) {
+				const auto start = clock::now();
+				output << tc::green << "[info] thread " << t << " frame " << i << " took "
+					   << 16.6667f << " ms" << tc::reset << std::endl;
+				const auto end = clock::now();
+				if (i >= warmup)
+					mine.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+			}
+		});
+	}
+	for (std::thread& worker : workers) worker.join();
+
+	if (lines != static_cast<uint64_t>(threads) * (warmup + iterations))
+		throw std::runtime_error("out_threads: lines were lost or duplicated");
+
+	std::vector<double> merged;
+	merged.reserve(static_cast<size_t>(threads) * iterations);
+	for (const std::vector<double>& mine : samples) merged.insert(merged.end(), mine.begin(), mine.end());
+	return Benchmark::FromSamples("out_threads", merged, warmup, 0, 0);
 }
 
 void OutputConsole::CreateConsole() {
@@ -128,181 +370,111 @@ void OutputConsole::ShowConsole(bool bShow) {
 	if (m_hWnd_console) ShowWindow(m_hWnd_console, m_bShowConsole ? SW_SHOW : SW_HIDE);
 }
 
-void OutputConsole::SetConsoleWindow(ConsoleWindow* consoleWindow) {
-	Out.SetConsoleWindow(consoleWindow);
+void OutputConsole::OnConsoleVisibilityChanged(const ConsoleVisibilityChanged& event) {
+	if (event.visible != m_bShowConsole) ShowConsole(event.visible);
 }
 
-CustomOutput& CustomOutput::operator<<(const std::string& dado) {
-	std::cout << dado;
-	m_buffer += dado;
-	FlushToConsoleWindow();
-	return *this;
+void OutputConsole::SetConsoleWindow(ConsoleWindow* consoleWindow) {
+	Out.SetConsoleWindow(consoleWindow);
 }
 
-CustomOutput& CustomOutput::operator<<(const long long& valor) {
-	{
-		std::cout << valor;
-		m_buffer += std::to_string(valor);
-		FlushToConsoleWindow();
-		return *this;
+CustomOutput& CustomOutput::operator<<(std::ostream& (*manip)(std::ostream&)) {
+	ThreadLine& local = Local();
+	if (manip == static_cast<std::ostream& (*)(std::ostream&)>(std::endl)) {
+		local.line.push_back('\n');
+		EmitLines(local);
+		FlushSinks();
+	} else if (manip == static_cast<std::ostream& (*)(std::ostream&)>(std::flush)) {
+		FlushSinks();
+	} else {
+		// termcolor manipulators write their ANSI sequence into the line
+		manip(local.stream);
+		EmitLines(local);
 	}
-}
-
-CustomOutput& CustomOutput::operator<<(const int& valor) {
-	std::cout << valor;
-	m_buffer += std::to_string(valor);
-	FlushToConsoleWindow();
-	return *this;
-}
-
-CustomOutput& CustomOutput::operator<<(const long double& valor) {
-
-	std::cout << valor;
-	m_buffer += std::to_string(valor);
-	FlushToConsoleWindow();
 	return *this;
 }
 
-CustomOutput& CustomOutput::operator<<(const float& valor) {
-	std::cout << valor;
-	m_buffer += std::to_string(valor);
-	FlushToConsoleWindow();
+CustomOutput& CustomOutput::operator<<(const std::string& dado) {
+	ThreadLine& local = Local();
+	local.line += dado;
+	EmitLines(local);
 	return *this;
 }
 
 CustomOutput& CustomOutput::operator<<(const char* dado) {
-	std::cout << dado;
-	
+	if (!dado) return *this;
+
+	ThreadLine& local = Local();
 	// Check if this is an ImGui color tag
-	if (dado && dado[0] == '[' && strchr(dado, ']')) {
-		m_currentColorTag = dado;
+	if (dado[0] == '[' && strchr(dado, ']')) {
+		local.colorTag = dado;
 		// Add color tag to buffer for ImGui console
-		m_buffer += dado;
-		m_buffer += " "; // Space after tag for cleaner appearance
+		local.line += dado;
+		local.line += ' '; // Space after tag for cleaner appearance
 	} else {
-		m_buffer += dado;
+		local.line += dado;
 	}
-	
-	FlushToConsoleWindow();
+
+	EmitLines(local);
 	return *this;
 }
 
 CustomOutput& CustomOutput::operator<<(const std::wstring& dado) {
-	std::wcout << dado;
-	// Convert wstring to UTF-8 string for ConsoleWindow
-	if (m_consoleWindow && !dado.empty()) {
-		int size_needed = WideCharToMultiByte(CP_UTF8, 0, dado.c_str(), (int)dado.size(), nullptr, 0, nullptr, nullptr);
-		if (size_needed > 0) {
-			std::string str(size_needed, 0);
-			WideCharToMultiByte(CP_UTF8, 0, dado.c_str(), (int)dado.size(), &str[0], size_needed, nullptr, nullptr);
-			m_buffer += str;
-			FlushToConsoleWindow();
-		}
-	}
+	ThreadLine& local = Local();
+	AppendWide(local, dado.c_str(), dado.size());
+	EmitLines(local);
 	return *this;
 }
 
 CustomOutput& CustomOutput::operator<<(const wchar_t* dado) {
-	std::wcout << dado;
-	// Convert wchar_t* to UTF-8 string for ConsoleWindow
-	if (m_consoleWindow && dado && dado[0] != L'\0') {
-		int len = (int)wcslen(dado);
-		int size_needed = WideCharToMultiByte(CP_UTF8, 0, dado, len, nullptr, 0, nullptr, nullptr);
-		if (size_needed > 0) {
-			std::string str(size_needed, 0);
-			WideCharToMultiByte(CP_UTF8, 0, dado, len, &str[0], size_needed, nullptr, nullptr);
-			m_buffer += str;
-			FlushToConsoleWindow();
-		}
-	}
+	ThreadLine& local = Local();
+	if (dado) AppendWide(local, dado, wcslen(dado));
+	EmitLines(local);
 	return *this;
 }
 
 void CustomOutput::WriteLine(const std::string& message) {
-	// Output to Windows console
-	std::cout << message << std::endl;
-	std::cout.flush();
-	
-	// Output to ImGui console window
-	if (m_consoleWindow) {
-		m_consoleWindow->AddLog("%s", message.c_str());
-	}
+	ThreadLine& local = Local();
+	local.line += message;
+	local.line += '\n';
+	EmitLines(local);
+	FlushSinks();
 }
 
 void CustomOutput::WriteLine(const std::wstring& message) {
-	// Output to Windows console
-	std::wcout << message << std::endl;
-	std::wcout.flush();
-	
-	// Output to ImGui console window (convert to UTF-8)
-	if (m_consoleWindow && !message.empty()) {
-		int size_needed = WideCharToMultiByte(CP_UTF8, 0, message.c_str(), (int)message.size(), nullptr, 0, nullptr, nullptr);
-		if (size_needed > 0) {
-			std::string str(size_needed, 0);
-			WideCharToMultiByte(CP_UTF8, 0, message.c_str(), (int)message.size(), &str[0], size_needed, nullptr, nullptr);
-			m_consoleWindow->AddLog("%s\n", str.c_str());
-		}
-	}
+	ThreadLine& local = Local();
+	AppendWide(local, message.c_str(), message.size());
+	local.line += '\n';
+	EmitLines(local);
+	FlushSinks();
 }
 
 void CustomOutput::Write(const std::string& message) {
-	// Output to Windows console without newline
-	std::cout << message;
-	std::cout.flush();
-	
-	// Add to buffer for ImGui console
-	m_buffer += message;
-	// Check if we should flush (if message contains newline)
-	if (message.find('\n') != std::string::npos) {
-		ForceFlush();
-	}
+	// Without a newline the text waits for the rest of its line
+	ThreadLine& local = Local();
+	local.line += message;
+	EmitLines(local);
 }
 
 void CustomOutput::Write(const std::wstring& message) {
-	// Output to Windows console without newline
-	std::wcout << message;
-	std::wcout.flush();
-	
-	// Convert and add to buffer for ImGui console
-	if (!message.empty()) {
-		int size_needed = WideCharToMultiByte(CP_UTF8, 0, message.c_str(), (int)message.size(), nullptr, 0, nullptr, nullptr);
-		if (size_needed > 0) {
-			std::string str(size_needed, 0);
-			WideCharToMultiByte(CP_UTF8, 0, message.c_str(), (int)message.size(), &str[0], size_needed, nullptr, nullptr);
-			m_buffer += str;
-			// Check if we should flush (if message contains newline)
-			if (str.find('\n') != std::string::npos) {
-				ForceFlush();
-			}
-		}
-	}
-}
-
-void CustomOutput::ForceFlush() {
-	if (m_consoleWindow && !m_buffer.empty()) {
-		// Remove trailing newline if present
-		if (m_buffer.back() == '\n') {
-			m_buffer.pop_back();
-		}
-		if (!m_buffer.empty()) {
-			m_consoleWindow->AddLog("%s", m_buffer.c_str());
-		}
-		m_buffer.clear();
-	}
+	ThreadLine& local = Local();
+	AppendWide(local, message.c_str(), message.size());
+	EmitLines(local);
 }
 
 CustomOutput& CustomOutput::SetImGuiColor(const char* colorTag) {
 	if (colorTag) {
-		m_currentColorTag = colorTag;
+		ThreadLine& local = Local();
+		local.colorTag	  = colorTag;
 		// Add color tag to buffer
-		m_buffer += colorTag;
-		m_buffer += " ";
+		local.line += colorTag;
+		local.line += ' ';
 	}
 	return *this;
 }
 
 CustomOutput& CustomOutput::ResetImGuiColor() {
-	m_currentColorTag.clear();
+	Local().colorTag.clear();
 	return *this;
 }
 
@@ -331,15 +503,7 @@ void CustomOutput::ShowSystemStatus() {
 				DXGI_ADAPTER_DESC1 desc;
 				adapter->GetDesc1(&desc);
 				
-				// Convert wide string to UTF-8
-				std::wstring wAdapterName(desc.Description);
-				int size_needed = WideCharToMultiByte(CP_UTF8, 0, wAdapterName.c_str(), (int)wAdapterName.size(), nullptr, 0, nullptr, nullptr);
-				std::string adapterName;
-				if (size_needed > 0) {
-					adapterName.resize(size_needed);
-					WideCharToMultiByte(CP_UTF8, 0, wAdapterName.c_str(), (int)wAdapterName.size(), &adapterName[0], size_needed, nullptr, nullptr);
-				}
-				WriteLine("  GPU: " + adapterName);
+				WriteLine("  GPU: " + utf::ToUtf8(desc.Description));
 				
 				// Video Memory
 				WriteLine("  Dedicated Video Memory: " + std::to_string(desc.DedicatedVideoMemory / (1024 * 1024)) + " MB");
@@ -430,11 +594,15 @@ void CustomOutput::ShowSystemStatus() {
 
 	// ImPlot Status
 	WriteLine("\n[IMPLOT CONTEXT]");
+#if APP_FEATURE_IMPLOT
 	if (ImPlot::GetCurrentContext()) {
 		WriteLine("  Context: Initialized");
 	} else {
 		WriteLine("  Context: Not Initialized");
 	}
+#else
+	WriteLine("  Context: Not compiled in");
+#endif
 
 	// Memory Info
 	WriteLine("\n[MEMORY STATUS]");
@@ -476,16 +644,4 @@ void CustomOutput::ShowSystemStatus() {
 	WriteLine(std::string(60, '='));
 }
 
-// CustomOutput& CustomOutput::operator<<(std::ostream& (*manip)(std::ostream&)) {
-//
-//	manip(std::cout);
-//	return *this;
-// }
-//
-// CustomOutput& CustomOutput::operator<<(std::wostream& (*manip)(std::wostream&)) {
-//
-//	manip(std::wcout);
-//	return *this;
-// }
-
 } // namespace app
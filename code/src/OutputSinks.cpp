@@ -0,0 +1,75 @@
+// OutputSinks.cpp
+// Implementation of the CustomOutput line sinks
+
+#include "PCH.hpp"
+#include "Classes.hpp"
+#include "OutputSinks.hpp"
+#include "AnsiParser.hpp"
+
+namespace app {
+
+// ============================================================================
+// NativeConsoleSink
+// ============================================================================
+
+NativeConsoleSink::NativeConsoleSink() : m_writer(), m_cvarVersion(~0u) {}
+
+void NativeConsoleSink::WriteLine(std::string_view line) {
+	const uint32_t version = cvars::ConsoleQueueKb.GetModificationCount() +
+							 cvars::ConsoleOverflow.GetModificationCount();
+	if (version != m_cvarVersion) {
+		m_cvarVersion = version;
+		m_writer.SetCapacity(static_cast<size_t>(cvars::ConsoleQueueKb.Get()) * 1024);
+		m_writer.SetOverflow(
+			static_cast<AsyncConsoleWriter::Overflow>(cvars::ConsoleOverflow.Get()));
+	}
+	m_writer.Write(line);
+}
+
+// ============================================================================
+// ConsoleWindowSink
+// ============================================================================
+
+ConsoleWindowSink::ConsoleWindowSink(ConsoleWindow* consoleWindow) : m_consoleWindow(consoleWindow) {}
+
+void ConsoleWindowSink::WriteLine(std::string_view line) {
+	if (m_consoleWindow) m_consoleWindow->AddLine(line);
+}
+
+// ============================================================================
+// FileSink
+// ============================================================================
+
+FileSink::FileSink(const fs::path& path, bool append) :
+m_file(path, std::ios::out | std::ios::binary | (append ? std::ios::app : std::ios::trunc)),
+m_plain() {}
+
+void FileSink::WriteLine(std::string_view line) {
+	if (!m_file.is_open()) return;
+	const std::string_view plain = AnsiParser::Strip(line, m_plain);
+	m_file.write(plain.data(), static_cast<std::streamsize>(plain.size()));
+	m_file.put('\n');
+}
+
+void FileSink::Flush() {
+	if (m_file.is_open()) m_file.flush();
+}
+
+// ============================================================================
+// MemorySink
+// ============================================================================
+
+MemorySink::MemorySink(size_t maxLines) : m_lines(), m_maxLines(std::max<size_t>(maxLines, 1)) {}
+
+void MemorySink::WriteLine(std::string_view line) {
+	if (m_lines.size() == m_maxLines) m_lines.pop_front();
+	m_lines.emplace_back(line);
+}
+
+// ============================================================================
+// CallbackSink
+// ============================================================================
+
+CallbackSink::CallbackSink(Callback callback) : m_callback(std::move(callback)) {}
+
+} // namespace app
@@ -0,0 +1,461 @@
+// PoolAllocator.cpp
+// Implementation of the size-class pools installed as ImGui's allocator
+
+#include "PCH.hpp"
+#include "PoolAllocator.hpp"
+
+namespace app {
+
+namespace {
+
+// Every pool ever created; never destroyed, since blocks can be freed during exit
+struct PoolRegistry {
+	std::mutex					mutex;
+	std::vector<SizeClassPool*> pools;
+	std::vector<SizeClassPool*> parked; // Pools of threads that exited
+
+	// Sample() state
+	int64_t							  peakLiveBytes = 0;
+	uint64_t						  rateAllocs	= 0;
+	std::chrono::steady_clock::time_point rateStart;
+	double							  allocsPerSecond = 0.0;
+
+#if APP_MEMORY_TAGS && APP_FEATURE_IMPLOT
+	PoolAllocator::TagHistory			  tagHistory{};
+	std::chrono::steady_clock::time_point historyStart;
+	std::chrono::steady_clock::time_point historyLast;
+#endif
+};
+
+PoolRegistry& Registry() {
+	static PoolRegistry* registry = new PoolRegistry();
+	return *registry;
+}
+
+thread_local SizeClassPool* t_pool	  = nullptr;
+thread_local bool			t_exiting = false;
+
+SizeClassPool* AcquirePool();
+
+// Parks the thread's pool when the thread exits
+struct ThreadPoolOwner {
+	SizeClassPool* pool = nullptr;
+
+	~ThreadPoolOwner() {
+		t_exiting = true;
+		t_pool	  = nullptr;
+		if (!pool) return;
+
+		PoolRegistry&				registry = Registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.parked.push_back(pool);
+	}
+};
+
+thread_local ThreadPoolOwner t_owner;
+
+SizeClassPool* AcquirePool() {
+	PoolRegistry& registry = Registry();
+	{
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		if (!registry.parked.empty()) {
+			t_pool = registry.parked.back();
+			registry.parked.pop_back();
+		}
+	}
+	if (!t_pool) {
+		// Created outside the lock: its constructor allocates nothing from the pools
+		SizeClassPool*				pool = new SizeClassPool();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		registry.pools.push_back(pool);
+		t_pool = pool;
+	}
+	t_owner.pool = t_pool;
+	return t_pool;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// SizeClassPool
+// ---------------------------------------------------------------------------
+
+SizeClassPool::SizeClassPool() :
+m_free{},
+m_bump{},
+m_bumpEnd{},
+m_spans(nullptr),
+m_remote(nullptr),
+m_allocs(0),
+m_frees(0),
+m_liveBytes(0),
+m_reservedBytes(0),
+m_histogram{} {
+#if APP_MEMORY_TAGS
+	for (uint32_t i = 0; i < kMemTagCount; i++) {
+		m_tagBytes[i].store(0, std::memory_order_relaxed);
+		m_tagBlocks[i].store(0, std::memory_order_relaxed);
+	}
+#endif
+}
+
+SizeClassPool::~SizeClassPool() {
+	DrainRemote();
+	while (m_spans) {
+		Span* next = m_spans->next;
+		VirtualFree(m_spans, 0, MEM_RELEASE);
+		m_spans = next;
+	}
+}
+
+void* SizeClassPool::Allocate(size_t size) {
+	if (m_remote.load(std::memory_order_relaxed)) DrainRemote();
+
+	const size_t total = size + kHeaderBytes;
+	Header*		 header;
+	uint32_t	 cls;
+	if (total > kMaxBlockBytes) {
+		header = static_cast<Header*>(std::malloc(total));
+		if (!header) return nullptr;
+		cls = kLargeClass;
+		Bump<uint64_t>(m_reservedBytes, total);
+	} else {
+		cls	   = ClassOf(total);
+		header = m_free[cls];
+		if (header) {
+			m_free[cls] = header->next;
+		} else {
+			header = Carve(cls);
+			if (!header) return nullptr;
+		}
+	}
+
+	header->owner	  = this;
+	header->requested = static_cast<uint32_t>(std::min<size_t>(size, UINT32_MAX));
+	header->cls		  = static_cast<uint8_t>(cls);
+	header->tag		  = MemTagScope::Current();
+
+	Bump<uint64_t>(m_allocs, 1);
+	Bump<int64_t>(m_liveBytes, static_cast<int64_t>(header->requested));
+	Bump<uint64_t>(m_histogram[cls], 1);
+#if APP_MEMORY_TAGS
+	Bump<int64_t>(m_tagBytes[static_cast<uint32_t>(header->tag)], static_cast<int64_t>(header->requested));
+	Bump<int64_t>(m_tagBlocks[static_cast<uint32_t>(header->tag)], 1);
+#endif
+	return header + 1;
+}
+
+void SizeClassPool::Free(void* ptr) { Release(static_cast<Header*>(ptr) - 1); }
+
+void SizeClassPool::FreeRemote(void* ptr) {
+	Header* header = static_cast<Header*>(ptr) - 1;
+	Header* head   = m_remote.load(std::memory_order_relaxed);
+	do {
+		header->next = head;
+	} while (!m_remote.compare_exchange_weak(head, header, std::memory_order_release,
+											 std::memory_order_relaxed));
+}
+
+SizeClassPool* SizeClassPool::OwnerOf(void* ptr) { return (static_cast<Header*>(ptr) - 1)->owner; }
+
+void SizeClassPool::AddStats(Stats& out) const {
+	out.allocs += m_allocs.load(std::memory_order_relaxed);
+	out.frees += m_frees.load(std::memory_order_relaxed);
+	out.liveBytes += m_liveBytes.load(std::memory_order_relaxed);
+	out.reservedBytes += m_reservedBytes.load(std::memory_order_relaxed);
+	for (uint32_t i = 0; i <= kClassCount; i++) out.histogram[i] += m_histogram[i].load(std::memory_order_relaxed);
+#if APP_MEMORY_TAGS
+	for (uint32_t i = 0; i < kMemTagCount; i++) {
+		out.tagBytes[i] += m_tagBytes[i].load(std::memory_order_relaxed);
+		out.tagBlocks[i] += m_tagBlocks[i].load(std::memory_order_relaxed);
+	}
+#endif
+}
+
+SizeClassPool::Header* SizeClassPool::Carve(uint32_t cls) {
+	const size_t blockBytes = ClassSize(cls);
+	if (!m_bump[cls] || m_bump[cls] + blockBytes > m_bumpEnd[cls]) {
+		// At least 8 blocks per span so the largest classes do not take a span each
+		const size_t bytes = std::max(kSpanBytes, blockBytes * 8);
+		Span*		 span  = static_cast<Span*>(VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+		if (!span) return nullptr;
+		span->next	   = m_spans;
+		span->bytes	   = bytes;
+		m_spans		   = span;
+		m_bump[cls]	   = reinterpret_cast<char*>(span) + sizeof(Span);
+		m_bumpEnd[cls] = reinterpret_cast<char*>(span) + bytes;
+		Bump<uint64_t>(m_reservedBytes, bytes);
+	}
+
+	Header* header = reinterpret_cast<Header*>(m_bump[cls]);
+	m_bump[cls] += blockBytes;
+	return header;
+}
+
+void SizeClassPool::Release(Header* header) {
+	const uint32_t cls = header->cls;
+	Bump<uint64_t>(m_frees, 1);
+	Bump<int64_t>(m_liveBytes, -static_cast<int64_t>(header->requested));
+#if APP_MEMORY_TAGS
+	Bump<int64_t>(m_tagBytes[static_cast<uint32_t>(header->tag)], -static_cast<int64_t>(header->requested));
+	Bump<int64_t>(m_tagBlocks[static_cast<uint32_t>(header->tag)], -1);
+#endif
+
+	if (cls == kLargeClass) {
+		Bump<uint64_t>(m_reservedBytes, 0 - uint64_t(header->requested + kHeaderBytes));
+		std::free(header);
+		return;
+	}
+	header->next = m_free[cls];
+	m_free[cls]	 = header;
+}
+
+void SizeClassPool::DrainRemote() {
+	Header* header = m_remote.exchange(nullptr, std::memory_order_acquire);
+	while (header) {
+		Header* next = header->next;
+		Release(header);
+		header = next;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// PoolAllocator
+// ---------------------------------------------------------------------------
+
+bool PoolAllocator::s_installed = false;
+
+void PoolAllocator::Install() {
+	if (s_installed) return;
+	ImGui::SetAllocatorFunctions(&PoolAllocator::Alloc, &PoolAllocator::Free, nullptr);
+	s_installed = true;
+
+	PoolRegistry&				registry = Registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.rateStart = std::chrono::steady_clock::now();
+#if APP_MEMORY_TAGS && APP_FEATURE_IMPLOT
+	registry.historyStart = registry.rateStart;
+#endif
+}
+
+void* PoolAllocator::Alloc(size_t size, void* user_data) {
+	IM_UNUSED(user_data);
+	SizeClassPool* pool = t_pool;
+	if (!pool) {
+		if (t_exiting) {
+			// Thread-local destructors of an exiting thread: no pool to own the block
+			auto* header = static_cast<SizeClassPool**>(std::malloc(size + SizeClassPool::kHeaderBytes));
+			if (!header) return nullptr;
+			header[0] = nullptr;
+			return reinterpret_cast<char*>(header) + SizeClassPool::kHeaderBytes;
+		}
+		pool = AcquirePool();
+	}
+	return pool->Allocate(size);
+}
+
+void PoolAllocator::Free(void* ptr, void* user_data) {
+	IM_UNUSED(user_data);
+	if (!ptr) return;
+
+	SizeClassPool* owner = SizeClassPool::OwnerOf(ptr);
+	if (owner == t_pool && owner) {
+		owner->Free(ptr);
+	} else if (owner) {
+		owner->FreeRemote(ptr);
+	} else {
+		std::free(static_cast<char*>(ptr) - SizeClassPool::kHeaderBytes);
+	}
+}
+
+void PoolAllocator::Sample() {
+	const Snapshot snapshot = GetSnapshot();
+	const auto	   now		= std::chrono::steady_clock::now();
+
+	PoolRegistry&				registry = Registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.peakLiveBytes = std::max(registry.peakLiveBytes, snapshot.totals.liveBytes);
+
+	const double elapsed = std::chrono::duration<double>(now - registry.rateStart).count();
+	if (elapsed >= 1.0) {
+		registry.allocsPerSecond = static_cast<double>(snapshot.totals.allocs - registry.rateAllocs) / elapsed;
+		registry.rateAllocs		 = snapshot.totals.allocs;
+		registry.rateStart		 = now;
+	}
+
+#if APP_MEMORY_TAGS && APP_FEATURE_IMPLOT
+	if (now - registry.historyLast >= std::chrono::milliseconds(500)) {
+		TagHistory& history = registry.tagHistory;
+		history.time[history.next] = std::chrono::duration<float>(now - registry.historyStart).count();
+		for (uint32_t i = 0; i < kMemTagCount; i++)
+			history.kib[i][history.next] = static_cast<float>(snapshot.totals.tagBytes[i] / 1024.0);
+		history.next  = (history.next + 1) % TagHistory::kPoints;
+		history.count = std::min(history.count + 1, TagHistory::kPoints);
+		registry.historyLast = now;
+	}
+#endif
+}
+
+PoolAllocator::Snapshot PoolAllocator::GetSnapshot() {
+	Snapshot snapshot{};
+
+	PoolRegistry&				registry = Registry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	for (const SizeClassPool* pool : registry.pools) pool->AddStats(snapshot.totals);
+	snapshot.peakLiveBytes	 = std::max(registry.peakLiveBytes, snapshot.totals.liveBytes);
+	snapshot.allocsPerSecond = registry.allocsPerSecond;
+	snapshot.pools			 = static_cast<uint32_t>(registry.pools.size());
+	return snapshot;
+}
+
+#if APP_MEMORY_TAGS && APP_FEATURE_IMPLOT
+const PoolAllocator::TagHistory& PoolAllocator::GetTagHistory() { return Registry().tagHistory; }
+#endif
+
+BenchResult PoolAllocator::MeasureSession(uint32_t frames, bool pooled, SessionReport& report) {
+	using Clock = std::chrono::steady_clock;
+
+	struct Block {
+		void*	 ptr;
+		uint32_t size;
+	};
+
+	SizeClassPool pool;
+	HANDLE		  heap = pooled ? nullptr : HeapCreate(0, 0, 0);
+	if (!pooled && !heap) throw std::runtime_error("HeapCreate failed");
+
+	uint64_t live	  = 0;
+	auto	 allocate = [&](uint32_t size) -> Block {
+		live += size;
+		void* ptr = pooled ? pool.Allocate(size) : HeapAlloc(heap, 0, size);
+		if (!ptr) throw std::bad_alloc();
+		std::memset(ptr, 0x5A, std::min<uint32_t>(size, 64)); // Touch it like a real user would
+		return Block{ptr, size};
+	};
+	auto release = [&](const Block& block) {
+		live -= block.size;
+		if (pooled) pool.Free(block.ptr);
+		else HeapFree(heap, 0, block.ptr);
+	};
+
+	// Deterministic script, so both allocators see the same requests
+	uint32_t seed = 0x9E3779B9u;
+	auto	 rng  = [&seed](uint32_t range) {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		return seed % range;
+	};
+	auto temporarySize = [&rng]() -> uint32_t {
+		const uint32_t roll = rng(100);
+		if (roll < 70) return 16 + rng(112);
+		if (roll < 95) return 128 + rng(896);
+		return 1024 + rng(7168);
+	};
+
+	constexpr size_t kConsoleCapacity = 2000; // Lines kept, as with the default log_capacity
+	constexpr int	 kDrawLists		  = 4;
+
+	std::vector<Block>						 temporaries;
+	std::deque<std::pair<Block, Block>>		 consoleLines; // Text and (optional) spans
+	std::deque<std::pair<uint32_t, Block>>	 burstSurvivors; // Frame to free at, block
+	Block									 drawLists[kDrawLists];
+	uint32_t								 drawListUsed[kDrawLists];
+	for (int i = 0; i < kDrawLists; i++) {
+		drawLists[i]	= allocate(1024);
+		drawListUsed[i] = 512;
+	}
+
+	std::vector<double> samples;
+	samples.reserve(frames);
+
+	for (uint32_t frame = 0; frame < frames; frame++) {
+		const Clock::time_point begin = Clock::now();
+
+		// Per-frame temporaries (labels, ImStr, widget scratch)
+		const uint32_t count = 16 + rng(16);
+		for (uint32_t i = 0; i < count; i++) temporaries.push_back(allocate(temporarySize()));
+
+		// Draw lists: ImVector growth by 1.5x when the frame needs more
+		for (int i = 0; i < kDrawLists; i++) {
+			const int32_t delta = static_cast<int32_t>(rng(513)) - 256;
+			drawListUsed[i] = static_cast<uint32_t>(std::clamp<int32_t>(int32_t(drawListUsed[i]) + delta, 256, 60 * 1024));
+			if (drawListUsed[i] > drawLists[i].size) {
+				Block grown = allocate(std::max(drawListUsed[i], drawLists[i].size + drawLists[i].size / 2));
+				release(drawLists[i]);
+				drawLists[i] = grown;
+			}
+		}
+
+		// Console lines (Wcsdup + spans), oldest dropped at capacity
+		if (rng(4) == 0) {
+			for (uint32_t n = 1 + rng(3); n > 0; n--) {
+				const Block text  = allocate((20 + rng(180)) * 2);
+				const Block spans = rng(3) == 0 ? allocate(16 + rng(48)) : Block{nullptr, 0};
+				consoleLines.emplace_back(text, spans);
+				if (consoleLines.size() > kConsoleCapacity) {
+					release(consoleLines.front().first);
+					if (consoleLines.front().second.ptr) release(consoleLines.front().second);
+					consoleLines.pop_front();
+				}
+			}
+		}
+
+		// Tab completion: candidate list grown 8 -> 256 pointers, then dropped
+		if (frame % 30 == 0) {
+			Block candidates = allocate(8 * sizeof(void*));
+			for (uint32_t capacity = 16; capacity <= 256; capacity *= 2) {
+				Block grown = allocate(capacity * sizeof(void*));
+				release(candidates);
+				candidates = grown;
+			}
+			release(candidates);
+		}
+
+		// Every 10 s a burst (a 'fonts' listing, a pasted log): half dies now, half in 5 s
+		if (frame % 600 == 0) {
+			for (int i = 0; i < 500; i++) {
+				const Block block = allocate(40 + rng(1960));
+				if (i % 2) temporaries.push_back(block);
+				else burstSurvivors.emplace_back(frame + 300, block);
+			}
+		}
+		while (!burstSurvivors.empty() && burstSurvivors.front().first <= frame) {
+			release(burstSurvivors.front().second);
+			burstSurvivors.pop_front();
+		}
+
+		for (const Block& block : temporaries) release(block);
+		temporaries.clear();
+
+		samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - begin).count());
+	}
+
+	// Fragmentation is measured with the long-lived blocks still allocated
+	report.liveBytes = live;
+	if (pooled) {
+		SizeClassPool::Stats stats{};
+		pool.AddStats(stats);
+		report.committedBytes = stats.reservedBytes;
+	} else {
+		report.committedBytes = 0;
+		PROCESS_HEAP_ENTRY entry{};
+		HeapLock(heap);
+		while (HeapWalk(heap, &entry)) {
+			if (entry.wFlags & PROCESS_HEAP_REGION) report.committedBytes += entry.Region.dwCommittedSize;
+		}
+		HeapUnlock(heap);
+	}
+
+	for (const auto& [text, spans] : consoleLines) {
+		release(text);
+		if (spans.ptr) release(spans);
+	}
+	for (const auto& [when, block] : burstSurvivors) release(block);
+	for (const Block& block : drawLists) release(block);
+	if (heap) HeapDestroy(heap);
+
+	return Benchmark::FromSamples(pooled ? "alloc_session_pool" : "alloc_session_heap", samples, 0, 0, 0);
+}
+
+} // namespace app
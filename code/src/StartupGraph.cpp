@@ -0,0 +1,259 @@
+// StartupGraph.cpp
+// Implementation of the dependency-ordered startup scheduler
+
+#include "PCH.hpp"
+#include "StartupGraph.hpp"
+
+namespace app {
+
+namespace {
+
+double ToMs(StartupGraph::Clock::duration duration) {
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // namespace
+
+StartupGraph::StartupGraph() :
+m_mutex(),
+m_workReady(),
+m_mainReady(),
+m_steps(),
+m_index(),
+m_firstPending(0),
+m_readyMain(),
+m_readyAny(),
+m_lastMainStep(kNoStep),
+m_remaining(0),
+m_running(0),
+m_result(S_OK),
+m_exception(),
+m_workers(),
+m_stop(false),
+m_start() {}
+
+StartupGraph::~StartupGraph() { Finish(); }
+
+void StartupGraph::Add(std::string_view name, std::initializer_list<std::string_view> dependencies,
+					   Affinity affinity, StepFn fn) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::string key(name);
+	if (m_index.count(key)) throw std::invalid_argument("Startup step '" + key + "' was added twice");
+
+	Step step{};
+	step.name	  = key;
+	step.affinity = affinity;
+	step.fn		  = std::move(fn);
+	step.heldBy	  = kNoStep;
+	step.dependencyNames.assign(dependencies.begin(), dependencies.end());
+
+	m_index.emplace(std::move(key), m_steps.size());
+	m_steps.push_back(std::move(step));
+}
+
+HRESULT StartupGraph::Run() {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (m_stop) throw std::logic_error("StartupGraph::Run() called after Finish()");
+
+	const size_t first = m_firstPending;
+	const size_t last  = m_steps.size();
+	if (first == last) return S_OK;
+	m_firstPending = last;
+
+	// Resolve dependencies; ones that finished in an earlier batch are already met
+	bool hasWorkerSteps = false;
+	for (size_t i = first; i < last; i++) {
+		Step& step = m_steps[i];
+		for (const std::string& name : step.dependencyNames) {
+			const auto found = m_index.find(name);
+			if (found == m_index.end())
+				throw std::invalid_argument("Startup step '" + step.name + "' depends on unknown step '" +
+											name + "'");
+
+			const size_t dependency = found->second;
+			step.dependencies.push_back(dependency);
+			if (m_steps[dependency].done) continue;
+			if (dependency < first)
+				throw std::logic_error("Startup step '" + step.name + "' depends on '" + name +
+									   "', which did not run");
+
+			m_steps[dependency].dependents.push_back(i);
+			step.waitingOn++;
+		}
+		if (step.affinity == Affinity::Any) hasWorkerSteps = true;
+	}
+
+	// Reject cycles up front; they would otherwise leave Run() waiting forever
+	{
+		std::vector<size_t> waiting(last - first);
+		std::vector<size_t> order;
+		for (size_t i = first; i < last; i++) {
+			waiting[i - first] = m_steps[i].waitingOn;
+			if (waiting[i - first] == 0) order.push_back(i);
+		}
+		for (size_t n = 0; n < order.size(); n++) {
+			for (const size_t dependent : m_steps[order[n]].dependents) {
+				if (--waiting[dependent - first] == 0) order.push_back(dependent);
+			}
+		}
+		if (order.size() != last - first) throw std::logic_error("Startup steps form a dependency cycle");
+	}
+
+	if (m_start == Clock::time_point()) m_start = Clock::now();
+	m_remaining = last - first;
+	m_result	= S_OK;
+	m_exception = nullptr;
+
+	if (hasWorkerSteps && m_workers.empty()) {
+		const uint32_t hardware = std::thread::hardware_concurrency();
+		const uint32_t count	= std::clamp<uint32_t>(hardware > 1 ? hardware - 1 : 1, 1, kMaxWorkers);
+		for (uint32_t i = 0; i < count; i++) m_workers.emplace_back(&StartupGraph::WorkerFunction, this);
+	}
+
+	for (size_t i = first; i < last; i++) {
+		if (m_steps[i].waitingOn != 0) continue;
+		(m_steps[i].affinity == Affinity::MainThread ? m_readyMain : m_readyAny).push_back(i);
+	}
+	m_workReady.notify_all();
+
+	// The calling thread runs the main-thread steps as they become ready
+	for (;;) {
+		m_mainReady.wait(lock, [this]() { return !m_readyMain.empty() || IsBatchOverLocked(); });
+		if (m_readyMain.empty()) break;
+
+		const size_t index = m_readyMain.front();
+		m_readyMain.pop_front();
+		RunStep(index, lock);
+	}
+
+	if (m_exception) std::rethrow_exception(std::exchange(m_exception, nullptr));
+	return m_result;
+}
+
+void StartupGraph::Finish() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_workReady.notify_all();
+
+	for (std::thread& worker : m_workers) {
+		if (worker.joinable()) worker.join();
+	}
+}
+
+void StartupGraph::WorkerFunction() {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;) {
+		m_workReady.wait(lock, [this]() { return m_stop || !m_readyAny.empty(); });
+		if (m_readyAny.empty()) return; // Stopping
+
+		const size_t index = m_readyAny.front();
+		m_readyAny.pop_front();
+		RunStep(index, lock);
+	}
+}
+
+void StartupGraph::RunStep(size_t index, std::unique_lock<std::mutex>& lock) {
+	Step& step = m_steps[index];
+	m_running++;
+
+	// Whatever held this step up last: a dependency or, for a main-thread step,
+	// the main-thread step that ran right before it. All of them have finished.
+	auto consider = [this, &step](size_t candidate) {
+		if (step.heldBy == kNoStep || m_steps[candidate].end > m_steps[step.heldBy].end) step.heldBy = candidate;
+	};
+	for (const size_t dependency : step.dependencies) consider(dependency);
+	if (step.affinity == Affinity::MainThread && m_lastMainStep != kNoStep) consider(m_lastMainStep);
+	lock.unlock();
+
+	HRESULT			   hr = S_OK;
+	std::exception_ptr error;
+	step.begin = Clock::now();
+	try {
+		hr = step.fn();
+	} catch (...) {
+		error = std::current_exception();
+	}
+	step.end = Clock::now();
+
+	lock.lock();
+	m_running--;
+
+	if (error || FAILED(hr)) {
+		// Keep the first failure; nothing new starts from here on
+		if (!IsFailedLocked()) {
+			if (error) {
+				m_exception = error;
+			} else {
+				m_result = hr;
+			}
+		}
+		m_readyMain.clear();
+		m_readyAny.clear();
+	} else {
+		step.done = true;
+		m_remaining--;
+		if (step.affinity == Affinity::MainThread) m_lastMainStep = index;
+
+		bool releasedWorkerStep = false;
+		if (!IsFailedLocked()) {
+			for (const size_t dependent : step.dependents) {
+				Step& next = m_steps[dependent];
+				if (--next.waitingOn != 0) continue;
+				if (next.affinity == Affinity::MainThread) {
+					m_readyMain.push_back(dependent);
+				} else {
+					m_readyAny.push_back(dependent);
+					releasedWorkerStep = true;
+				}
+			}
+		}
+		if (releasedWorkerStep) m_workReady.notify_all();
+	}
+
+	m_mainReady.notify_one();
+}
+
+std::string StartupGraph::FormatReport() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// The step that finished last ends the critical path
+	const Step*		  lastStep = nullptr;
+	Clock::duration	  work{};
+	size_t			  ran = 0;
+	for (const Step& step : m_steps) {
+		if (!step.done) continue;
+		ran++;
+		work += step.end - step.begin;
+		if (!lastStep || step.end > lastStep->end) lastStep = &step;
+	}
+	if (!lastStep) return "Startup: no steps have run";
+
+	// Walk back through what held each step up, as recorded when it started.
+	// Each link points to a step that finished earlier, so the walk ends.
+	std::vector<const Step*> path;
+	for (const Step* step = lastStep; step;) {
+		path.push_back(step);
+		step = step->heldBy != kNoStep ? &m_steps[step->heldBy] : nullptr;
+	}
+	std::reverse(path.begin(), path.end());
+
+	char		line[192];
+	std::string report;
+	std::snprintf(line, sizeof(line),
+				  "Startup: %.1f ms wall, %.1f ms of work in %zu steps on 1 + %zu worker threads\n",
+				  ToMs(lastStep->end - m_start), ToMs(work), ran, m_workers.size());
+	report += line;
+	report += "Critical path (start, duration):";
+	for (const Step* step : path) {
+		std::snprintf(line, sizeof(line), "\n  %8.2f ms %8.2f ms  %s%s", ToMs(step->begin - m_start),
+					  ToMs(step->end - step->begin), step->name.c_str(),
+					  step->affinity == Affinity::MainThread ? " [main]" : "");
+		report += line;
+	}
+	return report;
+}
+
+} // namespace app
@@ -0,0 +1,130 @@
+// StringPool.cpp
+// Implementation of the process-wide string intern table
+
+#include "PCH.hpp"
+#include "StringPool.hpp"
+
+namespace app {
+
+StringPool* StringPool::Get_StringPool_Singleton() {
+	// Leaked on purpose: views handed out must outlive every static destructor
+	// that may still read them
+	static StringPool* instance = new StringPool();
+	return instance;
+}
+
+StringPool::StringPool() :
+m_mutex(),
+m_segments(),
+m_count(1),
+m_table(1024, 0),
+m_chunks(),
+m_chunkPos(nullptr),
+m_chunkLeft(0),
+m_bytes(0) {
+	// Id 0 is the empty string; it is never in the hash table
+	Entry* segment = new Entry[kSegmentSize];
+	segment[0]	   = Entry{"", 0, 0};
+	m_segments[0].store(segment, std::memory_order_release);
+}
+
+uint32_t StringPool::Hash(std::string_view text) {
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+	for (const char c : text) hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+	return hash;
+}
+
+const StringPool::Entry& StringPool::GetEntry(uint32_t id) const {
+	IM_ASSERT(id < m_count.load(std::memory_order_acquire));
+	return m_segments[id >> kSegmentBits].load(std::memory_order_acquire)[id & (kSegmentSize - 1)];
+}
+
+uint32_t StringPool::Intern(std::string_view text) {
+	if (text.empty()) return 0;
+
+	const uint32_t				hash = Hash(text);
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	size_t slot;
+	if (const uint32_t found = FindLocked(text, hash, slot)) return found;
+
+	const uint32_t id = m_count.load(std::memory_order_relaxed);
+	if (id >= kMaxSegments * kSegmentSize) throw std::runtime_error("String pool is full");
+
+	std::atomic<Entry*>& segmentSlot = m_segments[id >> kSegmentBits];
+	Entry*				 segment	 = segmentSlot.load(std::memory_order_relaxed);
+	if (!segment) {
+		segment = new Entry[kSegmentSize];
+		segmentSlot.store(segment, std::memory_order_release);
+	}
+	segment[id & (kSegmentSize - 1)] = Entry{StoreLocked(text), static_cast<uint32_t>(text.size()), hash};
+	m_count.store(id + 1, std::memory_order_release);
+
+	m_table[slot] = id;
+	if (size_t(id) * 4 >= m_table.size() * 3) GrowTableLocked(); // Load factor 0.75
+	return id;
+}
+
+uint32_t StringPool::Find(std::string_view text) const {
+	if (text.empty()) return 0;
+
+	const uint32_t				hash = Hash(text);
+	std::lock_guard<std::mutex> lock(m_mutex);
+	size_t						slot;
+	const uint32_t				id = FindLocked(text, hash, slot);
+	return id ? id : kInvalidId;
+}
+
+std::string_view StringPool::View(uint32_t id) const {
+	const Entry& entry = GetEntry(id);
+	return std::string_view(entry.text, entry.length);
+}
+
+size_t StringPool::GetBytes() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_bytes;
+}
+
+uint32_t StringPool::FindLocked(std::string_view text, uint32_t hash, size_t& slot) const {
+	const size_t mask = m_table.size() - 1;
+	for (slot = hash & mask; m_table[slot]; slot = (slot + 1) & mask) {
+		const Entry& entry = GetEntry(m_table[slot]);
+		if (entry.hash == hash && entry.length == text.size() &&
+			std::memcmp(entry.text, text.data(), text.size()) == 0)
+			return m_table[slot];
+	}
+	return 0;
+}
+
+void StringPool::GrowTableLocked() {
+	std::vector<uint32_t> table(m_table.size() * 2, 0);
+	const size_t		  mask	= table.size() - 1;
+	const uint32_t		  count = m_count.load(std::memory_order_relaxed);
+	for (uint32_t id = 1; id < count; id++) {
+		size_t slot = GetEntry(id).hash & mask;
+		while (table[slot]) slot = (slot + 1) & mask;
+		table[slot] = id;
+	}
+	m_table.swap(table);
+}
+
+char* StringPool::StoreLocked(std::string_view text) {
+	const size_t bytes = text.size() + 1;
+	if (bytes > m_chunkLeft) {
+		const size_t size = std::max(kChunkBytes, bytes);
+		m_chunks.push_back(std::make_unique<char[]>(size));
+		m_chunkPos	= m_chunks.back().get();
+		m_chunkLeft = size;
+	}
+
+	char* stored = m_chunkPos;
+	std::memcpy(stored, text.data(), text.size());
+	stored[text.size()] = '\0';
+	m_chunkPos += bytes;
+	m_chunkLeft -= bytes;
+	m_bytes += bytes;
+	return stored;
+}
+
+} // namespace app
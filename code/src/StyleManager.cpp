@@ -17,7 +17,7 @@ namespace app {
  * Uses UTF-8 encoding for file operations and wide strings for paths.
  */
 StyleManager::StyleManager() :
-m_styleConfig(), m_configFilePath(L"style_config.json"), m_bConfigLoaded(false) {
+m_styleConfig(), m_configFilePath(L"style_config.json"), m_bConfigLoaded(false), m_bClosed(false) {
 	// Don't call ImGui functions here - ImGui context might not exist yet during construction
 	// ApplyPresetDark() and CaptureStyleFromImGui() will be called in Open() instead
 }
@@ -25,11 +25,11 @@ m_styleConfig(), m_configFilePath(L"style_config.json"), m_bConfigLoaded(false)
 /**
  * @brief Destructor - Cleans up resources
  *
- * Automatically saves configuration before destruction to ensure
- * any changes are persisted to disk.
+ * Saves the configuration if Close() was never called, so changes are
+ * persisted without writing the file twice on a normal shutdown.
  */
 StyleManager::~StyleManager() {
-	SaveConfiguration();
+	if (!m_bClosed) SaveConfiguration();
 	m_bConfigLoaded = false;
 }
 
@@ -44,7 +44,19 @@ StyleManager::~StyleManager() {
  */
 void StyleManager::Open() {
 	// Try to load saved configuration first
-	if (!LoadConfiguration()) {
+	FinishOpen(LoadConfiguration());
+}
+
+/**
+ * @brief Second half of Open(), for callers that ran LoadConfiguration() elsewhere
+ *
+ * Startup reads style_config.json on a worker thread; this part touches the
+ * ImGui style and runs on the main thread once the context exists.
+ *
+ * @param configLoaded Result of LoadConfiguration()
+ */
+void StyleManager::FinishOpen(bool configLoaded) {
+	if (!configLoaded) {
 		// No saved config found or config is invalid - initialize with default dark theme
 		std::wcout << L"No valid style configuration found, applying default Dark theme" << std::endl;
 		ApplyPresetDark();
@@ -77,12 +89,15 @@ void StyleManager::Tick() {
 /**
  * @brief Closes the style manager
  *
- * Saves the current style configuration to disk before closing.
+ * Writes the style captured last to disk before closing. It does not read
+ * ImGui, so App::Shutdown() can run it on another thread: the style is
+ * captured on the main thread first, while the context is known to be alive.
  *
  * @override Master::Close()
  */
 void StyleManager::Close() {
-	SaveConfiguration();
+	WriteConfiguration();
+	m_bClosed = true;
 	std::wcout << L"StyleManager closed and configuration saved" << std::endl;
 }
 
@@ -92,20 +107,22 @@ void StyleManager::Close() {
  * Uses reflectcpp to deserialize JSON into StyleConfiguration struct.
  * If the file doesn't exist or parsing fails, returns false.
  *
+ * @param out Receives progress messages
+ * @param err Receives error messages
  * @return true if configuration was loaded successfully, false otherwise
  */
-bool StyleManager::LoadConfiguration() {
+bool StyleManager::LoadConfiguration(std::wostream& out, std::wostream& err) {
 	try {
 		// Check if file exists
 		if (!fs::exists(m_configFilePath)) {
-			std::wcout << L"Style configuration file not found: " << m_configFilePath << std::endl;
+			out << L"Style configuration file not found: " << m_configFilePath << std::endl;
 			return false;
 		}
 
 		// Open file with UTF-8 encoding
 		std::ifstream file(m_configFilePath, std::ios::in | std::ios::binary);
 		if (!file.is_open()) {
-			std::wcerr << L"Failed to open style configuration file: " << m_configFilePath
+			err << L"Failed to open style configuration file: " << m_configFilePath
 					   << std::endl;
 			return false;
 		}
@@ -121,7 +138,7 @@ bool StyleManager::LoadConfiguration() {
 		// Validate loaded config - check if it has valid values
 		// If Alpha is 0, the config was never properly initialized
 		if (m_styleConfig.Alpha <= 0.0f) {
-			std::wcout << L"Loaded style configuration appears invalid (Alpha = 0), using defaults" << std::endl;
+			out << L"Loaded style configuration appears invalid (Alpha = 0), using defaults" << std::endl;
 			return false;
 		}
 
@@ -129,7 +146,9 @@ bool StyleManager::LoadConfiguration() {
 		return true;
 
 	} catch (const std::exception& e) {
-		std::cerr << "Error loading style configuration: " << e.what() << std::endl;
+		std::string	 errorMsg = e.what();
+		err << L"Error loading style configuration: " << std::wstring(errorMsg.begin(), errorMsg.end())
+			<< std::endl;
 		return false;
 	}
 }
@@ -137,35 +156,42 @@ bool StyleManager::LoadConfiguration() {
 /**
  * @brief Saves current style configuration to JSON file with UTF-8 encoding
  *
- * Uses reflectcpp to serialize StyleConfiguration struct to JSON.
- * Creates the file if it doesn't exist.
+ * Captures the ImGui style (when a context exists), then writes it with
+ * WriteConfiguration(). Main thread only, since it reads ImGui.
  *
  * @return true if configuration was saved successfully, false otherwise
  */
 bool StyleManager::SaveConfiguration() {
-	try {
-		// Check if ImGui context exists before capturing style
-		// During shutdown, ImGui context may be destroyed before StyleManager
-		if (ImGui::GetCurrentContext() != nullptr) {
-			// First capture current ImGui style
-			CaptureStyleFromImGui();
-		}
+	// Check if ImGui context exists before capturing style
+	// During shutdown, ImGui context may be destroyed before StyleManager
+	if (ImGui::GetCurrentContext() != nullptr) {
+		// First capture current ImGui style
+		CaptureStyleFromImGui();
+	}
+
+	return WriteConfiguration();
+}
 
+/**
+ * @brief Writes the style configuration as it is now, without reading ImGui
+ *
+ * Safe on any thread as long as nothing edits the configuration meanwhile.
+ * The file is written next to the target and renamed over it, so an exit in
+ * the middle of the write leaves the previous style_config.json intact.
+ *
+ * @return true if configuration was saved successfully, false otherwise
+ */
+bool StyleManager::WriteConfiguration() {
+	try {
 		// Serialize configuration to JSON using reflectcpp
 		std::string jsonContent = rfl::json::write(m_styleConfig);
 
-		// Open file for writing with UTF-8 encoding
-		std::ofstream file(m_configFilePath, std::ios::out | std::ios::binary | std::ios::trunc);
-		if (!file.is_open()) {
-			std::wcerr << L"Failed to create/open style configuration file: " << m_configFilePath
+		if (!Helpers::WriteFileAtomic(m_configFilePath, jsonContent)) {
+			std::wcerr << L"Failed to write style configuration file: " << m_configFilePath
 					   << std::endl;
 			return false;
 		}
 
-		// Write JSON content
-		file << jsonContent;
-		file.close();
-
 		std::wcout << L"Style configuration saved to: " << m_configFilePath << std::endl;
 		return true;
 
@@ -282,6 +308,8 @@ void StyleManager::ApplyStyleToImGui() {
 		ColorRGBAToImVec4(m_styleConfig.NavWindowingHighlight);
 	style.Colors[ImGuiCol_NavWindowingDimBg] = ColorRGBAToImVec4(m_styleConfig.NavWindowingDimBg);
 	style.Colors[ImGuiCol_ModalWindowDimBg]	 = ColorRGBAToImVec4(m_styleConfig.ModalWindowDimBg);
+
+	EventBus::Get_EventBus_Singleton()->Publish(StyleChanged{true});
 }
 
 /**
@@ -402,6 +430,7 @@ void StyleManager::CaptureStyleFromImGui() {
 void StyleManager::ApplyPresetDark() {
 	ImGui::StyleColorsDark();
 	CaptureStyleFromImGui();
+	EventBus::Get_EventBus_Singleton()->Publish(StyleChanged{false});
 }
 
 /**
@@ -411,6 +440,7 @@ void StyleManager::ApplyPresetDark() {
 void StyleManager::ApplyPresetLight() {
 	ImGui::StyleColorsLight();
 	CaptureStyleFromImGui();
+	EventBus::Get_EventBus_Singleton()->Publish(StyleChanged{false});
 }
 
 /**
@@ -420,6 +450,7 @@ void StyleManager::ApplyPresetLight() {
 void StyleManager::ApplyPresetClassic() {
 	ImGui::StyleColorsClassic();
 	CaptureStyleFromImGui();
+	EventBus::Get_EventBus_Singleton()->Publish(StyleChanged{false});
 }
 
 /**
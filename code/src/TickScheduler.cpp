@@ -0,0 +1,132 @@
+// TickScheduler.cpp
+// Implementation of the phased tick scheduler
+
+#include "PCH.hpp"
+#include "TickScheduler.hpp"
+
+namespace app {
+
+const char* TickPhaseName(TickPhase phase) {
+	switch (phase) {
+	case TickPhase::PreFrame: return "pre-frame";
+	case TickPhase::UI: return "UI";
+	case TickPhase::PostPresent: return "post-present";
+	case TickPhase::Background: return "background";
+	}
+	return "?";
+}
+
+TickScheduler::TickScheduler() : m_backgroundStop(false) {}
+
+TickScheduler::~TickScheduler() { StopBackground(); }
+
+void TickScheduler::Add(const char* name, void (*function)(), const TickOptions& options) {
+	// The function pointer rides in the object slot
+	AddEntry(name, reinterpret_cast<void*>(function),
+			 [](void* self) { reinterpret_cast<void (*)()>(self)(); }, options);
+}
+
+void TickScheduler::AddEntry(const char* name, void* object, void (*call)(void*), const TickOptions& options) {
+	IM_ASSERT(!m_background.joinable() && "Add() before StartBackground()");
+	IM_ASSERT((options.phase != TickPhase::Background || !options.enabled) &&
+			  "background entries cannot read a main-thread flag");
+
+	Stats& stats = m_stats.emplace_back();
+	stats.name	 = name;
+	stats.phase	 = options.phase;
+
+	std::vector<Entry>& entries = m_phases[static_cast<uint32_t>(options.phase)];
+	const Entry entry{options.enabled,	  object,			call, 0, options.periodMs,
+					  options.periodCVar, options.priority, &stats};
+
+	// After every entry of the same priority, so equal priorities keep their order
+	auto position = std::upper_bound(entries.begin(), entries.end(), entry,
+									 [](const Entry& a, const Entry& b) { return a.priority < b.priority; });
+	entries.insert(position, entry);
+}
+
+void TickScheduler::Run(TickPhase phase) {
+	IM_ASSERT(phase != TickPhase::Background);
+	std::vector<Entry>& entries = m_phases[static_cast<uint32_t>(phase)];
+	if (entries.empty()) return;
+	RunEntries(entries, Clock::now().time_since_epoch().count());
+}
+
+int64_t TickScheduler::RunEntries(std::vector<Entry>& entries, int64_t now) {
+	int64_t earliest = INT64_MAX;
+	for (Entry& entry : entries) {
+		if (entry.enabled && !*entry.enabled) continue;
+
+		const uint32_t periodMs = entry.periodCVar ? static_cast<uint32_t>(entry.periodCVar->Get()) : entry.periodMs;
+		if (periodMs) {
+			if (now < entry.nextDue) {
+				earliest = std::min(earliest, entry.nextDue);
+				continue;
+			}
+			// From now rather than the missed deadline: a stall does not cause a burst of runs
+			entry.nextDue = now + std::chrono::duration_cast<Clock::duration>(std::chrono::milliseconds(periodMs)).count();
+			earliest	  = std::min(earliest, entry.nextDue);
+		}
+
+		const Clock::time_point start = Clock::now();
+		entry.call(entry.object);
+		const int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+
+		// Only this thread writes them; plain load + store like SizeClassPool's counters
+		Stats& stats = *entry.stats;
+		stats.runs.store(stats.runs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		stats.lastNs.store(elapsed, std::memory_order_relaxed);
+		stats.totalNs.store(stats.totalNs.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+		if (elapsed > stats.maxNs.load(std::memory_order_relaxed)) stats.maxNs.store(elapsed, std::memory_order_relaxed);
+	}
+	return earliest;
+}
+
+void TickScheduler::StartBackground() {
+	if (m_background.joinable() || m_phases[static_cast<uint32_t>(TickPhase::Background)].empty()) return;
+	m_backgroundStop = false;
+	m_background	 = std::thread(&TickScheduler::BackgroundLoop, this);
+}
+
+void TickScheduler::StopBackground() {
+	if (!m_background.joinable()) return;
+	{
+		std::lock_guard<std::mutex> lock(m_backgroundMutex);
+		m_backgroundStop = true;
+	}
+	m_backgroundWake.notify_one();
+	m_background.join();
+}
+
+void TickScheduler::BackgroundLoop() {
+	std::vector<Entry>&			 entries = m_phases[static_cast<uint32_t>(TickPhase::Background)];
+	std::unique_lock<std::mutex> lock(m_backgroundMutex);
+	while (!m_backgroundStop) {
+		lock.unlock();
+		const int64_t next = RunEntries(entries, Clock::now().time_since_epoch().count());
+		lock.lock();
+
+		// Entries without a period would spin; give them the scheduler's own 100 ms
+		const Clock::time_point wake = next == INT64_MAX ? Clock::now() + std::chrono::milliseconds(100)
+														 : Clock::time_point(Clock::duration(next));
+		m_backgroundWake.wait_until(lock, wake, [this] { return m_backgroundStop; });
+	}
+}
+
+std::vector<TickScheduler::Timing> TickScheduler::GetTimings() const {
+	std::vector<Timing> timings;
+	for (const std::vector<Entry>& entries : m_phases) {
+		for (const Entry& entry : entries) {
+			const Stats& stats = *entry.stats;
+			timings.push_back(Timing{
+				stats.name, stats.phase, entry.priority,
+				entry.periodCVar ? static_cast<uint32_t>(entry.periodCVar->Get()) : entry.periodMs,
+				stats.runs.load(std::memory_order_relaxed), stats.lastNs.load(std::memory_order_relaxed) / 1000.0,
+				stats.maxNs.load(std::memory_order_relaxed) / 1000.0,
+				stats.totalNs.load(std::memory_order_relaxed) / 1000.0});
+		}
+	}
+	return timings;
+}
+
+} // namespace app
@@ -0,0 +1,856 @@
+// Utf.cpp
+// Implementation of the UTF-8 / UTF-16 / UTF-32 transcoders
+
+#include "PCH.hpp"
+#include "Utf.hpp"
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UTF_SSE2 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define UTF_NEON 1
+#include <arm_neon.h>
+#endif
+
+// AVX2 is not part of the build's baseline: the kernels are compiled for it
+// separately and only called after a runtime CPU check
+#if defined(UTF_SSE2) && (defined(_MSC_VER) || defined(__GNUC__))
+#define UTF_AVX2 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#define UTF_TARGET_AVX2
+#else
+#define UTF_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace app {
+namespace utf {
+
+namespace {
+
+// Below this many units the SIMD setup costs more than it saves
+constexpr size_t kAvx2MinLength = 64;
+
+template <typename Unit>
+inline uint32_t UnitValue(Unit unit) {
+	return static_cast<uint32_t>(static_cast<std::make_unsigned_t<Unit>>(unit));
+}
+
+#if defined(UTF_AVX2)
+bool HasAvx2() {
+	static const bool has = []() {
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+		__cpuid(info, 1);
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx	   = (info[2] & (1 << 28)) != 0;
+		if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) return false; // OS saves YMM state
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}();
+	return has;
+}
+
+// Each returns how far it got; the caller finishes with the SSE2 / scalar code
+
+UTF_TARGET_AVX2 size_t CountAsciiAvx2(const char* src, size_t len) {
+	size_t i = 0;
+	for (; i + 32 <= len; i += 32) {
+		const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+		if (_mm256_movemask_epi8(v) != 0) break;
+	}
+	return i;
+}
+
+UTF_TARGET_AVX2 size_t WidenAscii16Avx2(const char* src, size_t len, void* dst) {
+	char*  out = static_cast<char*>(dst);
+	size_t i   = 0;
+	for (; i + 32 <= len; i += 32) {
+		const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2),
+							_mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2 + 32),
+							_mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+	}
+	return i;
+}
+
+UTF_TARGET_AVX2 size_t WidenAscii32Avx2(const char* src, size_t len, void* dst) {
+	char*  out = static_cast<char*>(dst);
+	size_t i   = 0;
+	for (; i + 16 <= len; i += 16) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 4), _mm256_cvtepu8_epi32(v));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 4 + 32),
+							_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+	}
+	return i;
+}
+#endif
+
+/**
+ * @brief Copies src[0, len) to dst, zero-extended; src must be all ASCII
+ */
+template <typename Unit>
+void WidenAscii(const char* src, size_t len, Unit* dst) {
+	size_t i = 0;
+#if defined(UTF_SSE2)
+#if defined(UTF_AVX2)
+	if (len >= kAvx2MinLength && HasAvx2())
+		i = sizeof(Unit) == 2 ? WidenAscii16Avx2(src, len, dst) : WidenAscii32Avx2(src, len, dst);
+#endif
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= len; i += 16) {
+		const __m128i v	 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		const __m128i lo = _mm_unpacklo_epi8(v, zero);
+		const __m128i hi = _mm_unpackhi_epi8(v, zero);
+		__m128i*	  out = reinterpret_cast<__m128i*>(dst + i);
+		if constexpr (sizeof(Unit) == 2) {
+			_mm_storeu_si128(out, lo);
+			_mm_storeu_si128(out + 1, hi);
+		} else {
+			_mm_storeu_si128(out, _mm_unpacklo_epi16(lo, zero));
+			_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+			_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+			_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+		}
+	}
+#elif defined(UTF_NEON)
+	for (; i + 16 <= len; i += 16) {
+		const uint8x16_t v	= vld1q_u8(reinterpret_cast<const uint8_t*>(src + i));
+		const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+		const uint16x8_t hi = vmovl_high_u8(v);
+		if constexpr (sizeof(Unit) == 2) {
+			uint16_t* out = reinterpret_cast<uint16_t*>(dst + i);
+			vst1q_u16(out, lo);
+			vst1q_u16(out + 8, hi);
+		} else {
+			uint32_t* out = reinterpret_cast<uint32_t*>(dst + i);
+			vst1q_u32(out, vmovl_u16(vget_low_u16(lo)));
+			vst1q_u32(out + 4, vmovl_high_u16(lo));
+			vst1q_u32(out + 8, vmovl_u16(vget_low_u16(hi)));
+			vst1q_u32(out + 12, vmovl_high_u16(hi));
+		}
+	}
+#endif
+	for (; i < len; i++) dst[i] = static_cast<Unit>(static_cast<unsigned char>(src[i]));
+}
+
+/**
+ * @brief Length of the leading run of units below 0x80, narrowed into dst
+ *        on the way when Store is set
+ */
+template <bool Store, typename Unit>
+size_t NarrowAscii(const Unit* src, size_t len, char* dst) {
+	size_t i = 0;
+#if defined(UTF_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	if constexpr (sizeof(Unit) == 2) {
+		const __m128i high = _mm_set1_epi16(static_cast<short>(0xFF80));
+		for (; i + 16 <= len; i += 16) {
+			const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+			const __m128i any = _mm_and_si128(_mm_or_si128(a, b), high);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(any, zero)) != 0xFFFF) break;
+			if constexpr (Store)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(a, b));
+		}
+	} else {
+		const __m128i high = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+		for (; i + 16 <= len; i += 16) {
+			const __m128i* in  = reinterpret_cast<const __m128i*>(src + i);
+			const __m128i  a   = _mm_loadu_si128(in);
+			const __m128i  b   = _mm_loadu_si128(in + 1);
+			const __m128i  c   = _mm_loadu_si128(in + 2);
+			const __m128i  d   = _mm_loadu_si128(in + 3);
+			const __m128i  any = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), high);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xFFFF) break;
+			if constexpr (Store)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+								 _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+		}
+	}
+#elif defined(UTF_NEON)
+	if constexpr (sizeof(Unit) == 2) {
+		for (; i + 16 <= len; i += 16) {
+			const uint16_t*	 in = reinterpret_cast<const uint16_t*>(src + i);
+			const uint16x8_t a	= vld1q_u16(in);
+			const uint16x8_t b	= vld1q_u16(in + 8);
+			if (vmaxvq_u16(vorrq_u16(a, b)) >= 0x80) break;
+			if constexpr (Store)
+				vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+		}
+	} else {
+		for (; i + 16 <= len; i += 16) {
+			const uint32_t*	 in = reinterpret_cast<const uint32_t*>(src + i);
+			const uint32x4_t a	= vld1q_u32(in);
+			const uint32x4_t b	= vld1q_u32(in + 4);
+			const uint32x4_t c	= vld1q_u32(in + 8);
+			const uint32x4_t d	= vld1q_u32(in + 12);
+			if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) break;
+			if constexpr (Store) {
+				const uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+				const uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+				vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+			}
+		}
+	}
+#endif
+	for (; i < len && UnitValue(src[i]) < 0x80; i++)
+		if constexpr (Store) dst[i] = static_cast<char>(src[i]);
+	return i;
+}
+
+/**
+ * @brief Decodes the character at s (len >= 1)
+ * @return Bytes consumed. Errors consume one byte and yield kReplacementChar,
+ *         so a stray continuation byte or a truncated sequence becomes one
+ *         U+FFFD per byte.
+ */
+inline size_t DecodeUtf8(const unsigned char* s, size_t len, char32_t& cp) {
+	const uint32_t lead = s[0];
+	if (lead < 0x80) {
+		cp = lead;
+		return 1;
+	}
+
+	size_t	 trail;
+	uint32_t min;
+	if (lead >= 0xC2 && lead <= 0xDF) {
+		trail = 1;
+		cp	  = lead & 0x1F;
+		min	  = 0x80;
+	} else if (lead >= 0xE0 && lead <= 0xEF) {
+		trail = 2;
+		cp	  = lead & 0x0F;
+		min	  = 0x800;
+	} else if (lead >= 0xF0 && lead <= 0xF4) {
+		trail = 3;
+		cp	  = lead & 0x07;
+		min	  = 0x10000;
+	} else {
+		cp = kReplacementChar;
+		return 1;
+	}
+
+	if (len <= trail) {
+		cp = kReplacementChar;
+		return 1;
+	}
+	for (size_t k = 1; k <= trail; k++) {
+		if ((s[k] & 0xC0) != 0x80) {
+			cp = kReplacementChar;
+			return 1;
+		}
+		cp = (cp << 6) | (s[k] & 0x3F);
+	}
+	if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+		cp = kReplacementChar;
+		return 1;
+	}
+	return trail + 1;
+}
+
+/** @brief Decodes the character at s (len >= 1); returns units consumed */
+template <typename Unit>
+inline size_t DecodeWide(const Unit* s, size_t len, char32_t& cp) {
+	const uint32_t unit = UnitValue(s[0]);
+	if constexpr (sizeof(Unit) == 2) {
+		if (unit < 0xD800 || unit > 0xDFFF) {
+			cp = unit;
+			return 1;
+		}
+		if (unit <= 0xDBFF && len >= 2) {
+			const uint32_t low = UnitValue(s[1]);
+			if (low >= 0xDC00 && low <= 0xDFFF) {
+				cp = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+				return 2;
+			}
+		}
+		cp = kReplacementChar;
+		return 1;
+	} else {
+		cp = (unit > 0x10FFFF || (unit >= 0xD800 && unit <= 0xDFFF)) ? kReplacementChar : unit;
+		return 1;
+	}
+}
+
+template <typename Unit>
+inline size_t WideUnits(char32_t cp) {
+	return sizeof(Unit) == 2 && cp > 0xFFFF ? 2 : 1;
+}
+
+template <typename Unit>
+inline void EncodeWide(char32_t cp, Unit* dst) {
+	if (sizeof(Unit) == 2 && cp > 0xFFFF) {
+		cp -= 0x10000;
+		dst[0] = static_cast<Unit>(0xD800 + (cp >> 10));
+		dst[1] = static_cast<Unit>(0xDC00 + (cp & 0x3FF));
+	} else {
+		dst[0] = static_cast<Unit>(cp);
+	}
+}
+
+inline size_t Utf8Units(char32_t cp) {
+	return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+}
+
+inline void EncodeUtf8(char32_t cp, char* dst) {
+	if (cp < 0x80) {
+		dst[0] = static_cast<char>(cp);
+	} else if (cp < 0x800) {
+		dst[0] = static_cast<char>(0xC0 | (cp >> 6));
+		dst[1] = static_cast<char>(0x80 | (cp & 0x3F));
+	} else if (cp < 0x10000) {
+		dst[0] = static_cast<char>(0xE0 | (cp >> 12));
+		dst[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+		dst[2] = static_cast<char>(0x80 | (cp & 0x3F));
+	} else {
+		dst[0] = static_cast<char>(0xF0 | (cp >> 18));
+		dst[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+		dst[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+		dst[3] = static_cast<char>(0x80 | (cp & 0x3F));
+	}
+}
+
+inline unsigned char LowerAscii(unsigned char c) {
+	return static_cast<unsigned char>(c - 'A') < 26 ? static_cast<unsigned char>(c + 32) : c;
+}
+
+#if defined(UTF_SSE2)
+inline __m128i LowerAscii16(__m128i v) {
+	const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+										_mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+	return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+#elif defined(UTF_NEON)
+inline uint8x16_t LowerAscii16(uint8x16_t v) {
+	const uint8x16_t upper = vcltq_u8(vsubq_u8(v, vdupq_n_u8('A')), vdupq_n_u8(26));
+	return vorrq_u8(v, vandq_u8(upper, vdupq_n_u8(0x20)));
+}
+#endif
+
+/**
+ * @brief Copies the leading ASCII of src to dst with A-Z lowercased
+ * @return Bytes copied; stops at the first byte >= 0x80. dst may equal or
+ *         precede src (in-place folding).
+ */
+size_t LowerAsciiPrefix(const char* src, size_t len, char* dst) {
+	size_t i = 0;
+#if defined(UTF_SSE2)
+	for (; i + 16 <= len; i += 16) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		if (_mm_movemask_epi8(v) != 0) break;
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), LowerAscii16(v));
+	}
+#elif defined(UTF_NEON)
+	for (; i + 16 <= len; i += 16) {
+		const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(src + i));
+		if (vmaxvq_u8(v) >= 0x80) break;
+		vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), LowerAscii16(v));
+	}
+#endif
+	for (; i < len; i++) {
+		const unsigned char c = static_cast<unsigned char>(src[i]);
+		if (c >= 0x80) break;
+		dst[i] = static_cast<char>(LowerAscii(c));
+	}
+	return i;
+}
+
+/** @brief Length of the leading run that is ASCII in both a and b and equal ignoring case */
+size_t MatchAsciiNoCase(const char* a, const char* b, size_t len) {
+	size_t i = 0;
+#if defined(UTF_SSE2)
+	for (; i + 16 <= len; i += 16) {
+		const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+		const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+		if (_mm_movemask_epi8(_mm_or_si128(va, vb)) != 0) break;
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(LowerAscii16(va), LowerAscii16(vb))) != 0xFFFF) break;
+	}
+#elif defined(UTF_NEON)
+	for (; i + 16 <= len; i += 16) {
+		const uint8x16_t va = vld1q_u8(reinterpret_cast<const uint8_t*>(a + i));
+		const uint8x16_t vb = vld1q_u8(reinterpret_cast<const uint8_t*>(b + i));
+		if (vmaxvq_u8(vorrq_u8(va, vb)) >= 0x80) break;
+		if (vminvq_u8(vceqq_u8(LowerAscii16(va), LowerAscii16(vb))) != 0xFF) break;
+	}
+#endif
+	for (; i < len; i++) {
+		const unsigned char ca = static_cast<unsigned char>(a[i]);
+		const unsigned char cb = static_cast<unsigned char>(b[i]);
+		if ((ca | cb) >= 0x80 || LowerAscii(ca) != LowerAscii(cb)) break;
+	}
+	return i;
+}
+
+// Comparison key of the next character, advancing i past it. Invalid bytes
+// and lone surrogates sort after every character, by value.
+
+inline uint32_t NextFolded(const unsigned char* s, size_t len, size_t& i) {
+	char32_t	 cp;
+	const size_t used = DecodeUtf8(s + i, len - i, cp);
+	const uint32_t key = (used == 1 && s[i] >= 0x80) ? 0x110000u + s[i] : FoldCodePoint(cp);
+	i += used;
+	return key;
+}
+
+template <typename Unit>
+inline uint32_t NextFoldedWide(const Unit* s, size_t len, size_t& i) {
+	char32_t	   cp;
+	const uint32_t unit = UnitValue(s[i]);
+	const size_t   used = DecodeWide(s + i, len - i, cp);
+	const uint32_t key	= (cp == kReplacementChar && unit != kReplacementChar) ? 0x110000u + unit
+																				: FoldCodePoint(cp);
+	i += used;
+	return key;
+}
+
+constexpr uint32_t kFnvBasis = 2166136261u;
+constexpr uint32_t kFnvPrime = 16777619u;
+
+inline uint32_t HashUtf8Of(uint32_t hash, char32_t cp) {
+	char		 bytes[4];
+	const size_t count = Utf8Units(cp);
+	EncodeUtf8(cp, bytes);
+	for (size_t k = 0; k < count; k++) hash = (hash ^ static_cast<unsigned char>(bytes[k])) * kFnvPrime;
+	return hash;
+}
+
+} // namespace
+
+size_t CountAscii(const char* src, size_t len) {
+	size_t i = 0;
+#if defined(UTF_AVX2)
+	if (len >= kAvx2MinLength && HasAvx2()) i = CountAsciiAvx2(src, len);
+#endif
+#if defined(UTF_SSE2)
+	for (; i + 16 <= len; i += 16) {
+		const int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+		if (mask != 0) return i + std::countr_zero(static_cast<unsigned>(mask));
+	}
+#elif defined(UTF_NEON)
+	for (; i + 16 <= len; i += 16)
+		if (vmaxvq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(src + i))) >= 0x80) break;
+#else
+	// Eight bytes at a time
+	for (; i + 8 <= len; i += 8) {
+		uint64_t word;
+		std::memcpy(&word, src + i, sizeof(word));
+		if (word & 0x8080808080808080ull) break;
+	}
+#endif
+	while (i < len && static_cast<unsigned char>(src[i]) < 0x80) i++;
+	return i;
+}
+
+bool IsValidUtf8(const char* src, size_t len) {
+	const auto* s = reinterpret_cast<const unsigned char*>(src);
+	for (size_t i = 0; i < len;) {
+		i += CountAscii(src + i, len - i);
+		if (i == len) break;
+
+		char32_t	 cp;
+		const size_t used = DecodeUtf8(s + i, len - i, cp);
+		if (used == 1) return false; // Multi-byte lead that did not decode
+		i += used;
+	}
+	return true;
+}
+
+template <typename Unit>
+size_t WideLengthFromUtf8(const char* src, size_t len) {
+	const auto* s	  = reinterpret_cast<const unsigned char*>(src);
+	size_t		units = 0;
+	for (size_t i = 0; i < len;) {
+		const size_t ascii = CountAscii(src + i, len - i);
+		units += ascii;
+		i += ascii;
+		if (i == len) break;
+
+		char32_t cp;
+		i += DecodeUtf8(s + i, len - i, cp);
+		units += WideUnits<Unit>(cp);
+	}
+	return units;
+}
+
+template <typename Unit>
+size_t Utf8ToWide(const char* src, size_t len, Unit* dst, size_t dstCapacity) {
+	const auto* s	= reinterpret_cast<const unsigned char*>(src);
+	size_t		out = 0;
+	for (size_t i = 0; i < len;) {
+		const size_t ascii = std::min(CountAscii(src + i, len - i), dstCapacity - out);
+		WidenAscii(src + i, ascii, dst + out);
+		out += ascii;
+		i += ascii;
+		if (i == len || out == dstCapacity) break;
+
+		char32_t	 cp;
+		const size_t used  = DecodeUtf8(s + i, len - i, cp);
+		const size_t units = WideUnits<Unit>(cp);
+		if (out + units > dstCapacity) break;
+		EncodeWide(cp, dst + out);
+		out += units;
+		i += used;
+	}
+	return out;
+}
+
+template <typename Unit>
+size_t Utf8LengthFromWide(const Unit* src, size_t len) {
+	size_t bytes = 0;
+	for (size_t i = 0; i < len;) {
+		const size_t ascii = NarrowAscii<false>(src + i, len - i, nullptr);
+		bytes += ascii;
+		i += ascii;
+		if (i == len) break;
+
+		char32_t cp;
+		i += DecodeWide(src + i, len - i, cp);
+		bytes += Utf8Units(cp);
+	}
+	return bytes;
+}
+
+template <typename Unit>
+size_t WideToUtf8(const Unit* src, size_t len, char* dst, size_t dstCapacity) {
+	size_t out = 0;
+	for (size_t i = 0; i < len;) {
+		const size_t ascii = NarrowAscii<true>(src + i, std::min(len - i, dstCapacity - out), dst + out);
+		out += ascii;
+		i += ascii;
+		if (i == len || out == dstCapacity) break;
+
+		char32_t	 cp;
+		const size_t used  = DecodeWide(src + i, len - i, cp);
+		const size_t bytes = Utf8Units(cp);
+		if (out + bytes > dstCapacity) break;
+		EncodeUtf8(cp, dst + out);
+		out += bytes;
+		i += used;
+	}
+	return out;
+}
+
+template <typename Unit>
+size_t WideToUtf8Cstr(const Unit* src, char* dst, size_t dstSize) {
+	const size_t written = WideToUtf8(src, Length(src), dst, dstSize - 1);
+	dst[written]		 = '\0';
+	return written;
+}
+
+template <typename Unit>
+size_t Utf8ToWideCstr(const char* src, Unit* dst, size_t dstSize) {
+	const size_t written = Utf8ToWide(src, src ? std::strlen(src) : 0, dst, dstSize - 1);
+	dst[written]		 = 0;
+	return written;
+}
+
+size_t Utf16ToUtf32(const char16_t* src, size_t len, char32_t* dst, size_t dstCapacity) {
+	size_t out = 0;
+	for (size_t i = 0; i < len && out < dstCapacity; out++) i += DecodeWide(src + i, len - i, dst[out]);
+	return out;
+}
+
+size_t Utf32ToUtf16(const char32_t* src, size_t len, char16_t* dst, size_t dstCapacity) {
+	size_t out = 0;
+	for (size_t i = 0; i < len; i++) {
+		char32_t cp;
+		DecodeWide(src + i, 1, cp);
+		const size_t units = WideUnits<char16_t>(cp);
+		if (out + units > dstCapacity) break;
+		EncodeWide(cp, dst + out);
+		out += units;
+	}
+	return out;
+}
+
+std::wstring ToWide(std::string_view utf8) {
+	std::wstring wide(WideLengthFromUtf8<wchar_t>(utf8.data(), utf8.size()), L'\0');
+	Utf8ToWide(utf8.data(), utf8.size(), wide.data(), wide.size());
+	return wide;
+}
+
+std::string ToUtf8(std::wstring_view wide) {
+	std::string utf8;
+	AppendUtf8(utf8, wide);
+	return utf8;
+}
+
+void AppendUtf8(std::string& out, std::wstring_view wide) {
+	const size_t offset = out.size();
+	const size_t bytes	= Utf8LengthFromWide(wide.data(), wide.size());
+	out.resize(offset + bytes);
+	WideToUtf8(wide.data(), wide.size(), out.data() + offset, bytes);
+}
+
+char32_t FoldCodePoint(char32_t cp) {
+	// Ranges of alternating upper/lower pairs fold with cp | 1 (upper even) or
+	// cp + 1 (upper odd). Every mapping keeps the UTF-8 length or shortens it,
+	// and keeps BMP in the BMP, so wide folding never changes the unit count.
+	if (cp < 0x80) return (cp - 'A' < 26u) ? cp + 32 : cp;
+	if (cp < 0x100) {
+		if (cp == 0xB5) return 0x3BC; // MICRO SIGN -> GREEK SMALL MU
+		return (cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) ? cp + 32 : cp;
+	}
+	if (cp < 0x180) {
+		if (cp == 0x130) return cp; // Capital I with dot only has a two-character folding
+		if (cp == 0x178) return 0xFF;
+		if (cp == 0x17F) return 's';
+		if (cp <= 0x137 || (cp >= 0x14A && cp <= 0x177)) return cp | 1;
+		if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) return (cp & 1) ? cp + 1 : cp;
+		return cp;
+	}
+	if (cp < 0x250) {
+		if (cp >= 0x1CD && cp <= 0x1DC) return (cp & 1) ? cp + 1 : cp;
+		if ((cp >= 0x1DE && cp <= 0x1EF) || (cp >= 0x1F8 && cp <= 0x21F) || (cp >= 0x222 && cp <= 0x233) ||
+			(cp >= 0x246 && cp <= 0x24F))
+			return cp | 1;
+		return cp;
+	}
+	if (cp < 0x370) return cp;
+	if (cp < 0x400) { // Greek
+		if (cp == 0x386) return 0x3AC;
+		if (cp >= 0x388 && cp <= 0x38A) return cp + 37;
+		if (cp == 0x38C) return 0x3CC;
+		if (cp == 0x38E || cp == 0x38F) return cp + 63;
+		if ((cp >= 0x391 && cp <= 0x3A1) || (cp >= 0x3A3 && cp <= 0x3AB)) return cp + 32;
+		if (cp == 0x3C2) return 0x3C3; // Final sigma
+		if (cp >= 0x3D8 && cp <= 0x3EF) return cp | 1;
+		return cp;
+	}
+	if (cp < 0x530) { // Cyrillic
+		if (cp < 0x410) return cp + 80;
+		if (cp < 0x430) return cp + 32;
+		if ((cp >= 0x460 && cp <= 0x481) || (cp >= 0x48A && cp <= 0x4BF) || (cp >= 0x4D0 && cp <= 0x52F))
+			return cp | 1;
+		if (cp == 0x4C0) return 0x4CF;
+		if (cp >= 0x4C1 && cp <= 0x4CE) return (cp & 1) ? cp + 1 : cp;
+		return cp;
+	}
+	if (cp < 0x1000) return (cp >= 0x531 && cp <= 0x556) ? cp + 48 : cp; // Armenian
+	if (cp < 0x1E00) {
+		if ((cp >= 0x10A0 && cp <= 0x10C5) || cp == 0x10C7 || cp == 0x10CD) return cp + 0x1C60; // Georgian
+		return cp;
+	}
+	if (cp < 0x1F00) { // Latin Extended Additional
+		if (cp == 0x1E9E) return 0xDF;
+		return (cp <= 0x1E95 || cp >= 0x1EA0) ? cp | 1 : cp;
+	}
+	if (cp < 0x2000) { // Greek Extended: capitals sit 8 above their small letters
+		if ((cp & 0xF) < 8) return cp;
+		if ((cp >= 0x1F08 && cp <= 0x1F0F) || (cp >= 0x1F18 && cp <= 0x1F1D) || (cp >= 0x1F28 && cp <= 0x1F2F) ||
+			(cp >= 0x1F38 && cp <= 0x1F3F) || (cp >= 0x1F48 && cp <= 0x1F4D) || (cp >= 0x1F68 && cp <= 0x1F6F) ||
+			cp == 0x1F59 || cp == 0x1F5B || cp == 0x1F5D || cp == 0x1F5F)
+			return cp - 8;
+		return cp;
+	}
+	if (cp < 0x2C00) {
+		if (cp == 0x2126) return 0x3C9; // OHM SIGN
+		if (cp == 0x212A) return 'k';	// KELVIN SIGN
+		if (cp == 0x212B) return 0xE5;	// ANGSTROM SIGN
+		if (cp >= 0x2160 && cp <= 0x216F) return cp + 16; // Roman numerals
+		if (cp >= 0x24B6 && cp <= 0x24CF) return cp + 26; // Circled letters
+		return cp;
+	}
+	if (cp <= 0x2C2F) return cp + 48;					// Glagolitic
+	if (cp >= 0xFF21 && cp <= 0xFF3A) return cp + 32;	// Fullwidth Latin
+	if (cp >= 0x10400 && cp <= 0x10427) return cp + 40; // Deseret
+	return cp;
+}
+
+void ToLowerAscii(char* text, size_t len) {
+	size_t i = 0;
+#if defined(UTF_SSE2)
+	for (; i + 16 <= len; i += 16) {
+		__m128i* p = reinterpret_cast<__m128i*>(text + i);
+		_mm_storeu_si128(p, LowerAscii16(_mm_loadu_si128(p)));
+	}
+#elif defined(UTF_NEON)
+	for (; i + 16 <= len; i += 16) {
+		uint8_t* p = reinterpret_cast<uint8_t*>(text + i);
+		vst1q_u8(p, LowerAscii16(vld1q_u8(p)));
+	}
+#endif
+	for (; i < len; i++) text[i] = static_cast<char>(LowerAscii(static_cast<unsigned char>(text[i])));
+}
+
+size_t FoldCase(std::string_view src, char* dst, size_t dstCapacity) {
+	const unsigned char* s	 = reinterpret_cast<const unsigned char*>(src.data());
+	const size_t		 len = src.size();
+	size_t				 in = 0, out = 0;
+	while (in < len) {
+		const size_t ascii = LowerAsciiPrefix(src.data() + in, std::min(len - in, dstCapacity - out), dst + out);
+		in += ascii;
+		out += ascii;
+		if (in == len || out == dstCapacity) break;
+
+		char32_t	 cp;
+		const size_t used = DecodeUtf8(s + in, len - in, cp);
+		if (used == 1) { // Invalid byte: kept as is
+			dst[out++] = src[in++];
+			continue;
+		}
+		const char32_t folded = FoldCodePoint(cp);
+		const size_t   bytes  = Utf8Units(folded);
+		if (out + bytes > dstCapacity) break;
+		EncodeUtf8(folded, dst + out); // bytes <= used, so this never overtakes the input in place
+		in += used;
+		out += bytes;
+	}
+	return out;
+}
+
+size_t FoldCase(char* text, size_t len) {
+	return FoldCase(std::string_view(text, len), text, len);
+}
+
+void FoldCase(std::string& text) {
+	text.resize(FoldCase(text.data(), text.size()));
+}
+
+template <typename Unit>
+void FoldCaseWide(Unit* text, size_t len) {
+	for (size_t i = 0; i < len;) {
+		const uint32_t unit = UnitValue(text[i]);
+		if (unit < 0x80) {
+			text[i++] = static_cast<Unit>(LowerAscii(static_cast<unsigned char>(unit)));
+			continue;
+		}
+		char32_t	 cp;
+		const size_t used = DecodeWide(text + i, len - i, cp);
+		if (cp != kReplacementChar) EncodeWide(FoldCodePoint(cp), text + i);
+		i += used;
+	}
+}
+
+void FoldCase(std::wstring& text) {
+	FoldCaseWide(text.data(), text.size());
+}
+
+int CompareNoCase(std::string_view a, std::string_view b) {
+	const unsigned char* pa = reinterpret_cast<const unsigned char*>(a.data());
+	const unsigned char* pb = reinterpret_cast<const unsigned char*>(b.data());
+	size_t				 i = 0, j = 0;
+	for (;;) {
+		// Offsets drift apart only after foldings that change the length (K, long s)
+		if (i == j) {
+			const size_t same = MatchAsciiNoCase(a.data() + i, b.data() + i, std::min(a.size(), b.size()) - i);
+			i += same;
+			j += same;
+		}
+		if (i == a.size() || j == b.size()) break;
+		const uint32_t ka = NextFolded(pa, a.size(), i);
+		const uint32_t kb = NextFolded(pb, b.size(), j);
+		if (ka != kb) return ka < kb ? -1 : 1;
+	}
+	return int(i < a.size()) - int(j < b.size());
+}
+
+bool EqualsNoCase(std::string_view a, std::string_view b) {
+	return CompareNoCase(a, b) == 0;
+}
+
+bool StartsWithNoCase(std::string_view text, std::string_view prefix) {
+	const unsigned char* pt = reinterpret_cast<const unsigned char*>(text.data());
+	const unsigned char* pp = reinterpret_cast<const unsigned char*>(prefix.data());
+	size_t				 i = 0, j = 0;
+	for (;;) {
+		if (i == j) {
+			const size_t same =
+				MatchAsciiNoCase(text.data() + i, prefix.data() + i, std::min(text.size(), prefix.size()) - i);
+			i += same;
+			j += same;
+		}
+		if (j == prefix.size()) return true;
+		if (i == text.size()) return false;
+		if (NextFolded(pt, text.size(), i) != NextFolded(pp, prefix.size(), j)) return false;
+	}
+}
+
+template <typename Unit>
+int CompareNoCaseWide(const Unit* a, size_t aLen, const Unit* b, size_t bLen) {
+	size_t i = 0, j = 0;
+	while (i < aLen && j < bLen) {
+		const uint32_t ua = UnitValue(a[i]);
+		const uint32_t ub = UnitValue(b[j]);
+		uint32_t	   ka, kb;
+		if ((ua | ub) < 0x80) {
+			ka = LowerAscii(static_cast<unsigned char>(ua));
+			kb = LowerAscii(static_cast<unsigned char>(ub));
+			i++;
+			j++;
+		} else {
+			ka = NextFoldedWide(a, aLen, i);
+			kb = NextFoldedWide(b, bLen, j);
+		}
+		if (ka != kb) return ka < kb ? -1 : 1;
+	}
+	return int(i < aLen) - int(j < bLen);
+}
+
+uint32_t HashNoCase(std::string_view text) {
+	const unsigned char* s	  = reinterpret_cast<const unsigned char*>(text.data());
+	uint32_t			 hash = kFnvBasis;
+	for (size_t i = 0; i < text.size();) {
+		if (s[i] < 0x80) {
+			hash = (hash ^ LowerAscii(s[i++])) * kFnvPrime;
+			continue;
+		}
+		char32_t	 cp;
+		const size_t used = DecodeUtf8(s + i, text.size() - i, cp);
+		hash			  = used == 1 ? (hash ^ s[i]) * kFnvPrime : HashUtf8Of(hash, FoldCodePoint(cp));
+		i += used;
+	}
+	return hash;
+}
+
+template <typename Unit>
+uint32_t HashNoCaseWide(const Unit* text, size_t len) {
+	uint32_t hash = kFnvBasis;
+	for (size_t i = 0; i < len;) {
+		const uint32_t unit = UnitValue(text[i]);
+		if (unit < 0x80) {
+			hash = (hash ^ LowerAscii(static_cast<unsigned char>(unit))) * kFnvPrime;
+			i++;
+			continue;
+		}
+		char32_t cp;
+		i += DecodeWide(text + i, len - i, cp);
+		hash = HashUtf8Of(hash, FoldCodePoint(cp));
+	}
+	return hash;
+}
+
+#define UTF_INSTANTIATE(Unit)                                                                     \
+	template size_t WideLengthFromUtf8<Unit>(const char*, size_t);                                \
+	template size_t Utf8ToWide<Unit>(const char*, size_t, Unit*, size_t);                         \
+	template size_t Utf8LengthFromWide<Unit>(const Unit*, size_t);                                \
+	template size_t WideToUtf8<Unit>(const Unit*, size_t, char*, size_t);                         \
+	template size_t WideToUtf8Cstr<Unit>(const Unit*, char*, size_t);                             \
+	template size_t Utf8ToWideCstr<Unit>(const char*, Unit*, size_t);                             \
+	template void	  FoldCaseWide<Unit>(Unit*, size_t);                                            \
+	template int	  CompareNoCaseWide<Unit>(const Unit*, size_t, const Unit*, size_t);            \
+	template uint32_t HashNoCaseWide<Unit>(const Unit*, size_t);
+
+UTF_INSTANTIATE(char16_t)
+UTF_INSTANTIATE(char32_t)
+UTF_INSTANTIATE(wchar_t)
+UTF_INSTANTIATE(unsigned short)
+UTF_INSTANTIATE(unsigned int)
+
+#undef UTF_INSTANTIATE
+
+} // namespace utf
+} // namespace app
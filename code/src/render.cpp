@@ -17,17 +17,42 @@
 #include "Classes.hpp"
 #include "MemoryManagement.hpp"
 
+#if APP_FEATURE_FILE_BROWSER // See Features.hpp
+
 namespace app {
 
+namespace {
+
+// The listing is re-read at most this often unless the directory changes
+constexpr double kListingRefreshSeconds = 1.0;
+
+// Last component of a path, without allocating a new path
+std::wstring_view FileName(const fs::path& path) {
+	const std::wstring& native = path.native();
+	return std::wstring_view(native).substr(native.find_last_of(L"\\/") + 1);
+}
+
+// Same rules as fs::path::extension(): ".gitignore", "." and ".." have none
+std::wstring_view Extension(std::wstring_view name) {
+	if (name == L"." || name == L"..") return {};
+	const size_t dot = name.find_last_of(L'.');
+	if (dot == std::wstring_view::npos || dot == 0) return {};
+	return name.substr(dot);
+}
+
+} // namespace
+
 /**
  * @brief Opens the m_window.
  * 
- * This function is called when the m_window is first opened.
- * Currently a placeholder
- * for initialization logic that should occur when the m_window becomes
- * visible.
+ * Called when the window is first shown (see LazyPanel.hpp); resolves the
+ * frame arena the per-frame strings are built in and the flag that shows the window.
  */
-void WindowClass::Open() {}
+void WindowClass::Open() {
+	MemoryManagement* memory = MemoryManagement::Get_MemoryManagement_Singleton();
+	m_shown					 = &memory->m_bShow_FileSys_window;
+	m_frameArena			 = memory->Get<FrameArena>();
+}
 
 /**
  * @brief Tick function called each frame.
@@ -56,18 +81,20 @@ void WindowClass::Close() {}
  * - m_currentPath is set to the application's current working directory
  * - m_selectedEntry is set to an empty path
  * - m_renameDialogOpen and m_deleteDialogOpen are set to false
- * - m_memory is initialized with a reference to the MemoryManagement singleton
  *
- * @see MemoryManagement::Get_MemoryManagement_Singleton()
+ * Service pointers stay null until Open().
  */
 WindowClass::WindowClass() :
 m_currentPath(fs::current_path()),
 m_selectedEntry(fs::path{}),
-m_memory(nullptr),
+m_shown(nullptr),
+m_frameArena(nullptr),
+m_entries(),
+m_listedPath(),
+m_listedTime(-1.0),
+m_listing(false),
 m_renameDialogOpen(false),
-m_deleteDialogOpen(false) {
-	m_memory = MemoryManagement::Get_MemoryManagement_Singleton();
-}
+m_deleteDialogOpen(false) {}
 
 /**
  * @brief Destroy the Window Class object.
@@ -75,15 +102,10 @@ m_deleteDialogOpen(false) {
  * Performs cleanup by:
  * - Clearing the m_currentPath filesystem path
  * - Clearing the m_selectedEntry filesystem path
- * - Resetting the m_memory pointer to nullptr
- *
- * @note This destructor does not delete the MemoryManagement instance as it is
- *       a singleton managed elsewhere in the application.
  */
 WindowClass::~WindowClass() {
 	m_currentPath.clear();
 	m_selectedEntry.clear();
-	m_memory = nullptr;
 }
 
 /**
@@ -100,7 +122,7 @@ WindowClass::~WindowClass() {
  *
  * @param label The m_window title displayed in the ImGui title bar.
  *
- * @note The m_window visibility is controlled by m_memory->m_bShow_FileSys_window
+ * @note The m_window visibility is controlled by MemoryManagement::m_bShow_FileSys_window
  * @see DrawMenu(), DrawContent(), DrawActions(), DrawFilters()
  */
 void WindowClass::Draw(std::string_view label) {
@@ -108,12 +130,14 @@ void WindowClass::Draw(std::string_view label) {
 		ImGuiWindowFlags_::ImGuiWindowFlags_AlwaysHorizontalScrollbar |
 		ImGuiWindowFlags_::ImGuiWindowFlags_AlwaysAutoResize};
 
+	MemTagScope tag(MemTag::FileBrowser);
+
 	ig::SetNextWindowSize(ImVec2(1000.f, 800.f));
 
 
 
 
-	ImGui::Begin(label.data(), &m_memory->m_bShow_FileSys_window, window_flags);
+	ImGui::Begin(label.data(), m_shown, window_flags);
 	{
 		DrawMenu();
 		ig::Separator();
@@ -146,7 +170,8 @@ void WindowClass::DrawMenu() {
 	}
 
 	ImGui::SameLine();
-	ImGui::Text("Current directory: %s", m_currentPath.string().c_str());
+	FrameArena::HeapProbe probe(*m_frameArena);
+	ImGui::Text("Current directory: %s", m_frameArena->Utf8(m_currentPath.native()).data());
 }
 
 /**
@@ -169,23 +194,82 @@ void WindowClass::DrawContent() {
 	ImGui::Text("Content: ");
 	ig::Spacing();
 
-	for (const auto& entry : fs::directory_iterator(m_currentPath)) {
-		const bool is_selected	= entry.path() == m_selectedEntry;
-		const bool is_directory = entry.is_directory();
-		const bool is_file		= entry.is_regular_file();
-		str		   entry_name	= entry.path().filename().string();
+	RefreshListing();
 
-		if (is_directory) entry_name = "[D] " + entry_name;
-		else if (is_file) entry_name = "[F] " + entry_name;
+	FrameArena::HeapProbe probe(*m_frameArena);
+	for (const ListedEntry& entry : m_entries) {
+		const bool		 is_selected = entry.path == m_selectedEntry;
+		const char*		 prefix		 = entry.isDirectory ? "[D] " : entry.isFile ? "[F] " : "";
+		std::string_view entry_name	 = m_frameArena->Concat({prefix, m_frameArena->Utf8(FileName(entry.path))});
 
-		if (ig::Selectable(entry_name.c_str(), is_selected)) {
-			if (is_directory) m_currentPath /= entry.path().filename();
-			m_selectedEntry = entry.path();
+		if (ig::Selectable(entry_name.data(), is_selected)) {
+			if (entry.isDirectory) m_currentPath /= entry.path.filename();
+			m_selectedEntry = entry.path;
 		}
 		ig::Separator();
 	}
 }
 
+/**
+ * @brief Reads the directory listing when it may have changed.
+ *
+ * Reading the directory every frame cost a directory handle and a path per
+ * entry per frame. The listing is kept instead and read again when
+ * m_currentPath changes, after a rename or delete, and at most every
+ * kListingRefreshSeconds otherwise so changes made outside the app show up.
+ *
+ * The read runs as a job, since a large or network directory can take longer
+ * than a frame; the previous listing stays on screen until the result comes
+ * back on the main thread. Without worker threads it is read here.
+ */
+void WindowClass::RefreshListing() {
+	const double now = ImGui::GetTime();
+	if (m_listing) return;
+	if (m_listedTime >= 0.0 && m_listedPath == m_currentPath && now - m_listedTime < kListingRefreshSeconds)
+		return;
+
+	// A rename or delete while the job runs resets m_listedTime, so its result is read again
+	m_listedTime = now;
+
+	JobSystem* jobs = JobSystem::Get_JobSystem_Singleton();
+	if (!jobs->IsRunning()) {
+		std::vector<ListedEntry> entries = ListDirectory(m_currentPath);
+		m_entries.assign(std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+		m_listedPath = m_currentPath;
+		return;
+	}
+
+	m_listing = true;
+	jobs->Schedule([this, jobs, path = m_currentPath]() {
+		jobs->RunOnMainThread([this, path, entries = ListDirectory(path)]() mutable {
+			m_entries.clear(); // Keeps the capacity
+			m_entries.insert(m_entries.end(), std::make_move_iterator(entries.begin()),
+							 std::make_move_iterator(entries.end()));
+			m_listedPath = std::move(path);
+			m_listing	 = false;
+		});
+	});
+}
+
+std::vector<WindowClass::ListedEntry> WindowClass::ListDirectory(const fs::path& path) {
+	std::vector<ListedEntry> entries;
+
+	// A listing cut short by the exit is never shown, so a slow folder can't hold up Stop()
+	const JobSystem* jobs = JobSystem::Get_JobSystem_Singleton();
+
+	std::error_code			ec;
+	fs::directory_iterator it(path, ec);
+	for (; !ec && it != fs::directory_iterator() && !jobs->IsStopping(); it.increment(ec)) {
+		std::error_code typeError;
+		const bool		isDirectory = it->is_directory(typeError);
+		const bool		isFile		= it->is_regular_file(typeError);
+		// Interned once per listing, so the extension filter compares ids
+		const StrId extension(isFile ? utf::ToUtf8(Extension(FileName(it->path()))) : std::string());
+		entries.push_back(ListedEntry{it->path(), isDirectory, isFile, extension});
+	}
+	return entries;
+}
+
 /**
  * @brief Displays available operations for the selected filesystem entry.
  *
@@ -201,11 +285,14 @@ void WindowClass::DrawContent() {
 void WindowClass::DrawActions() {
 	ImGui::Text("Actions");
 
-	if (fs::is_directory(m_selectedEntry))
-		ig::Text("Selected dir: %s", m_selectedEntry.string().c_str());
-	else if (fs::is_regular_file(m_selectedEntry))
-		ig::Text("Selected file: %s", m_selectedEntry.string().c_str());
-	else { ig::Text("nothing selectected"); }
+	{
+		FrameArena::HeapProbe probe(*m_frameArena);
+		if (fs::is_directory(m_selectedEntry))
+			ig::Text("Selected dir: %s", m_frameArena->Utf8(m_selectedEntry.native()).data());
+		else if (fs::is_regular_file(m_selectedEntry))
+			ig::Text("Selected file: %s", m_frameArena->Utf8(m_selectedEntry.native()).data());
+		else { ig::Text("nothing selectected"); }
+	}
 
 	if (fs::is_regular_file(m_selectedEntry) && ig::Button("Open")) OpenFileWithDefaultEditor();
 
@@ -235,7 +322,9 @@ void WindowClass::DrawActions() {
  * (including the dot, e.g., ".txt", ".cpp"). The count is updated in real-time
  * and only includes regular files, not directories.
  *
- * @note The filter uses exact string matching, not pattern matching.
+ * @note The filter uses exact string matching, not pattern matching: the
+ * extensions are interned by ListDirectory() and the filter is looked up in
+ * the same pool, so each entry costs one id compare.
  * @note If the filter field is empty, no count is displayed.
  */
 void WindowClass::DrawFilters() {
@@ -248,10 +337,14 @@ void WindowClass::DrawFilters() {
 
 	if (std::strlen(extention_filter) == 0) return;
 
-	size_t filtered_file_count{};
-	for (const auto& entry : fs::directory_iterator(m_currentPath)) {
-		if (!fs::is_regular_file(entry)) continue;
-		if (entry.path().extension().string() == extention_filter) ++filtered_file_count;
+	// Uses the listing DrawContent() refreshed this frame. Text that was never
+	// interned is no listed extension; Find() does not add it to the pool.
+	const uint32_t filter_id = StringPool::Get_StringPool_Singleton()->Find(extention_filter);
+	size_t		   filtered_file_count{};
+	if (filter_id != StringPool::kInvalidId) {
+		for (const ListedEntry& entry : m_entries) {
+			if (entry.isFile && entry.extension.GetId() == filter_id) ++filtered_file_count;
+		}
 	}
 
 	ig::Text("Number of files: %u", filtered_file_count);
@@ -345,7 +438,7 @@ void WindowClass::RenameFilePopUp() {
  */
 void WindowClass::DeleteFilePopUp() {
 	if (ig::BeginPopupModal("Delete File", &m_deleteDialogOpen)) {
-		ig::Text("Are you sure that you want to delete %s?", m_selectedEntry.string().c_str());
+		ig::Text("Are you sure that you want to delete %s?", m_frameArena->Utf8(m_selectedEntry.native()).data());
 		{
 			if (ig::Button("Yes")) {
 				if (deleteFile(m_selectedEntry)) m_selectedEntry.clear();
@@ -376,6 +469,7 @@ void WindowClass::DeleteFilePopUp() {
 HRESULT WindowClass::renameFile(const fs::path& old_Path, const fs::path& new_Path) {
     try {
         fs::rename(old_Path, new_Path);
+        m_listedTime = -1.0;
         return S_OK;
     } catch(const fs::filesystem_error& e) {
 
@@ -408,6 +502,7 @@ HRESULT WindowClass::renameFile(const fs::path& old_Path, const fs::path& new_Pa
 HRESULT WindowClass::deleteFile(const fs::path& Path) {
 	try {
 		fs::remove(Path);
+		m_listedTime = -1.0;
 		return S_OK;
 	} catch (const fs::filesystem_error& e) {
 
@@ -426,3 +521,5 @@ HRESULT WindowClass::deleteFile(const fs::path& Path) {
 
 
 } // namespace app
+
+#endif // APP_FEATURE_FILE_BROWSER